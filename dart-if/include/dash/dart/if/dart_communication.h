@@ -169,6 +169,8 @@ dart_ret_t dart_allgatherv(
  * DART Equivalent to MPI allreduce.
  *
  * \param sendbuf The buffer containing the data to be sent by each unit.
+ *                Performs an in-place reduction if \c sendbuf is equal to
+ *                \c recvbuf.
  * \param recvbuf The buffer to hold the received data.
  * \param nelem   Number of elements sent by each process and received from each unit.
  * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use in \c op.
@@ -192,6 +194,8 @@ dart_ret_t dart_allreduce(
  * DART Equivalent to MPI_Reduce.
  *
  * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ *                Performs an in-place reduction if \c sendbuf is equal to
+ *                \c recvbuf.
  * \param recvbuf Buffer of size \c nelem to store the result of the element-wise operation \c op in.
  * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
  * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
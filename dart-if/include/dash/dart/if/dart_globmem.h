@@ -292,6 +292,88 @@ dart_ret_t dart_memalloc(
  */
 dart_ret_t dart_memfree(dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Registers a local buffer that is used as origin or destination of
+ * repeated one-sided transfers, such as a staging buffer for blocks
+ * fetched in an iterative algorithm.
+ * The pages of registered buffers are pinned in physical memory so
+ * transfers do not page-fault. Transfer functions do not consult
+ * registrations, registration of pinned pages with the network is left
+ * to the communication backend.
+ *
+ * Registrations are held in a cache of limited size (environment variable
+ * \c DART_BUFFER_CACHE_SIZE, default 64 entries). If the cache is full,
+ * the least recently registered buffer is deregistered implicitly.
+ * Registering a buffer that is already contained in a registration
+ * refreshes the registration and has no further cost. Pages covered by
+ * overlapping registrations remain pinned until all of the registrations
+ * are released.
+ * This is *not* a collective function.
+ *
+ * \param addr   Address of the local buffer.
+ * \param nbytes Size of the local buffer in bytes.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_buffer_register(
+  void            * addr,
+  size_t            nbytes) DART_NOTHROW;
+
+/**
+ * Releases the registration of a local buffer registered in a previous
+ * call of \ref dart_buffer_register. Buffers must be deregistered before
+ * they are freed.
+ *
+ * \param addr   Address of the local buffer as passed to
+ *               \ref dart_buffer_register.
+ *
+ * Deregistering a buffer whose registration has already been evicted
+ * from the registration cache has no effect.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_buffer_deregister(
+  void            * addr) DART_NOTHROW;
+
+/**
+ * Allocates a local buffer of \c nbytes bytes for use as origin or
+ * destination of one-sided transfers. The buffer is obtained from memory
+ * that is registered with the communication backend and remains
+ * registered until it is freed using \ref dart_buffer_free.
+ * This is *not* a collective function.
+ *
+ * \param nbytes     Size of the buffer in bytes.
+ * \param[out] addr  Address of the allocated buffer.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_buffer_alloc(
+  size_t            nbytes,
+  void           ** addr) DART_NOTHROW;
+
+/**
+ * Frees a local buffer allocated in a previous call of
+ * \ref dart_buffer_alloc.
+ *
+ * \param addr  Address of the buffer.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_buffer_free(
+  void            * addr) DART_NOTHROW;
+
 /**
  * Collective function on the specified team to allocate \c nelem elements
  * of type \c dtype of memory in each unit's global address space with a
@@ -348,6 +430,44 @@ dart_ret_t dart_team_memalloc_aligned(
 dart_ret_t dart_team_memfree(
   dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Collective function on the specified team to allocate \c nelem elements
+ * of type \c dtype in each unit's global address space, backed by a
+ * memory-mapped file instead of anonymous memory.
+ * Semantics are identical to \ref dart_team_memalloc_aligned.
+ *
+ * Every unit creates a file in the directory \c path, e.g. on a local
+ * NVMe device, a tmpfs or a DAX-mounted persistent memory file system,
+ * and maps it into its address space. Residency of the allocation is
+ * managed by the operating system's page cache so allocations may exceed
+ * the size of physical memory. RMA operations on the allocation are served
+ * from the mapping.
+ * Files are removed from the file system once all units on the node have
+ * mapped them and are released in \ref dart_team_memfree.
+ *
+ * \param teamid      The team participating in the collective memory
+ *                    allocation.
+ * \param nelem       The number of elements to allocate per unit.
+ * \param dtype       The data type of elements in \c addr.
+ * \param path        Directory in which backing files are created.
+ *
+ * \param[out]  gptr  Global pointer to store information on the allocation.
+ *
+ * \return            \c DART_OK on success,
+ *                    any other of \ref dart_ret_t otherwise.
+ *
+ * \see dart_team_memalloc_aligned
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_team_memalloc_aligned_file(
+  dart_team_t       teamid,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  const char      * path,
+  dart_gptr_t     * gptr) DART_NOTHROW;
+
 /**
  * Collective function similar to \ref dart_team_memalloc_aligned but on
  * previously externally allocated memory.
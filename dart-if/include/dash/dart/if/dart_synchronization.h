@@ -25,6 +25,9 @@ extern "C" {
  * Lock type to ensure mutual exclusion among units in a team.
  * The lock is thread-aware so only one thread of a unit can acquire
  * the lock at once.
+ * Units on the same node acquire the lock in a node-local queue and pass
+ * it among each other for a bounded number of critical sections before it
+ * is handed over to another node.
  * \ingroup DartSync
  */
 typedef struct dart_lock_struct *dart_lock_t;
@@ -109,6 +112,340 @@ dart_ret_t dart_lock_release(
   dart_lock_t   lock)   DART_NOTHROW;
 
 
+/**
+ * Reader-writer lock type allowing concurrent shared access among units
+ * in a team and exclusive access to a single unit.
+ * Writers are preferred: units waiting for exclusive access block new
+ * readers.
+ * The lock is thread-aware so only one thread of a unit can acquire
+ * the lock at once.
+ * \ingroup DartSync
+ */
+typedef struct dart_rwlock_struct *dart_rwlock_t;
+
+/**
+ * Collective operation to initialize the reader-writer lock \c rwlock.
+ *
+ * \param teamid Team this lock is used for.
+ * \param rwlock The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_init(
+  dart_team_t     teamid,
+  dart_rwlock_t * rwlock) DART_NOTHROW;
+
+/**
+ * Collective operation to destroy a reader-writer lock initialized using
+ * \ref dart_team_rwlock_init.
+ *
+ * \param rwlock The lock to free.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_destroy(
+  dart_rwlock_t * rwlock) DART_NOTHROW;
+
+/**
+ * Block until shared access to \c rwlock was acquired.
+ *
+ * \param rwlock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_shared(
+  dart_rwlock_t   rwlock) DART_NOTHROW;
+
+/**
+ * Block until exclusive access to \c rwlock was acquired.
+ *
+ * \param rwlock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_exclusive(
+  dart_rwlock_t   rwlock) DART_NOTHROW;
+
+/**
+ * Try to acquire shared access to \c rwlock and return immediately.
+ *
+ * \param rwlock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_shared(
+  dart_rwlock_t   rwlock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Try to acquire exclusive access to \c rwlock and return immediately.
+ *
+ * \param rwlock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_exclusive(
+  dart_rwlock_t   rwlock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Release shared or exclusive access to \c rwlock.
+ *
+ * \param rwlock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release(
+  dart_rwlock_t   rwlock) DART_NOTHROW;
+
+
+/**
+ * Array of locks sharing a single global memory segment, e.g. to protect
+ * individual buckets of a distributed data structure.
+ * Every lock in the array is thread-aware so only one thread of a unit
+ * can acquire the same lock at once.
+ * \ingroup DartSync
+ */
+typedef struct dart_lock_array_struct *dart_lock_array_t;
+
+/**
+ * Collective operation to initialize an array of \c nlocks locks.
+ *
+ * \param teamid Team the locks are used for.
+ * \param nlocks Number of locks in the array.
+ * \param array  The lock array to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_lock_array_init(
+  dart_team_t         teamid,
+  size_t              nlocks,
+  dart_lock_array_t * array) DART_NOTHROW;
+
+/**
+ * Collective operation to destroy a lock array initialized using
+ * \ref dart_team_lock_array_init.
+ *
+ * \param array  The lock array to free.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_lock_array_destroy(
+  dart_lock_array_t * array) DART_NOTHROW;
+
+/**
+ * Block until the lock at index \c idx in \c array was acquired.
+ *
+ * \param array The lock array.
+ * \param idx   Index of the lock to acquire.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_array_acquire(
+  dart_lock_array_t   array,
+  size_t              idx) DART_NOTHROW;
+
+/**
+ * Try to acquire the lock at index \c idx in \c array and return
+ * immediately.
+ *
+ * \param array The lock array.
+ * \param idx   Index of the lock to acquire.
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_array_try_acquire(
+  dart_lock_array_t   array,
+  size_t              idx,
+  int32_t           * result) DART_NOTHROW;
+
+/**
+ * Release the lock at index \c idx in \c array acquired through
+ * \ref dart_lock_array_acquire or \ref dart_lock_array_try_acquire.
+ *
+ * \param array The lock array.
+ * \param idx   Index of the lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_array_release(
+  dart_lock_array_t   array,
+  size_t              idx) DART_NOTHROW;
+
+/**
+ * Number of locks in \c array.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+size_t dart_lock_array_size(
+  dart_lock_array_t   array) DART_NOTHROW;
+
+/**
+ * Event counters for point-to-point synchronization of units in a team.
+ * Every unit holds a counter of events posted to it by any unit in the
+ * team. Units waiting for events in \ref dart_event_wait block until
+ * notified by a poster instead of polling their counter.
+ * \ingroup DartSync
+ */
+typedef struct dart_event_struct *dart_event_t;
+
+/**
+ * Collective operation to initialize an event with zero-valued counters
+ * at all units in the team.
+ *
+ * \param teamid Team the event is used for.
+ * \param event  The event to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_event_init(
+  dart_team_t    teamid,
+  dart_event_t * event) DART_NOTHROW;
+
+/**
+ * Collective operation to destroy an event initialized using
+ * \ref dart_team_event_init.
+ *
+ * \param event  The event to free.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_event_destroy(
+  dart_event_t * event) DART_NOTHROW;
+
+/**
+ * Post \c count events to \c unit and notify the unit if it is waiting.
+ * Posting multiple events at once requires a single atomic update and
+ * notification.
+ *
+ * \param event The event.
+ * \param unit  The unit to post the events to.
+ * \param count Number of events to post.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_event_post(
+  dart_event_t      event,
+  dart_team_unit_t  unit,
+  int32_t           count) DART_NOTHROW;
+
+/**
+ * Block until \c count events have been posted to the calling unit and
+ * consume them.
+ * The calling unit does not poll its counter but blocks in the
+ * communication library until notified.
+ *
+ * \param event The event.
+ * \param count Number of events to wait for.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_event_wait(
+  dart_event_t      event,
+  int32_t           count) DART_NOTHROW;
+
+/**
+ * Wait until \c count events have been posted to the calling unit or
+ * \c timeout_us microseconds have passed.
+ * Events are only consumed if \c count events have been posted.
+ * As MPI does not provide a receive with timeout, this function does not
+ * block but probes for notifications with an increasing sleep interval of
+ * at most one millisecond.
+ *
+ * \param event The event.
+ * \param count Number of events to wait for.
+ * \param timeout_us Timeout in microseconds.
+ * \param[out] is_signaled \c True if \c count events have been consumed,
+ *             false if the timeout expired.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_event_timedwait(
+  dart_event_t      event,
+  int32_t           count,
+  uint64_t          timeout_us,
+  int32_t         * is_signaled) DART_NOTHROW;
+
+/**
+ * Number of events posted to \c unit and not consumed yet.
+ *
+ * \param event The event.
+ * \param unit  The unit holding the counter.
+ * \param[out] count The number of pending events.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_event_test(
+  dart_event_t      event,
+  dart_team_unit_t  unit,
+  int32_t         * count) DART_NOTHROW;
+
+/**
+ * Synchronize the calling unit with the units in \c units.
+ * Returns once every unit in \c units has called \c dart_sync_units with
+ * the calling unit in its set as often as the calling unit did with it.
+ * Units not contained in \c units are not involved, synchronizing with
+ * \c n units requires \c n atomic updates and waiting on local counters.
+ *
+ * \param units  Global ids of the units to synchronize with, the calling
+ *               unit may be contained. Must not contain duplicates.
+ * \param nunits Number of units in \c units.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_sync_units(
+  const dart_global_unit_t * units,
+  size_t                     nunits) DART_NOTHROW;
+
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
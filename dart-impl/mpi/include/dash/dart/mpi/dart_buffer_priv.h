@@ -0,0 +1,24 @@
+#ifndef DART__MPI__DART_BUFFER_PRIV_H__
+#define DART__MPI__DART_BUFFER_PRIV_H__
+
+#include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_types.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Default maximum number of entries in the local buffer registration
+ * cache, can be overridden in environment variable
+ * \c DART_BUFFER_CACHE_SIZE.
+ */
+#define DART_BUFFER_CACHE_SIZE_DEFAULT 64
+
+/**
+ * Releases all registrations and frees buffers allocated with
+ * \c dart_buffer_alloc that have not been freed.
+ */
+dart_ret_t
+dart__mpi__buffer_fini() DART_INTERNAL;
+
+#endif /* DART__MPI__DART_BUFFER_PRIV_H__ */
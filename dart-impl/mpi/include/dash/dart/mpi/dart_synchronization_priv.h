@@ -0,0 +1,22 @@
+#ifndef DART__MPI__DART_SYNCHRONIZATION_PRIV_H__
+#define DART__MPI__DART_SYNCHRONIZATION_PRIV_H__
+
+#include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_types.h>
+
+/**
+ * Allocates the pairwise synchronization counters used in
+ * \c dart_sync_units.
+ * Collective on \c DART_TEAM_ALL.
+ */
+dart_ret_t
+dart__mpi__sync_init() DART_INTERNAL;
+
+/**
+ * Frees the pairwise synchronization counters.
+ * Collective on \c DART_TEAM_ALL.
+ */
+dart_ret_t
+dart__mpi__sync_fini() DART_INTERNAL;
+
+#endif /* DART__MPI__DART_SYNCHRONIZATION_PRIV_H__ */
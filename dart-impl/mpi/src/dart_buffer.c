@@ -0,0 +1,349 @@
+/**
+ * \file dart_buffer.c
+ *
+ * Registration cache of local buffers used as origin or target of
+ * one-sided transfers.
+ *
+ * Registering a buffer pins its pages in physical memory so repeated
+ * transfers from and into the buffer do not page-fault.
+ * MPI does not provide an interface to pass registrations to transfers,
+ * the DART transfer functions do not consult this cache. Registration of
+ * pinned memory with the network is left to the MPI implementation.
+ * Buffers allocated with \c dart_buffer_alloc are obtained from
+ * \c MPI_Alloc_mem which returns memory that is pre-registered with the
+ * network on most MPI implementations.
+ *
+ * The number of registered user buffers is limited, the least recently
+ * used registration is released when the cache is full. Allocated
+ * buffers are never evicted, the cache grows if it only contains
+ * allocated buffers.
+ * Pages are locked while they are covered by at least one pinned
+ * registration, overlapping registrations do not unlock each other's
+ * pages.
+ */
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <dash/dart/mpi/dart_buffer_priv.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <mpi.h>
+
+typedef struct {
+  char     * addr;
+  size_t     nbytes;
+  /* Tick of last registration or lookup, 0 for unused entries */
+  uint64_t   last_use;
+  /* Whether pages have been locked in physical memory */
+  bool       pinned;
+  /* Whether memory has been allocated in dart_buffer_alloc */
+  bool       owned;
+} dart_buffer_entry_t;
+
+static dart_mutex_t          buffer_mutex   = DART_MUTEX_INITIALIZER;
+static dart_buffer_entry_t * buffer_cache   = NULL;
+static int                   buffer_nslots  = 0;
+static size_t                buffer_pagesize = 0;
+static uint64_t              buffer_tick    = 0;
+
+static dart_ret_t buffer_cache_init()
+{
+  if (buffer_cache != NULL) {
+    return DART_OK;
+  }
+  buffer_nslots = DART_BUFFER_CACHE_SIZE_DEFAULT;
+  const char * env = getenv("DART_BUFFER_CACHE_SIZE");
+  if (env != NULL && atoi(env) > 0) {
+    buffer_nslots = atoi(env);
+  }
+  buffer_cache = calloc(buffer_nslots, sizeof(dart_buffer_entry_t));
+  if (buffer_cache == NULL) {
+    buffer_nslots = 0;
+    return DART_ERR_OTHER;
+  }
+  long pagesize   = sysconf(_SC_PAGESIZE);
+  buffer_pagesize = (pagesize > 0) ? (size_t)pagesize : 4096;
+  DART_LOG_DEBUG("dart_buffer: registration cache with %d entries",
+                 buffer_nslots);
+  return DART_OK;
+}
+
+static uintptr_t buffer_page_begin(const dart_buffer_entry_t * entry)
+{
+  return (uintptr_t)entry->addr & ~(uintptr_t)(buffer_pagesize - 1);
+}
+
+static uintptr_t buffer_page_end(const dart_buffer_entry_t * entry)
+{
+  return ((uintptr_t)entry->addr + entry->nbytes + buffer_pagesize - 1) &
+         ~(uintptr_t)(buffer_pagesize - 1);
+}
+
+/*
+ * Unlocks the pages of the entry that are not covered by any other
+ * pinned entry. Pages are locked as long as their number of covering
+ * pinned entries is non-zero.
+ */
+static void buffer_entry_unpin(const dart_buffer_entry_t * entry)
+{
+  uintptr_t page     = buffer_page_begin(entry);
+  uintptr_t page_end = buffer_page_end(entry);
+  while (page < page_end) {
+    /* End of the pages covered by other pinned entries that contain the
+     * current page, and start of the next covered pages otherwise: */
+    uintptr_t covered_end = page;
+    uintptr_t next_start  = page_end;
+    for (int i = 0; i < buffer_nslots; ++i) {
+      const dart_buffer_entry_t * other = &buffer_cache[i];
+      if (other == entry || other->last_use == 0 || !other->pinned) {
+        continue;
+      }
+      uintptr_t o_begin = buffer_page_begin(other);
+      uintptr_t o_end   = buffer_page_end(other);
+      if (o_begin <= page && page < o_end) {
+        if (o_end > covered_end) {
+          covered_end = o_end;
+        }
+      } else if (o_begin > page && o_begin < next_start) {
+        next_start = o_begin;
+      }
+    }
+    if (covered_end > page) {
+      page = covered_end;
+    } else {
+      munlock((void *)page, next_start - page);
+      page = next_start;
+    }
+  }
+}
+
+static void buffer_entry_release(dart_buffer_entry_t * entry)
+{
+  if (entry->pinned) {
+    buffer_entry_unpin(entry);
+  }
+  if (entry->owned) {
+    MPI_Free_mem(entry->addr);
+  }
+  entry->addr     = NULL;
+  entry->nbytes   = 0;
+  entry->last_use = 0;
+  entry->pinned   = false;
+  entry->owned    = false;
+}
+
+/*
+ * Finds the entry containing the range [addr, addr + nbytes) or, if
+ * \c exact is set, the entry starting at addr.
+ */
+static dart_buffer_entry_t * buffer_cache_find(
+  const char * addr,
+  size_t       nbytes,
+  bool         exact)
+{
+  for (int i = 0; i < buffer_nslots; ++i) {
+    dart_buffer_entry_t * entry = &buffer_cache[i];
+    if (entry->last_use == 0) {
+      continue;
+    }
+    if (exact) {
+      if (entry->addr == addr) {
+        return entry;
+      }
+    } else if (entry->addr <= addr &&
+               addr + nbytes <= entry->addr + entry->nbytes) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+/*
+ * Returns an unused entry, evicting the least recently used user buffer
+ * registration if the cache is full. Buffers allocated in
+ * dart_buffer_alloc are never evicted, the cache is enlarged if it
+ * contains no user buffer registration.
+ */
+static dart_buffer_entry_t * buffer_cache_slot()
+{
+  dart_buffer_entry_t * lru = NULL;
+  for (int i = 0; i < buffer_nslots; ++i) {
+    dart_buffer_entry_t * entry = &buffer_cache[i];
+    if (entry->last_use == 0) {
+      return entry;
+    }
+    if (!entry->owned &&
+        (lru == NULL || entry->last_use < lru->last_use)) {
+      lru = entry;
+    }
+  }
+  if (lru != NULL) {
+    DART_LOG_TRACE("dart_buffer: evicting registration addr:%p nbytes:%zu",
+                   (void*)lru->addr, lru->nbytes);
+    buffer_entry_release(lru);
+    return lru;
+  }
+  int nslots = 2 * buffer_nslots;
+  dart_buffer_entry_t * cache = realloc(buffer_cache,
+                                        nslots * sizeof(dart_buffer_entry_t));
+  if (cache == NULL) {
+    return NULL;
+  }
+  memset(cache + buffer_nslots, 0,
+         (nslots - buffer_nslots) * sizeof(dart_buffer_entry_t));
+  DART_LOG_DEBUG("dart_buffer: registration cache enlarged to %d entries",
+                 nslots);
+  dart_buffer_entry_t * entry = &cache[buffer_nslots];
+  buffer_cache  = cache;
+  buffer_nslots = nslots;
+  return entry;
+}
+
+static dart_ret_t buffer_cache_insert(
+  char   * addr,
+  size_t   nbytes,
+  bool     owned)
+{
+  dart_buffer_entry_t * entry = buffer_cache_slot();
+  if (entry == NULL) {
+    DART_LOG_ERROR("dart_buffer: failed to enlarge registration cache");
+    return DART_ERR_OTHER;
+  }
+  entry->addr     = addr;
+  entry->nbytes   = nbytes;
+  entry->owned    = owned;
+  entry->last_use = ++buffer_tick;
+  /* Locking pages may fail due to RLIMIT_MEMLOCK, the registration is
+   * still recorded as the buffer is likely to be registered with the
+   * network transport on first use anyways */
+  entry->pinned   = (nbytes > 0 && mlock(addr, nbytes) == 0);
+  if (!entry->pinned) {
+    DART_LOG_DEBUG("dart_buffer: could not pin addr:%p nbytes:%zu",
+                   (void*)addr, nbytes);
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_buffer_register(
+  void   * addr,
+  size_t   nbytes)
+{
+  if (addr == NULL) {
+    DART_LOG_ERROR("dart_buffer_register: invalid address");
+    return DART_ERR_INVAL;
+  }
+  dart_ret_t ret = DART_OK;
+  dart__base__mutex_lock(&buffer_mutex);
+  ret = buffer_cache_init();
+  if (ret == DART_OK) {
+    dart_buffer_entry_t * entry = buffer_cache_find(addr, nbytes, false);
+    if (entry != NULL) {
+      /* Cache hit, buffer is already registered */
+      entry->last_use = ++buffer_tick;
+    } else {
+      entry = buffer_cache_find(addr, 0, true);
+      if (entry != NULL && !entry->owned) {
+        /* Registered buffer has grown, register again */
+        buffer_entry_release(entry);
+      }
+      ret = buffer_cache_insert(addr, nbytes, false);
+    }
+  }
+  dart__base__mutex_unlock(&buffer_mutex);
+  DART_LOG_TRACE("dart_buffer_register: addr:%p nbytes:%zu", addr, nbytes);
+  return ret;
+}
+
+dart_ret_t dart_buffer_deregister(
+  void * addr)
+{
+  dart__base__mutex_lock(&buffer_mutex);
+  dart_buffer_entry_t * entry = (buffer_cache == NULL)
+                                ? NULL
+                                : buffer_cache_find(addr, 0, true);
+  if (entry != NULL && !entry->owned) {
+    buffer_entry_release(entry);
+  }
+  dart__base__mutex_unlock(&buffer_mutex);
+  if (entry == NULL) {
+    /* Registration has been evicted from the cache */
+    DART_LOG_TRACE("dart_buffer_deregister: no registration at addr:%p",
+                   addr);
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_buffer_alloc(
+  size_t   nbytes,
+  void  ** addr)
+{
+  *addr = NULL;
+  void * mem;
+  if (MPI_Alloc_mem((nbytes > 0) ? nbytes : 1, MPI_INFO_NULL, &mem)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_buffer_alloc: MPI_Alloc_mem failed for %zu bytes",
+                   nbytes);
+    return DART_ERR_OTHER;
+  }
+  dart__base__mutex_lock(&buffer_mutex);
+  dart_ret_t ret = buffer_cache_init();
+  if (ret == DART_OK) {
+    ret = buffer_cache_insert(mem, nbytes, true);
+  }
+  dart__base__mutex_unlock(&buffer_mutex);
+  if (ret != DART_OK) {
+    MPI_Free_mem(mem);
+    return ret;
+  }
+  *addr = mem;
+  DART_LOG_DEBUG("dart_buffer_alloc: addr:%p nbytes:%zu", mem, nbytes);
+  return DART_OK;
+}
+
+dart_ret_t dart_buffer_free(
+  void * addr)
+{
+  if (addr == NULL) {
+    return DART_OK;
+  }
+  dart_ret_t ret = DART_OK;
+  dart__base__mutex_lock(&buffer_mutex);
+  dart_buffer_entry_t * entry = (buffer_cache == NULL)
+                                ? NULL
+                                : buffer_cache_find(addr, 0, true);
+  if (entry == NULL || !entry->owned) {
+    ret = DART_ERR_INVAL;
+  } else {
+    buffer_entry_release(entry);
+  }
+  dart__base__mutex_unlock(&buffer_mutex);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_buffer_free: addr:%p has not been allocated in "
+                   "dart_buffer_alloc", addr);
+  }
+  return ret;
+}
+
+dart_ret_t dart__mpi__buffer_fini()
+{
+  dart__base__mutex_lock(&buffer_mutex);
+  for (int i = 0; i < buffer_nslots; ++i) {
+    if (buffer_cache[i].last_use != 0) {
+      buffer_entry_release(&buffer_cache[i]);
+    }
+  }
+  free(buffer_cache);
+  buffer_cache  = NULL;
+  buffer_nslots = 0;
+  buffer_tick   = 0;
+  dart__base__mutex_unlock(&buffer_mutex);
+  return DART_OK;
+}
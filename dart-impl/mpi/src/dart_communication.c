@@ -2181,6 +2181,9 @@ dart_ret_t dart_allreduce(
     return DART_ERR_INVAL;
   }
   MPI_Comm comm = team_data->comm;
+  if (sendbuf == recvbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
   CHECK_MPI_RET(
     MPI_Allreduce(
            sendbuf,   // send buffer
@@ -2223,6 +2226,14 @@ dart_ret_t dart_reduce(
   CHECK_UNITID_RANGE(root, team_data);
 
   comm = team_data->comm;
+  if (sendbuf == recvbuf) {
+    if (team_data->unitid == root.id) {
+      sendbuf = MPI_IN_PLACE;
+    } else {
+      // receive buffer is only significant at root
+      recvbuf = NULL;
+    }
+  }
   CHECK_MPI_RET(
     MPI_Reduce(
            sendbuf,
@@ -23,6 +23,11 @@
 #include <dash/dart/mpi/dart_globmem_priv.h>
 
 #include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include <mpi.h>
 
 /* For PRIu64, uint64_t in printf */
@@ -34,6 +39,11 @@
  */
 MPI_Win dart_win_local_alloc;
 
+/**
+ * Maximum length of paths of files backing file-mapped segments.
+ */
+#define DART_FILEMEM_PATH_MAX 256
+
 dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
 {
   int16_t segid = gptr.segid;
@@ -351,6 +361,7 @@ dart_team_memalloc_aligned_dynamic(
   segment->win     = team_data->window;
   segment->selfbaseptr = sub_mem;
   segment->is_dynamic  = true;
+  segment->is_filemapped = false;
 
 
   /* -- Updating infos on gptr -- */
@@ -429,6 +440,7 @@ dart_team_memalloc_aligned_full(
   segment->shmwin      = MPI_WIN_NULL;
   segment->win         = win;
   segment->is_dynamic  = false;
+  segment->is_filemapped = false;
 
 
   gptr->segid  = segment->segid;
@@ -455,6 +467,238 @@ dart_team_memalloc_aligned(
 #endif
 }
 
+/**
+ * Maps \c nbytes of the file at \c filename into memory.
+ *
+ * \return  Base address of the mapping, or NULL on failure.
+ */
+static char *
+dart__mpi__filemem_map(
+  const char * filename,
+  size_t       nbytes)
+{
+  int fd = open(filename, O_RDWR);
+  if (fd < 0) {
+    DART_LOG_ERROR("dart__mpi__filemem_map: open(%s) failed: %s",
+                   filename, strerror(errno));
+    return NULL;
+  }
+  void * addr = mmap(NULL, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    DART_LOG_ERROR("dart__mpi__filemem_map: mmap(%s, %zu) failed: %s",
+                   filename, nbytes, strerror(errno));
+    return NULL;
+  }
+  return (char *)addr;
+}
+
+/**
+ * Creates a file of \c nbytes in directory \c path and maps it into
+ * memory. The path of the file is written to \c filename.
+ *
+ * \return  Base address of the mapping, or NULL on failure.
+ */
+static char *
+dart__mpi__filemem_create(
+  const char * path,
+  size_t       nbytes,
+  char       * filename)
+{
+  int fd = -1;
+  if (snprintf(filename, DART_FILEMEM_PATH_MAX, "%s/dart-mem-XXXXXX", path)
+      < DART_FILEMEM_PATH_MAX) {
+    fd = mkstemp(filename);
+  }
+  if (fd < 0) {
+    DART_LOG_ERROR("dart__mpi__filemem_create: "
+                   "cannot create file in %s", path);
+    filename[0] = '\0';
+    return NULL;
+  }
+  int ret = ftruncate(fd, nbytes);
+  close(fd);
+  if (ret != 0) {
+    DART_LOG_ERROR("dart__mpi__filemem_create: "
+                   "ftruncate(%s, %zu) failed: %s",
+                   filename, nbytes, strerror(errno));
+    return NULL;
+  }
+  return dart__mpi__filemem_map(filename, nbytes);
+}
+
+/**
+ * Unmaps the local and node-local mappings of a file-mapped segment.
+ */
+static void
+dart__mpi__filemem_unmap(
+  const dart_team_data_t * team_data,
+  dart_segment_info_t    * segment,
+  size_t                   nbytes)
+{
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (segment->baseptr != NULL) {
+    int i;
+    for (i = 0; i < team_data->sharedmem_nodesize; i++) {
+      if (segment->baseptr[i] != NULL &&
+          segment->baseptr[i] != segment->selfbaseptr) {
+        munmap(segment->baseptr[i], nbytes);
+      }
+      segment->baseptr[i] = NULL;
+    }
+  }
+#else
+  (void)(team_data);
+#endif
+  if (segment->selfbaseptr != NULL) {
+    munmap(segment->selfbaseptr, nbytes);
+    segment->selfbaseptr = NULL;
+  }
+}
+
+dart_ret_t
+dart_team_memalloc_aligned_file(
+  dart_team_t       teamid,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  const char      * path,
+  dart_gptr_t     * gptr)
+{
+  CHECK_IS_BASICTYPE(dtype);
+  dart_unit_t gptr_unitid = 0; // the team-local ID 0 has the beginning
+  int         dtype_size  = dart__mpi__datatype_sizeof(dtype);
+  size_t      nbytes      = nelem * dtype_size;
+  // mmap does not accept empty mappings:
+  size_t      mapbytes    = (nbytes > 0) ? nbytes : 1;
+  size_t      team_size;
+  char        filename[DART_FILEMEM_PATH_MAX];
+  int         success;
+  int         all_success;
+
+  *gptr = DART_GPTR_NULL;
+
+  if (path == NULL) {
+    DART_LOG_ERROR("dart_team_memalloc_aligned_file ! path is NULL");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR(
+        "dart_team_memalloc_aligned_file ! Unknown team %i", teamid);
+    return DART_ERR_INVAL;
+  }
+  dart_team_size(teamid, &team_size);
+
+  DART_LOG_TRACE("dart_team_memalloc_aligned_file : "
+                 "dts:%i nelem:%zu nbytes:%zu path:%s",
+                 dtype_size, nelem, nbytes, path);
+
+  MPI_Comm comm = team_data->comm;
+
+  dart_segment_info_t *segment = dart_segment_alloc(
+                                &team_data->segdata, DART_SEGMENT_ALLOC);
+  if (segment == NULL) {
+    DART_LOG_ERROR(
+        "dart_team_memalloc_aligned_file: "
+        "bytes:%zu Allocation of segment data failed", nbytes);
+    return DART_ERR_OTHER;
+  }
+
+  segment->selfbaseptr = dart__mpi__filemem_create(path, mapbytes, filename);
+  success = (segment->selfbaseptr != NULL);
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  /* Map the files of all units on the same node to serve RMA between units
+   * on the node from the mappings */
+  MPI_Comm sharedmem_comm = team_data->sharedmem_comm;
+  if (sharedmem_comm != MPI_COMM_NULL) {
+    int    sharedmem_unitid;
+    int    i;
+    char * filenames = malloc(
+                         team_data->sharedmem_nodesize * DART_FILEMEM_PATH_MAX);
+    MPI_Comm_rank(sharedmem_comm, &sharedmem_unitid);
+    MPI_Allgather(filename,  DART_FILEMEM_PATH_MAX, MPI_CHAR,
+                  filenames, DART_FILEMEM_PATH_MAX, MPI_CHAR,
+                  sharedmem_comm);
+    // re-use previously allocated memory
+    if (segment->baseptr == NULL) {
+      segment->baseptr = calloc(team_data->sharedmem_nodesize,
+                                sizeof(char *));
+    }
+    for (i = 0; i < team_data->sharedmem_nodesize; i++) {
+      const char * unit_filename = filenames + i * DART_FILEMEM_PATH_MAX;
+      if (i == sharedmem_unitid) {
+        segment->baseptr[i] = segment->selfbaseptr;
+      } else if (unit_filename[0] != '\0') {
+        segment->baseptr[i] = dart__mpi__filemem_map(unit_filename, mapbytes);
+      } else {
+        segment->baseptr[i] = NULL;
+      }
+      success = success && (segment->baseptr[i] != NULL);
+    }
+    free(filenames);
+    // Files must not be removed before all units on the node mapped them:
+    MPI_Barrier(sharedmem_comm);
+  }
+#endif
+  if (filename[0] != '\0') {
+    unlink(filename);
+  }
+
+  // Allocation has to succeed on all units in the team:
+  MPI_Allreduce(&success, &all_success, 1, MPI_INT, MPI_LAND, comm);
+  if (!all_success) {
+    DART_LOG_ERROR("dart_team_memalloc_aligned_file: "
+                   "file mapping failed on at least one unit");
+    dart__mpi__filemem_unmap(team_data, segment, mapbytes);
+    dart_segment_free(&team_data->segdata, segment->segid);
+    return DART_ERR_OTHER;
+  }
+
+  MPI_Aint disp = 0;
+  /* Calling MPI_Win_attach with nbytes == 0 leads to errors, see #239 */
+  if (nbytes > 0) {
+    if (MPI_Win_attach(
+          team_data->window, segment->selfbaseptr, nbytes) != MPI_SUCCESS) {
+      DART_LOG_ERROR(
+        "dart_team_memalloc_aligned_file: bytes:%zu MPI_Win_attach failed",
+        nbytes);
+      dart__mpi__filemem_unmap(team_data, segment, mapbytes);
+      dart_segment_free(&team_data->segdata, segment->segid);
+      return DART_ERR_OTHER;
+    }
+    MPI_Get_address(segment->selfbaseptr, &disp);
+  }
+
+  // re-use previously allocated memory
+  if (segment->disp == NULL) {
+    segment->disp = malloc(team_size * sizeof(MPI_Aint));
+  }
+  MPI_Allgather(&disp, 1, MPI_AINT, segment->disp, 1, MPI_AINT, comm);
+
+  segment->size          = nbytes;
+  segment->flags         = 0;
+  segment->shmwin        = MPI_WIN_NULL;
+  segment->win           = team_data->window;
+  segment->is_dynamic    = true;
+  segment->is_filemapped = true;
+
+  gptr->segid  = segment->segid;
+  gptr->unitid = gptr_unitid;
+  gptr->teamid = teamid;
+  gptr->flags  = 0;
+  gptr->addr_or_offs.offset = 0;
+
+  DART_LOG_DEBUG(
+    "dart_team_memalloc_aligned_file: bytes:%zu gptr_unitid:%d "
+    "baseptr:%p segid:%i across team %d",
+    nbytes, gptr_unitid, segment->selfbaseptr, segment->segid, teamid);
+
+  return DART_OK;
+}
+
 dart_ret_t dart_team_memfree(
   dart_gptr_t gptr)
 {
@@ -481,7 +725,14 @@ dart_ret_t dart_team_memfree(
     return DART_ERR_INVAL;
   }
 
-  if (seginfo->is_dynamic) {
+  if (seginfo->is_filemapped) {
+    if (seginfo->size > 0) {
+      MPI_Win_detach(team_data->window, seginfo->selfbaseptr);
+    }
+    dart__mpi__filemem_unmap(
+      team_data, seginfo, (seginfo->size > 0) ? seginfo->size : 1);
+    seginfo->is_filemapped = false;
+  } else if (seginfo->is_dynamic) {
     MPI_Win win = team_data->window;
     if (dart_segment_get_selfbaseptr(
           &team_data->segdata, segid, &sub_mem) != DART_OK) {
@@ -654,14 +905,18 @@ dart_team_memregister(
   MPI_Aint * disp_set = segment->disp;
   MPI_Comm   comm     = team_data->comm;
   MPI_Win    win      = team_data->window;
-  MPI_Win_attach(win, addr, nbytes);
+  if (nbytes > 0) {
+    MPI_Win_attach(win, addr, nbytes);
+  }
   MPI_Get_address(addr, &disp);
   MPI_Allgather(&disp, 1, MPI_AINT, disp_set, 1, MPI_AINT, comm);
 
   segment->size   = nbytes;
   segment->shmwin = MPI_WIN_NULL;
   segment->win    = team_data->window;
-  segment->selfbaseptr = (char *)addr;
+  // Empty regions are not attached to the window and must not be
+  // detached in dart_team_memderegister:
+  segment->selfbaseptr = (nbytes > 0) ? (char *)addr : NULL;
   segment->flags = 0;
 
 
@@ -710,7 +965,9 @@ dart_team_memderegister(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win_detach(win, sub_mem);
+  if (sub_mem != NULL) {
+    MPI_Win_detach(win, sub_mem);
+  }
   if (dart_segment_free(&team_data->segdata, segid) != DART_OK) {
     return DART_ERR_INVAL;
   }
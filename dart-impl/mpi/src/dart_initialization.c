@@ -19,6 +19,8 @@
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_buffer_priv.h>
+#include <dash/dart/mpi/dart_synchronization_priv.h>
 
 #define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
 
@@ -186,6 +188,11 @@ dart_ret_t do_init()
    * collective allocation function through win. */
   MPI_Win_lock_all(0, win);
 
+  ret = dart__mpi__sync_init();
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
   _dart_initialized = 1;
@@ -291,6 +298,8 @@ dart_ret_t dart_exit()
 
   dart_segment_info_t *seginfo = dart_segment_get_info(&team_data->segdata, 0);
 
+  dart__mpi__sync_fini();
+
   if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
     DART_LOG_ERROR("%2d: dart_exit: MPI_Win_unlock_all failed", unitid.id);
     return DART_ERR_OTHER;
@@ -328,6 +337,8 @@ dart_ret_t dart_exit()
 
   dart__mpi__datatype_fini();
 
+  dart__mpi__buffer_fini();
+
   if (_init_by_dart) {
     DART_LOG_DEBUG("%2d: dart_exit: MPI_Finalize", unitid.id);
     MPI_Finalize();
@@ -18,23 +18,72 @@
 #include <dash/dart/mpi/dart_mem.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_synchronization_priv.h>
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <malloc.h>
+#include <time.h>
 
 
+/*
+ * Locks are implemented as cohort locks: units located on the same node
+ * form a cohort and queue in a node-local MCS lock using shared-memory
+ * atomics. The unit at the head of the node-local queue competes for a
+ * global MCS lock on behalf of its cohort which is then passed between
+ * units of the cohort for up to DART_LOCK_COHORT_MAX_PASSES consecutive
+ * critical sections before it is handed to the next node.
+ *
+ * Waiting units spin on their own queue node: node-local waiters on their
+ * slot in shared memory, the cohort competing for the global lock on the
+ * slot of the node leader. Only handoffs of the global lock and enqueueing
+ * at the global tail on team unit 0 require communication between nodes.
+ *
+ * Shared-memory atomics use the compiler's __atomic builtins which do not
+ * depend on thread support being enabled.
+ * If shared windows are not available, every unit forms a cohort on its
+ * own and the lock degenerates to a plain MCS lock.
+ */
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+#define DART_LOCK_USE_COHORTS
+#endif
+
+/** Number of int32 slots per unit, two cache lines */
+#define DART_LOCK_NSLOTS             32
+/** Successor cohort in the global queue, accessed with MPI atomics */
+#define DART_LOCK_SLOT_GNEXT          0
+/** Whether the cohort is waiting for the global lock, MPI atomics */
+#define DART_LOCK_SLOT_GWAIT          1
+/** Successor unit in the node-local queue, shared-memory atomics */
+#define DART_LOCK_SLOT_LNEXT          2
+/** State of the unit in the node-local queue, shared-memory atomics */
+#define DART_LOCK_SLOT_LSTATE         3
+/** Tail of the node-local queue, only used in the node leader's slots */
+#define DART_LOCK_SLOT_LTAIL         16
+/** Number of consecutive handoffs in the cohort, node leader only */
+#define DART_LOCK_SLOT_LPASSES       17
+
+/** Maximum number of handoffs within a cohort, bounds unfairness */
+#define DART_LOCK_COHORT_MAX_PASSES  64
+
+/* States of a unit in the node-local queue */
+#define DART_LOCK_WAITING             0
+#define DART_LOCK_ACQUIRE_GLOBAL      1
+#define DART_LOCK_GLOBAL_HELD         2
+
 struct dart_lock_struct
 {
   /**
-   * Global memory storing the unit at the tail of lock queue.
+   * Global memory storing the cohort at the tail of the global lock queue.
    * Stored in team-unit 0 by default.
    */
   dart_gptr_t  gptr_tail;
   /**
-   * Pointer to the current unit's successor in the waiting list,
-   * to which we send a release message.
+   * Team-aligned memory holding every unit's queue node, see
+   * DART_LOCK_SLOT_*.
    */
   dart_gptr_t  gptr_list;
   /**
@@ -44,8 +93,214 @@ struct dart_lock_struct
   dart_team_t teamid;
   /** Whether this unit has acquired the lock. */
   int32_t is_acquired;
+  /** Team-unit ID of the node leader, identifies the cohort. */
+  int32_t leader;
+  /** Rank of this unit in the cohort. */
+  int32_t lrank;
+  /** Local addresses of the queue nodes of all units in the cohort. */
+  int32_t ** node_slots;
 };
 
+static inline int32_t lock_load32(int32_t * ptr)
+{
+  return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+}
+
+static inline int32_t lock_swap32(int32_t * ptr, int32_t val)
+{
+  return __atomic_exchange_n(ptr, val, __ATOMIC_SEQ_CST);
+}
+
+/* Returns the previous value, the swap succeeded if it equals expected */
+static inline int32_t lock_cas32(int32_t * ptr, int32_t expected,
+                                 int32_t val)
+{
+  __atomic_compare_exchange_n(ptr, &expected, val, 0,
+                              __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  return expected;
+}
+
+static inline int32_t lock_inc32(int32_t * ptr)
+{
+  return __atomic_fetch_add(ptr, 1, __ATOMIC_SEQ_CST);
+}
+
+/* Trigger progress of passive-target operations while spinning locally */
+static inline void lock_progress(dart_team_data_t * team_data)
+{
+  int flag;
+  MPI_Iprobe(
+    MPI_ANY_SOURCE, MPI_ANY_TAG, team_data->comm, &flag, MPI_STATUS_IGNORE);
+}
+
+static inline MPI_Aint lock_slot_disp(
+  dart_segment_info_t * seginfo,
+  int32_t               unit,
+  int                   slot)
+{
+  return dart_segment_disp(seginfo, DART_TEAM_UNIT_ID(unit))
+         + slot * sizeof(int32_t);
+}
+
+static int32_t lock_rma_replace(
+  int32_t               value,
+  int32_t               unit,
+  int                   slot,
+  dart_segment_info_t * seginfo)
+{
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value, &result, MPI_INT32_T, unit,
+      lock_slot_disp(seginfo, unit, slot), MPI_REPLACE, seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(MPI_Win_flush(unit, seginfo->win), MPI_SUCCESS);
+  return result;
+}
+
+static int32_t lock_rma_cas(
+  int32_t               value,
+  int32_t               compare,
+  int32_t               unit,
+  int                   slot,
+  dart_segment_info_t * seginfo)
+{
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &value, &compare, &result, MPI_INT32_T, unit,
+      lock_slot_disp(seginfo, unit, slot), seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(MPI_Win_flush(unit, seginfo->win), MPI_SUCCESS);
+  return result;
+}
+
+static int32_t lock_rma_fetch(
+  int32_t               unit,
+  int                   slot,
+  dart_segment_info_t * seginfo)
+{
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      NULL, &result, MPI_INT32_T, unit,
+      lock_slot_disp(seginfo, unit, slot), MPI_NO_OP, seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(MPI_Win_flush(unit, seginfo->win), MPI_SUCCESS);
+  return result;
+}
+
+/*
+ * Enqueues the calling unit's cohort in the global MCS queue and waits
+ * until the global lock has been handed to the cohort.
+ */
+static void lock_acquire_global(
+  dart_lock_t           lock,
+  dart_team_data_t    * team_data,
+  dart_segment_info_t * seginfo)
+{
+  int32_t     cohort    = lock->leader;
+  dart_gptr_t gptr_tail = lock->gptr_tail;
+  int32_t     predecessor;
+
+  /* Reset the cohort's queue node, only accessed by the unit holding the
+   * node-local lock */
+  lock_rma_replace(-1, cohort, DART_LOCK_SLOT_GNEXT, seginfo);
+  lock_rma_replace( 1, cohort, DART_LOCK_SLOT_GWAIT, seginfo);
+
+  DART_LOG_TRACE(
+    "dart_lock_acquire: MPI_Fetch_and_op to set tail to cohort %i on "
+    "tail_unit %i with offset %lu",
+    cohort, gptr_tail.unitid, gptr_tail.addr_or_offs.offset);
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &cohort,
+      &predecessor,
+      MPI_INT32_T,
+      gptr_tail.unitid,
+      gptr_tail.addr_or_offs.offset,
+      MPI_REPLACE,
+      dart_win_local_alloc),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(gptr_tail.unitid, dart_win_local_alloc),
+    MPI_SUCCESS);
+
+  DART_LOG_TRACE("dart_lock_acquire: predecessor: %i cohort: %i",
+                 predecessor, cohort);
+
+  if (predecessor != -1) {
+    /* Link into the predecessor's queue node and spin on the cohort's
+     * own queue node until the predecessor hands over the lock */
+    lock_rma_replace(cohort, predecessor, DART_LOCK_SLOT_GNEXT, seginfo);
+    DART_LOG_DEBUG("dart_lock_acquire: waiting for handoff from "
+                   "cohort %d in team %d", predecessor, lock->teamid);
+    while (lock_rma_fetch(cohort, DART_LOCK_SLOT_GWAIT, seginfo) != 0) {
+      lock_progress(team_data);
+    }
+  }
+}
+
+/*
+ * Releases the global lock held by the calling unit's cohort.
+ */
+static void lock_release_global(
+  dart_lock_t           lock,
+  dart_team_data_t    * team_data,
+  dart_segment_info_t * seginfo)
+{
+  int32_t     cohort    = lock->leader;
+  dart_gptr_t gptr_tail = lock->gptr_tail;
+  int32_t     result;
+  int32_t     reset     = -1;
+
+  /* Check if the cohort is at the tail of the global queue and reset the
+   * tail pointer if it is. Otherwise, hand the lock to the successor. */
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &reset,
+      &cohort,
+      &result,
+      MPI_INT32_T,
+      gptr_tail.unitid,
+      gptr_tail.addr_or_offs.offset,
+      dart_win_local_alloc),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(gptr_tail.unitid, dart_win_local_alloc),
+    MPI_SUCCESS);
+
+  if (result != cohort) {
+    int32_t next;
+    DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
+                   "(tail = %d) in team %d", result, lock->teamid);
+    while ((next = lock_rma_fetch(cohort, DART_LOCK_SLOT_GNEXT, seginfo))
+           == -1) {
+      lock_progress(team_data);
+    }
+    DART_LOG_DEBUG("dart_lock_release: handing over to cohort %d "
+                   "in team %d", next, lock->teamid);
+    lock_rma_replace(0, next, DART_LOCK_SLOT_GWAIT, seginfo);
+  }
+}
+
+/*
+ * Waits until the node-local successor of the calling unit has linked
+ * into its queue node and hands the lock over in the given state.
+ */
+static void lock_handoff_local(
+  dart_lock_t           lock,
+  dart_team_data_t    * team_data,
+  int32_t               state)
+{
+  int32_t * mine = lock->node_slots[lock->lrank];
+  int32_t   next;
+  while ((next = lock_load32(&mine[DART_LOCK_SLOT_LNEXT])) == -1) {
+    lock_progress(team_data);
+  }
+  lock_swap32(&lock->node_slots[next][DART_LOCK_SLOT_LSTATE], state);
+}
+
 dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 {
   int ret;
@@ -82,9 +337,9 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   }
 
   /* Create a global memory region across the team.
-   * Every local memory segment holds the next unit
-   * waiting on the lock. */
-  ret = dart_team_memalloc_aligned(teamid, 1, DART_TYPE_INT, &gptr_list);
+   * Every local memory segment holds the queue node of the unit. */
+  ret = dart_team_memalloc_aligned(
+          teamid, DART_LOCK_NSLOTS, DART_TYPE_INT, &gptr_list);
   if (ret != DART_OK) {
     DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
     return ret;
@@ -97,9 +352,36 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
   dart_gptr_setunit(&gptr_list, unitid);
   dart_gptr_getaddr(gptr_list, (void*)&list_ptr);
-  *list_ptr = -1;
+  for (int i = 0; i < DART_LOCK_NSLOTS; ++i) {
+    list_ptr[i] = -1;
+  }
+  list_ptr[DART_LOCK_SLOT_LPASSES] = 0;
   MPI_Win_sync(win);
 
+  *lock = malloc(sizeof(struct dart_lock_struct));
+
+#if defined(DART_LOCK_USE_COHORTS)
+  /* Units in the shared memory group of the node form a cohort */
+  int nodesize          = team_data->sharedmem_nodesize;
+  (*lock)->lrank        = team_data->sharedmem_tab[unitid.id].id;
+  (*lock)->node_slots   = malloc(nodesize * sizeof(int32_t *));
+  for (int i = 0; i < nodesize; ++i) {
+    (*lock)->node_slots[i] = (int32_t *)(list_seginfo->baseptr[i]
+                               + gptr_list.addr_or_offs.offset);
+  }
+  for (int u = 0; u < team_data->size; ++u) {
+    if (team_data->sharedmem_tab[u].id == 0) {
+      (*lock)->leader = u;
+      break;
+    }
+  }
+#else
+  (*lock)->lrank         = 0;
+  (*lock)->leader        = unitid.id;
+  (*lock)->node_slots    = malloc(sizeof(int32_t *));
+  (*lock)->node_slots[0] = list_ptr;
+#endif
+
   // communicate tail pointer
   ret = dart_bcast(
     &gptr_tail,
@@ -109,11 +391,12 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
     teamid);
   if (ret != DART_OK) {
     DART_LOG_ERROR("%s: Failed to broadcast lock information!", __FUNCTION__);
+    free((*lock)->node_slots);
+    free(*lock);
+    *lock = NULL;
     return ret;
   }
 
-
-  *lock = malloc(sizeof(struct dart_lock_struct));
   (*lock)->gptr_tail   = gptr_tail;
   (*lock)->gptr_list   = gptr_list;
   (*lock)->teamid      = teamid;
@@ -122,6 +405,14 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
 
+  /* Queue nodes of node-local units must be initialized before use */
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to synchronize lock initialization!",
+                   __FUNCTION__);
+    return ret;
+  }
+
   DART_LOG_DEBUG("dart_team_lock_init: INIT - done");
 
   return DART_OK;
@@ -146,77 +437,35 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
     DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
     return DART_ERR_INVAL;
   }
+  dart_segment_info_t *list_seginfo = dart_segment_get_info(
+                              &(team_data->segdata), lock->gptr_list.segid);
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
-  dart_unit_t tail_unit   = gptr_tail.unitid;
-
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
-
-  int32_t predecessor;
-
-  /* Fetch the current unit's tail and make this unit the new tail */
-  DART_LOG_TRACE(
-    "dart_lock_acquire: MPI_Fetch_and_op to set tail to unit %i on "
-    "tail_unit %i with offset %lu",
-    unitid.id, tail_unit, tail_offset);
-  DART_ASSERT_RETURNS(
-    MPI_Fetch_and_op(
-      &unitid.id,
-      &predecessor,
-      MPI_INT32_T,
-      tail_unit,
-      tail_offset,
-      MPI_REPLACE,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-      MPI_Win_flush(tail_unit, dart_win_local_alloc),
-      MPI_SUCCESS);
-
-  DART_LOG_TRACE("dart_lock_acquire: predecessor: %i unitid.id: %i",
-    predecessor, unitid.id);
+  int32_t * mine   = lock->node_slots[lock->lrank];
+  int32_t * leader = lock->node_slots[0];
+  int32_t   state  = DART_LOCK_ACQUIRE_GLOBAL;
 
-  /* If there was a previous tail (predecessor), update the previous tail's
-   * next pointer with unitid and wait for notification from its predecessor.
-   */
+  /* Enqueue in the node-local queue */
+  lock_swap32(&mine[DART_LOCK_SLOT_LNEXT],  -1);
+  lock_swap32(&mine[DART_LOCK_SLOT_LSTATE], DART_LOCK_WAITING);
+  int32_t predecessor = lock_swap32(&leader[DART_LOCK_SLOT_LTAIL],
+                                    lock->lrank);
   if (predecessor != -1) {
-    int32_t    result;
-    MPI_Status status;
-    int16_t    seg_id = gptr_list.segid;
-
-    dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                      &(team_data->segdata), gptr_list.segid);
-    MPI_Win  win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(
-                            list_seginfo, DART_TEAM_UNIT_ID(predecessor));
-
-    /* Atomicity: Update its predecessor's next pointer */
-    DART_ASSERT_RETURNS(
-      MPI_Fetch_and_op(
-        &unitid.id,
-        &result,
-        MPI_INT32_T,
-        predecessor,
-        disp_list,
-        MPI_REPLACE,
-        win),
-      MPI_SUCCESS);
-
-    DART_ASSERT_RETURNS(
-      MPI_Win_flush(predecessor, win),
-      DART_OK);
-
-    /* Waiting for notification from its predecessor*/
-    DART_LOG_DEBUG("dart_lock_acquire: waiting for notification from "
-                   "%d in team %d",
-                   predecessor, lock->teamid);
+    /* Link into the predecessor's queue node and spin on the own queue
+     * node until the predecessor hands over the lock */
+    lock_swap32(&lock->node_slots[predecessor][DART_LOCK_SLOT_LNEXT],
+                lock->lrank);
+    DART_LOG_DEBUG("dart_lock_acquire: waiting for node-local handoff "
+                   "in team %d", lock->teamid);
+    while ((state = lock_load32(&mine[DART_LOCK_SLOT_LSTATE]))
+           == DART_LOCK_WAITING) {
+      lock_progress(team_data);
+    }
+  }
 
-    MPI_Recv(NULL, 0, MPI_INT, predecessor, 0, team_data->comm,
-        &status);
+  if (state != DART_LOCK_GLOBAL_HELD) {
+    /* Head of the node-local queue, acquire the lock for the cohort */
+    lock_acquire_global(lock, team_data, list_seginfo);
+    lock_swap32(&leader[DART_LOCK_SLOT_LPASSES], 0);
   }
 
   DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d", lock->teamid);
@@ -241,40 +490,60 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     return DART_ERR_INVAL;
   }
 
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+  dart_segment_info_t *list_seginfo = dart_segment_get_info(
+                              &(team_data->segdata), lock->gptr_list.segid);
 
-  int32_t result;
-  int32_t compare = -1;
+  int32_t * mine   = lock->node_slots[lock->lrank];
+  int32_t * leader = lock->node_slots[0];
+  *is_acquired     = 0;
 
+  /* Claim the node-local lock if it is available */
+  lock_swap32(&mine[DART_LOCK_SLOT_LNEXT], -1);
+  if (lock_cas32(
+        &leader[DART_LOCK_SLOT_LTAIL], -1, lock->lrank) == -1) {
+    int32_t cohort  = lock->leader;
+    int32_t result;
+    int32_t compare = -1;
 
-  dart_gptr_t gptr_tail   = lock->gptr_tail;
-  dart_unit_t tail_unit   = gptr_tail.unitid;
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
+    dart_gptr_t gptr_tail   = lock->gptr_tail;
+    dart_unit_t tail_unit   = gptr_tail.unitid;
+    uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
 
-  /* Atomicity: Check if the lock is available and claim it if it is. */
-  DART_ASSERT_RETURNS(
-    MPI_Compare_and_swap(
-      &unitid.id,
-      &compare,
-      &result,
-      MPI_INT32_T,
-      tail_unit,
-      tail_offset,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-    MPI_Win_flush (tail_unit, dart_win_local_alloc),
-    MPI_SUCCESS);
+    lock_rma_replace(-1, cohort, DART_LOCK_SLOT_GNEXT, list_seginfo);
 
-  /* If the old predecessor was -1, we have claimed the lock,
-   * otherwise, do nothing. */
-  if (result == -1)
-  {
+    /* Atomicity: Check if the lock is available and claim it if it is. */
+    DART_ASSERT_RETURNS(
+      MPI_Compare_and_swap(
+        &cohort,
+        &compare,
+        &result,
+        MPI_INT32_T,
+        tail_unit,
+        tail_offset,
+        dart_win_local_alloc),
+      MPI_SUCCESS);
+    DART_ASSERT_RETURNS(
+      MPI_Win_flush (tail_unit, dart_win_local_alloc),
+      MPI_SUCCESS);
+
+    /* If the old predecessor was -1, we have claimed the lock,
+     * otherwise, release the node-local lock. */
+    if (result == -1) {
+      lock_swap32(&leader[DART_LOCK_SLOT_LPASSES], 0);
+      *is_acquired = 1;
+    } else if (lock_cas32(
+                 &leader[DART_LOCK_SLOT_LTAIL], lock->lrank, -1)
+               != lock->lrank) {
+      /* A node-local unit has been enqueued in the meantime */
+      lock_handoff_local(lock, team_data, DART_LOCK_ACQUIRE_GLOBAL);
+    }
+  }
+
+  if (*is_acquired) {
     lock->is_acquired = 1;
-    *is_acquired = 1;
   } else {
-    *is_acquired = 0;
     /* unlock the local mutex if we have not acqcuired the global lock */
     DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
   }
@@ -292,82 +561,30 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
   DART_ASSERT(team_data != NULL);
+  dart_segment_info_t *list_seginfo = dart_segment_get_info(
+                              &(team_data->segdata), lock->gptr_list.segid);
 
-  uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
-  dart_unit_t   tail        = gptr_tail.unitid;
-  int32_t     * addr;
-  DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr_list, (void *)&addr), DART_OK);
-
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
-
-  int32_t result;
-  int32_t reset = -1;
-
-  /* Check if we are at the tail of this lock queue and reset the tail pointer
-   * if we are. If that is the case we are done.
-   * Otherwise, the reset fails and we need to send notification. */
-  DART_ASSERT_RETURNS(
-    MPI_Compare_and_swap(
-      &reset,
-      &unitid.id,
-      &result,
-      MPI_INT32_T,
-      tail,
-      offset_tail,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-    MPI_Win_flush(tail, dart_win_local_alloc),
-    MPI_SUCCESS);
-
-  if (result != unitid.id) {
-    /* We are not at the tail of this lock queue. */
-    int32_t  next;
-    DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
-                   "(tail = %d) in team %d",
-                   result, (lock -> teamid));
-
-    dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                      &(team_data->segdata), gptr_list.segid);
-    MPI_Win win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(list_seginfo, unitid);
-
-    /* Wait for the update of our next pointer. */
-    do {
-      // trigger progress
-      int flag;
-      MPI_Iprobe(
-        MPI_ANY_SOURCE, MPI_ANY_TAG,
-        team_data->comm, &flag, MPI_STATUS_IGNORE);
-      DART_ASSERT_RETURNS(
-        MPI_Fetch_and_op(
-          NULL,
-          &next,
-          MPI_INT,
-          unitid.id,
-          disp_list,
-          MPI_NO_OP,
-          win),
-        MPI_SUCCESS);
-      DART_ASSERT_RETURNS(
-        MPI_Win_flush(unitid.id, win),
-        MPI_SUCCESS);
-    } while (next == -1);
-
-    DART_LOG_DEBUG("dart_lock_release: notifying %d in team %d", next,
-                   (lock->teamid));
+  int32_t * leader = lock->node_slots[0];
 
-    /* Notifying the next unit waiting on the lock queue. */
-    MPI_Send(NULL, 0, MPI_INT, next, 0, team_data->comm);
-    *addr = -1;
-    MPI_Win_sync(win);
+  if (lock_load32(&leader[DART_LOCK_SLOT_LTAIL]) != lock->lrank &&
+      lock_load32(&leader[DART_LOCK_SLOT_LPASSES])
+        < DART_LOCK_COHORT_MAX_PASSES) {
+    /* Node-local units are waiting, pass the global lock in the cohort */
+    lock_inc32(&leader[DART_LOCK_SLOT_LPASSES]);
+    DART_LOG_DEBUG("dart_lock_release: passing lock in cohort in team %d",
+                   lock->teamid);
+    lock_handoff_local(lock, team_data, DART_LOCK_GLOBAL_HELD);
+  } else {
+    lock_release_global(lock, team_data, list_seginfo);
+    if (lock_cas32(
+          &leader[DART_LOCK_SLOT_LTAIL], lock->lrank, -1) != lock->lrank) {
+      /* Head of the node-local queue acquires the global lock */
+      lock_handoff_local(lock, team_data, DART_LOCK_ACQUIRE_GLOBAL);
+    }
   }
+
   lock->is_acquired = 0;
   DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
   DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
@@ -402,6 +619,7 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
   (*lock)->gptr_tail = DART_GPTR_NULL;
   (*lock)->gptr_list = DART_GPTR_NULL;
   (*lock)->teamid    = DART_TEAM_NULL;
+  free((*lock)->node_slots);
   dart__base__mutex_destroy(&(*lock)->mutex);
   DART_LOG_DEBUG("dart_team_lock_free: done in team %d", teamid);
   free(*lock);
@@ -412,3 +630,839 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 
 
 
+
+/*
+ * Reader-writer locks
+ *
+ * The lock state is a single 64-bit word on team unit 0 that holds the
+ * number of readers in the lower 32 bits and a writer flag. Writers are
+ * serialized in an exclusive DART lock and announce themselves by setting
+ * the writer flag before waiting for active readers to drain. Readers
+ * back off while the writer flag is set, so writers are preferred.
+ */
+
+#define DART_RWLOCK_WRITER       ((int64_t)1 << 32)
+#define DART_RWLOCK_READERS_MASK (DART_RWLOCK_WRITER - 1)
+
+#define DART_RWLOCK_NONE         0
+#define DART_RWLOCK_SHARED       1
+#define DART_RWLOCK_EXCLUSIVE    2
+
+struct dart_rwlock_struct
+{
+  /** Global memory storing the lock state, stored in team-unit 0. */
+  dart_gptr_t  gptr_state;
+  /** Lock serializing writers. */
+  dart_lock_t  writer_lock;
+  /** Local mutex to ensure mutual exclusion between threads. */
+  dart_mutex_t mutex;
+  dart_team_t  teamid;
+  /** Mode in which this unit holds the lock, DART_RWLOCK_*. */
+  int32_t      mode;
+};
+
+static int64_t rwlock_fetch_and_add(dart_rwlock_t rwlock, int64_t value)
+{
+  int64_t     result;
+  dart_gptr_t gptr = rwlock->gptr_state;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value, &result, MPI_INT64_T, gptr.unitid,
+      gptr.addr_or_offs.offset, MPI_SUM, dart_win_local_alloc),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(gptr.unitid, dart_win_local_alloc),
+    MPI_SUCCESS);
+  return result;
+}
+
+dart_ret_t dart_team_rwlock_init(dart_team_t teamid, dart_rwlock_t * rwlock)
+{
+  dart_ret_t       ret;
+  dart_gptr_t      gptr_state = DART_GPTR_NULL;
+  dart_team_unit_t unitid;
+
+  *rwlock = NULL;
+
+  if (dart_adapt_teamlist_get(teamid) == NULL) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_myid(teamid, &unitid);
+
+  if (unitid.id == 0) {
+    int64_t *state_ptr;
+    ret = dart_memalloc(1, DART_TYPE_LONGLONG, &gptr_state);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+      return ret;
+    }
+    DART_ASSERT_RETURNS(
+      dart_gptr_getaddr(gptr_state, (void*)&state_ptr),
+      DART_OK);
+    *state_ptr = 0;
+    MPI_Win_sync(dart_win_local_alloc);
+  }
+
+  ret = dart_bcast(
+    &gptr_state,
+    sizeof(dart_gptr_t),
+    DART_TYPE_BYTE,
+    DART_TEAM_UNIT_ID(0),
+    teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to broadcast lock information!", __FUNCTION__);
+    return ret;
+  }
+
+  *rwlock = malloc(sizeof(struct dart_rwlock_struct));
+  ret = dart_team_lock_init(teamid, &(*rwlock)->writer_lock);
+  if (ret != DART_OK) {
+    free(*rwlock);
+    *rwlock = NULL;
+    return ret;
+  }
+  (*rwlock)->gptr_state = gptr_state;
+  (*rwlock)->teamid     = teamid;
+  (*rwlock)->mode       = DART_RWLOCK_NONE;
+  DART_ASSERT_RETURNS(
+    dart__base__mutex_init_recursive(&(*rwlock)->mutex),
+    DART_OK);
+
+  DART_LOG_DEBUG("dart_team_rwlock_init: INIT - done");
+  return DART_OK;
+}
+
+dart_ret_t dart_team_rwlock_destroy(dart_rwlock_t * rwlock)
+{
+  dart_ret_t       ret;
+  dart_team_unit_t unitid;
+  dart_team_t      teamid = (*rwlock)->teamid;
+
+  dart_team_myid(teamid, &unitid);
+
+  ret = dart_team_lock_destroy(&(*rwlock)->writer_lock);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("Failed to free writer lock");
+    return ret;
+  }
+  if (unitid.id == 0) {
+    ret = dart_memfree((*rwlock)->gptr_state);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("Failed to free global memory");
+      return ret;
+    }
+  }
+  dart__base__mutex_destroy(&(*rwlock)->mutex);
+  DART_LOG_DEBUG("dart_team_rwlock_destroy: done in team %d", teamid);
+  free(*rwlock);
+  *rwlock = NULL;
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire_shared(dart_rwlock_t rwlock)
+{
+  DART_ASSERT_RETURNS(dart__base__mutex_lock(&rwlock->mutex), DART_OK);
+  if (rwlock->mode != DART_RWLOCK_NONE) {
+    DART_LOG_ERROR("dart_rwlock_acquire_shared: LOCK has already been "
+                   "acquired");
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&rwlock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(rwlock->teamid);
+  DART_ASSERT(team_data != NULL);
+
+  while (rwlock_fetch_and_add(rwlock, 1) & DART_RWLOCK_WRITER) {
+    /* A writer is active or waiting, back off until it has finished */
+    rwlock_fetch_and_add(rwlock, -1);
+    while (rwlock_fetch_and_add(rwlock, 0) & DART_RWLOCK_WRITER) {
+      lock_progress(team_data);
+    }
+  }
+  rwlock->mode = DART_RWLOCK_SHARED;
+  DART_LOG_DEBUG("dart_rwlock_acquire_shared: lock acquired in team %d",
+                 rwlock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire_exclusive(dart_rwlock_t rwlock)
+{
+  DART_ASSERT_RETURNS(dart__base__mutex_lock(&rwlock->mutex), DART_OK);
+  if (rwlock->mode != DART_RWLOCK_NONE) {
+    DART_LOG_ERROR("dart_rwlock_acquire_exclusive: LOCK has already been "
+                   "acquired");
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&rwlock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(rwlock->teamid);
+  DART_ASSERT(team_data != NULL);
+
+  dart_ret_t ret = dart_lock_acquire(rwlock->writer_lock);
+  if (ret != DART_OK) {
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&rwlock->mutex), DART_OK);
+    return ret;
+  }
+  /* Block new readers and wait for active readers to finish */
+  int64_t state = rwlock_fetch_and_add(rwlock, DART_RWLOCK_WRITER);
+  while ((state & DART_RWLOCK_READERS_MASK) != 0) {
+    lock_progress(team_data);
+    state = rwlock_fetch_and_add(rwlock, 0);
+  }
+  rwlock->mode = DART_RWLOCK_EXCLUSIVE;
+  DART_LOG_DEBUG("dart_rwlock_acquire_exclusive: lock acquired in team %d",
+                 rwlock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire_shared(
+  dart_rwlock_t   rwlock,
+  int32_t       * is_acquired)
+{
+  *is_acquired = 0;
+  if (dart__base__mutex_trylock(&rwlock->mutex) != DART_OK) {
+    return DART_OK;
+  }
+  if (rwlock->mode != DART_RWLOCK_NONE) {
+    DART_LOG_ERROR("dart_rwlock_try_acquire_shared: LOCK has already been "
+                   "acquired");
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&rwlock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+  if (rwlock_fetch_and_add(rwlock, 1) & DART_RWLOCK_WRITER) {
+    rwlock_fetch_and_add(rwlock, -1);
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&rwlock->mutex), DART_OK);
+  } else {
+    rwlock->mode = DART_RWLOCK_SHARED;
+    *is_acquired = 1;
+  }
+  DART_LOG_DEBUG("dart_rwlock_try_acquire_shared: trylock %s in team %d",
+                 (*is_acquired) ? "succeeded" : "failed", rwlock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire_exclusive(
+  dart_rwlock_t   rwlock,
+  int32_t       * is_acquired)
+{
+  *is_acquired = 0;
+  if (dart__base__mutex_trylock(&rwlock->mutex) != DART_OK) {
+    return DART_OK;
+  }
+  if (rwlock->mode != DART_RWLOCK_NONE) {
+    DART_LOG_ERROR("dart_rwlock_try_acquire_exclusive: LOCK has already "
+                   "been acquired");
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&rwlock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+  int32_t    writer_acquired;
+  dart_ret_t ret = dart_lock_try_acquire(rwlock->writer_lock,
+                                         &writer_acquired);
+  if (ret == DART_OK && writer_acquired) {
+    int64_t state = rwlock_fetch_and_add(rwlock, DART_RWLOCK_WRITER);
+    if ((state & DART_RWLOCK_READERS_MASK) == 0) {
+      rwlock->mode = DART_RWLOCK_EXCLUSIVE;
+      *is_acquired = 1;
+    } else {
+      /* Readers are active, withdraw */
+      rwlock_fetch_and_add(rwlock, -DART_RWLOCK_WRITER);
+      dart_lock_release(rwlock->writer_lock);
+    }
+  }
+  if (!(*is_acquired)) {
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&rwlock->mutex), DART_OK);
+  }
+  DART_LOG_DEBUG("dart_rwlock_try_acquire_exclusive: trylock %s in team %d",
+                 (*is_acquired) ? "succeeded" : "failed", rwlock->teamid);
+  return ret;
+}
+
+dart_ret_t dart_rwlock_release(dart_rwlock_t rwlock)
+{
+  if (rwlock->mode == DART_RWLOCK_SHARED) {
+    rwlock_fetch_and_add(rwlock, -1);
+  } else if (rwlock->mode == DART_RWLOCK_EXCLUSIVE) {
+    rwlock_fetch_and_add(rwlock, -DART_RWLOCK_WRITER);
+    DART_ASSERT_RETURNS(dart_lock_release(rwlock->writer_lock), DART_OK);
+  } else {
+    DART_LOG_ERROR("dart_rwlock_release: LOCK has not been acquired before");
+    return DART_ERR_INVAL;
+  }
+  rwlock->mode = DART_RWLOCK_NONE;
+  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&rwlock->mutex), DART_OK);
+  DART_LOG_DEBUG("dart_rwlock_release: release lock in team %d",
+                 rwlock->teamid);
+  return DART_OK;
+}
+
+/*
+ * Lock arrays
+ *
+ * Every lock in the array is an MCS lock. All locks share a single
+ * team-aligned segment holding, for every unit, the queue tails of the
+ * locks assigned to the unit (lock i is assigned to unit i % nunits) and
+ * the unit's queue nodes for all locks. Waiting units spin on their own
+ * queue node.
+ */
+
+struct dart_lock_array_struct
+{
+  /** Team-aligned memory holding queue tails and queue nodes. */
+  dart_gptr_t    gptr;
+  dart_team_t    teamid;
+  /** Number of locks in the array. */
+  size_t         nlocks;
+  /** Number of queue tails per unit. */
+  size_t         ntails;
+  int32_t        nunits;
+  dart_team_unit_t myid;
+  /** Local mutexes to ensure mutual exclusion between threads. */
+  dart_mutex_t * mutexes;
+};
+
+#define DART_LOCK_ARRAY_TAIL_UNIT(array_, idx_) \
+  ((int32_t)((idx_) % (array_)->nunits))
+#define DART_LOCK_ARRAY_SLOT_TAIL(array_, idx_) \
+  ((int)((idx_) / (array_)->nunits))
+#define DART_LOCK_ARRAY_SLOT_NEXT(array_, idx_) \
+  ((int)((array_)->ntails + (idx_)))
+#define DART_LOCK_ARRAY_SLOT_WAIT(array_, idx_) \
+  ((int)((array_)->ntails + (array_)->nlocks + (idx_)))
+
+static dart_segment_info_t * lock_array_seginfo(dart_lock_array_t array)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(array->teamid);
+  DART_ASSERT(team_data != NULL);
+  return dart_segment_get_info(&(team_data->segdata), array->gptr.segid);
+}
+
+dart_ret_t dart_team_lock_array_init(
+  dart_team_t         teamid,
+  size_t              nlocks,
+  dart_lock_array_t * array)
+{
+  dart_ret_t  ret;
+  dart_gptr_t gptr;
+  size_t      nunits;
+
+  *array = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL || nlocks == 0) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_size(teamid, &nunits);
+
+  size_t ntails = (nlocks + nunits - 1) / nunits;
+  size_t nslots = ntails + 2 * nlocks;
+  ret = dart_team_memalloc_aligned(teamid, nslots, DART_TYPE_INT, &gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+    return ret;
+  }
+
+  dart_team_unit_t unitid;
+  int32_t        * slots;
+  dart_team_myid(teamid, &unitid);
+  dart_gptr_setunit(&gptr, unitid);
+  dart_gptr_getaddr(gptr, (void*)&slots);
+  for (size_t i = 0; i < nslots; ++i) {
+    slots[i] = -1;
+  }
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), gptr.segid);
+  MPI_Win_sync(seginfo->win);
+
+  *array = malloc(sizeof(struct dart_lock_array_struct));
+  (*array)->gptr    = gptr;
+  (*array)->teamid  = teamid;
+  (*array)->nlocks  = nlocks;
+  (*array)->ntails  = ntails;
+  (*array)->nunits  = (int32_t)nunits;
+  (*array)->myid    = unitid;
+  (*array)->mutexes = malloc(nlocks * sizeof(dart_mutex_t));
+  for (size_t i = 0; i < nlocks; ++i) {
+    DART_ASSERT_RETURNS(
+      dart__base__mutex_init(&(*array)->mutexes[i]),
+      DART_OK);
+  }
+
+  /* Queue tails must be initialized before use */
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to synchronize lock initialization!",
+                   __FUNCTION__);
+    return ret;
+  }
+  DART_LOG_DEBUG("dart_team_lock_array_init: INIT - done, %zu locks",
+                 nlocks);
+  return DART_OK;
+}
+
+dart_ret_t dart_team_lock_array_destroy(dart_lock_array_t * array)
+{
+  dart_ret_t ret;
+
+  ret = dart_team_memfree((*array)->gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("Failed to free global memory");
+    return ret;
+  }
+  for (size_t i = 0; i < (*array)->nlocks; ++i) {
+    dart__base__mutex_destroy(&(*array)->mutexes[i]);
+  }
+  free((*array)->mutexes);
+  DART_LOG_DEBUG("dart_team_lock_array_destroy: done in team %d",
+                 (*array)->teamid);
+  free(*array);
+  *array = NULL;
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_array_acquire(dart_lock_array_t array, size_t idx)
+{
+  if (idx >= array->nlocks) {
+    DART_LOG_ERROR("dart_lock_array_acquire: invalid index %zu", idx);
+    return DART_ERR_INVAL;
+  }
+  DART_ASSERT_RETURNS(
+    dart__base__mutex_lock(&array->mutexes[idx]), DART_OK);
+
+  dart_team_data_t    *team_data = dart_adapt_teamlist_get(array->teamid);
+  dart_segment_info_t *seginfo   = lock_array_seginfo(array);
+  int32_t              myid      = array->myid.id;
+
+  lock_rma_replace(-1, myid, DART_LOCK_ARRAY_SLOT_NEXT(array, idx), seginfo);
+  lock_rma_replace( 1, myid, DART_LOCK_ARRAY_SLOT_WAIT(array, idx), seginfo);
+
+  int32_t predecessor = lock_rma_replace(
+                          myid,
+                          DART_LOCK_ARRAY_TAIL_UNIT(array, idx),
+                          DART_LOCK_ARRAY_SLOT_TAIL(array, idx),
+                          seginfo);
+  if (predecessor != -1) {
+    lock_rma_replace(
+      myid, predecessor, DART_LOCK_ARRAY_SLOT_NEXT(array, idx), seginfo);
+    while (lock_rma_fetch(myid, DART_LOCK_ARRAY_SLOT_WAIT(array, idx),
+                          seginfo) != 0) {
+      lock_progress(team_data);
+    }
+  }
+  DART_LOG_TRACE("dart_lock_array_acquire: lock %zu acquired in team %d",
+                 idx, array->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_array_try_acquire(
+  dart_lock_array_t   array,
+  size_t              idx,
+  int32_t           * is_acquired)
+{
+  *is_acquired = 0;
+  if (idx >= array->nlocks) {
+    DART_LOG_ERROR("dart_lock_array_try_acquire: invalid index %zu", idx);
+    return DART_ERR_INVAL;
+  }
+  if (dart__base__mutex_trylock(&array->mutexes[idx]) != DART_OK) {
+    return DART_OK;
+  }
+
+  dart_segment_info_t *seginfo = lock_array_seginfo(array);
+  int32_t              myid    = array->myid.id;
+
+  lock_rma_replace(-1, myid, DART_LOCK_ARRAY_SLOT_NEXT(array, idx), seginfo);
+  if (lock_rma_cas(myid, -1,
+                   DART_LOCK_ARRAY_TAIL_UNIT(array, idx),
+                   DART_LOCK_ARRAY_SLOT_TAIL(array, idx),
+                   seginfo) == -1) {
+    *is_acquired = 1;
+  } else {
+    DART_ASSERT_RETURNS(
+      dart__base__mutex_unlock(&array->mutexes[idx]), DART_OK);
+  }
+  DART_LOG_TRACE("dart_lock_array_try_acquire: trylock %zu %s in team %d",
+                 idx, (*is_acquired) ? "succeeded" : "failed",
+                 array->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_array_release(dart_lock_array_t array, size_t idx)
+{
+  if (idx >= array->nlocks) {
+    DART_LOG_ERROR("dart_lock_array_release: invalid index %zu", idx);
+    return DART_ERR_INVAL;
+  }
+  dart_team_data_t    *team_data = dart_adapt_teamlist_get(array->teamid);
+  dart_segment_info_t *seginfo   = lock_array_seginfo(array);
+  int32_t              myid      = array->myid.id;
+
+  if (lock_rma_cas(-1, myid,
+                   DART_LOCK_ARRAY_TAIL_UNIT(array, idx),
+                   DART_LOCK_ARRAY_SLOT_TAIL(array, idx),
+                   seginfo) != myid) {
+    /* Successor is waiting, hand over the lock */
+    int32_t next;
+    while ((next = lock_rma_fetch(
+                     myid, DART_LOCK_ARRAY_SLOT_NEXT(array, idx), seginfo))
+           == -1) {
+      lock_progress(team_data);
+    }
+    lock_rma_replace(0, next, DART_LOCK_ARRAY_SLOT_WAIT(array, idx), seginfo);
+  }
+  DART_ASSERT_RETURNS(
+    dart__base__mutex_unlock(&array->mutexes[idx]), DART_OK);
+  DART_LOG_TRACE("dart_lock_array_release: lock %zu released in team %d",
+                 idx, array->teamid);
+  return DART_OK;
+}
+
+size_t dart_lock_array_size(dart_lock_array_t array)
+{
+  return array->nlocks;
+}
+
+/*
+ * Events
+ *
+ * Every unit holds an event counter in a team-aligned segment. Posting an
+ * event atomically adds to the counter at the target unit and notifies
+ * the target by a zero-byte message on a communicator dedicated to the
+ * event. Waiting units block in a receive for notifications instead of
+ * polling the counter, so progress of one-sided operations targeting the
+ * waiting unit is maintained by the MPI library while waiting.
+ *
+ * Node-local posters also use messages which are delivered through the
+ * shared-memory transport: blocking in the kernel, e.g. on a futex, would
+ * stall passive-target progress at the waiting unit.
+ */
+
+#define DART_EVENT_NOTIFY_TAG        0
+#define DART_EVENT_BACKOFF_MIN_US    1
+#define DART_EVENT_BACKOFF_MAX_US 1000
+
+struct dart_event_struct
+{
+  /** Team-aligned memory holding the event counters. */
+  dart_gptr_t      gptr;
+  dart_team_t      teamid;
+  dart_team_unit_t myid;
+  /** Communicator for notification messages. */
+  MPI_Comm         comm;
+};
+
+static dart_segment_info_t * event_seginfo(dart_event_t event)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(event->teamid);
+  DART_ASSERT(team_data != NULL);
+  return dart_segment_get_info(&(team_data->segdata), event->gptr.segid);
+}
+
+static int32_t event_fetch_and_add(
+  dart_event_t          event,
+  dart_segment_info_t * seginfo,
+  int32_t               unit,
+  int32_t               value)
+{
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value, &result, MPI_INT32_T, unit,
+      lock_slot_disp(seginfo, unit, 0), MPI_SUM, seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(MPI_Win_flush(unit, seginfo->win), MPI_SUCCESS);
+  return result;
+}
+
+/*
+ * Consumes count events if available, returns 1 on success.
+ */
+static int event_consume(
+  dart_event_t          event,
+  dart_segment_info_t * seginfo,
+  int32_t               count)
+{
+  int32_t myid = event->myid.id;
+  if (event_fetch_and_add(event, seginfo, myid, 0) >= count) {
+    event_fetch_and_add(event, seginfo, myid, -count);
+    return 1;
+  }
+  return 0;
+}
+
+/*
+ * Receives all pending notifications, returns the number of received
+ * notifications.
+ */
+static int event_drain(dart_event_t event)
+{
+  int received = 0;
+  int flag     = 1;
+  while (flag) {
+    MPI_Iprobe(MPI_ANY_SOURCE, DART_EVENT_NOTIFY_TAG, event->comm, &flag,
+               MPI_STATUS_IGNORE);
+    if (flag) {
+      MPI_Recv(NULL, 0, MPI_BYTE, MPI_ANY_SOURCE, DART_EVENT_NOTIFY_TAG,
+               event->comm, MPI_STATUS_IGNORE);
+      ++received;
+    }
+  }
+  return received;
+}
+
+static uint64_t event_time_us()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+dart_ret_t dart_team_event_init(dart_team_t teamid, dart_event_t * event)
+{
+  dart_ret_t       ret;
+  dart_gptr_t      gptr;
+  dart_team_unit_t unitid;
+
+  *event = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_myid(teamid, &unitid);
+
+  ret = dart_team_memalloc_aligned(teamid, 1, DART_TYPE_INT, &gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+    return ret;
+  }
+  int32_t *counter;
+  dart_gptr_setunit(&gptr, unitid);
+  dart_gptr_getaddr(gptr, (void*)&counter);
+  *counter = 0;
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), gptr.segid);
+  MPI_Win_sync(seginfo->win);
+
+  *event = malloc(sizeof(struct dart_event_struct));
+  (*event)->gptr   = gptr;
+  (*event)->teamid = teamid;
+  (*event)->myid   = unitid;
+  if (MPI_Comm_dup(team_data->comm, &(*event)->comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s: Failed to create notification communicator!",
+                   __FUNCTION__);
+    dart_team_memfree(gptr);
+    free(*event);
+    *event = NULL;
+    return DART_ERR_OTHER;
+  }
+  /* Counters must be initialized before events are posted */
+  MPI_Barrier((*event)->comm);
+
+  DART_LOG_DEBUG("dart_team_event_init: INIT - done");
+  return DART_OK;
+}
+
+dart_ret_t dart_team_event_destroy(dart_event_t * event)
+{
+  dart_ret_t ret;
+
+  /* Notifications of all posted events have been sent, discard those that
+   * have not been received in a wait */
+  MPI_Barrier((*event)->comm);
+  event_drain(*event);
+  MPI_Comm_free(&(*event)->comm);
+
+  ret = dart_team_memfree((*event)->gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("Failed to free global memory");
+    return ret;
+  }
+  DART_LOG_DEBUG("dart_team_event_destroy: done in team %d",
+                 (*event)->teamid);
+  free(*event);
+  *event = NULL;
+  return DART_OK;
+}
+
+dart_ret_t dart_event_post(
+  dart_event_t      event,
+  dart_team_unit_t  unit,
+  int32_t           count)
+{
+  if (count <= 0) {
+    return (count == 0) ? DART_OK : DART_ERR_INVAL;
+  }
+  dart_segment_info_t *seginfo = event_seginfo(event);
+  event_fetch_and_add(event, seginfo, unit.id, count);
+
+  /* The counter update is complete at the target, notify the target */
+  MPI_Request req;
+  if (MPI_Isend(NULL, 0, MPI_BYTE, unit.id, DART_EVENT_NOTIFY_TAG,
+                event->comm, &req) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_event_post: failed to notify unit %d", unit.id);
+    return DART_ERR_OTHER;
+  }
+  MPI_Request_free(&req);
+  DART_LOG_TRACE("dart_event_post: posted %d events to unit %d in team %d",
+                 count, unit.id, event->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_event_wait(
+  dart_event_t      event,
+  int32_t           count)
+{
+  dart_segment_info_t *seginfo = event_seginfo(event);
+  DART_LOG_DEBUG("dart_event_wait: waiting for %d events in team %d",
+                 count, event->teamid);
+  while (!event_consume(event, seginfo, count)) {
+    /* Block until the next notification arrives */
+    MPI_Recv(NULL, 0, MPI_BYTE, MPI_ANY_SOURCE, DART_EVENT_NOTIFY_TAG,
+             event->comm, MPI_STATUS_IGNORE);
+    event_drain(event);
+  }
+  DART_LOG_DEBUG("dart_event_wait: received %d events in team %d",
+                 count, event->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_event_timedwait(
+  dart_event_t      event,
+  int32_t           count,
+  uint64_t          timeout_us,
+  int32_t         * is_signaled)
+{
+  dart_segment_info_t *seginfo = event_seginfo(event);
+  uint64_t deadline = event_time_us() + timeout_us;
+  uint64_t backoff  = DART_EVENT_BACKOFF_MIN_US;
+
+  *is_signaled = 0;
+  while (!event_consume(event, seginfo, count)) {
+    if (event_drain(event) > 0) {
+      backoff = DART_EVENT_BACKOFF_MIN_US;
+      continue;
+    }
+    uint64_t now = event_time_us();
+    if (now >= deadline) {
+      DART_LOG_DEBUG("dart_event_timedwait: timeout in team %d",
+                     event->teamid);
+      return DART_OK;
+    }
+    /* MPI does not provide a receive with timeout, so unlike
+     * dart_event_wait this is a polling wait: probe for notifications and
+     * sleep in increasing intervals until the deadline. The probe drives
+     * MPI progress, which is therefore delayed by at most
+     * DART_EVENT_BACKOFF_MAX_US between probes */
+    if (backoff > deadline - now) {
+      backoff = deadline - now;
+    }
+    struct timespec ts = { (time_t)(backoff / 1000000),
+                           (long)(backoff % 1000000) * 1000 };
+    nanosleep(&ts, NULL);
+    backoff *= 2;
+    if (backoff > DART_EVENT_BACKOFF_MAX_US) {
+      backoff = DART_EVENT_BACKOFF_MAX_US;
+    }
+  }
+  *is_signaled = 1;
+  return DART_OK;
+}
+
+dart_ret_t dart_event_test(
+  dart_event_t      event,
+  dart_team_unit_t  unit,
+  int32_t         * count)
+{
+  *count = event_fetch_and_add(event, event_seginfo(event), unit.id, 0);
+  return DART_OK;
+}
+
+/*
+ * Pairwise synchronization
+ *
+ * Every unit holds one counter per unit in DART_TEAM_ALL in a window
+ * allocated at initialization. The counter of unit j at unit i is the
+ * number of synchronizations of unit j with unit i. A unit synchronizing
+ * with a set of units increments its counter at every unit in the set
+ * and waits until its local counters of these units reached the number of
+ * synchronizations it performed with them, so synchronization does not
+ * involve any unit outside the set.
+ */
+
+static MPI_Win   sync_win      = MPI_WIN_NULL;
+static int32_t * sync_counts   = NULL;
+static int32_t * sync_expected = NULL;
+static int       sync_nunits   = 0;
+static int       sync_myid     = 0;
+
+dart_ret_t dart__mpi__sync_init()
+{
+  MPI_Comm_rank(DART_COMM_WORLD, &sync_myid);
+  MPI_Comm_size(DART_COMM_WORLD, &sync_nunits);
+
+  if (MPI_Win_allocate(
+        sync_nunits * sizeof(int32_t), sizeof(int32_t), MPI_INFO_NULL,
+        DART_COMM_WORLD, &sync_counts, &sync_win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__sync_init ! MPI_Win_allocate failed");
+    return DART_ERR_OTHER;
+  }
+  memset(sync_counts, 0, sync_nunits * sizeof(int32_t));
+  sync_expected = calloc(sync_nunits, sizeof(int32_t));
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, sync_win);
+  /* Counters must be initialized before they are incremented */
+  MPI_Barrier(DART_COMM_WORLD);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__sync_fini()
+{
+  if (sync_win == MPI_WIN_NULL) {
+    return DART_OK;
+  }
+  MPI_Win_unlock_all(sync_win);
+  MPI_Win_free(&sync_win);
+  free(sync_expected);
+  sync_counts   = NULL;
+  sync_expected = NULL;
+  return DART_OK;
+}
+
+dart_ret_t dart_sync_units(
+  const dart_global_unit_t * units,
+  size_t                     nunits)
+{
+  const int32_t one = 1;
+
+  for (size_t i = 0; i < nunits; ++i) {
+    if (units[i].id < 0 || units[i].id >= sync_nunits) {
+      DART_LOG_ERROR("dart_sync_units ! invalid unit %d", units[i].id);
+      return DART_ERR_INVAL;
+    }
+  }
+  /* Notify all units in the set before completing any notification */
+  for (size_t i = 0; i < nunits; ++i) {
+    if (units[i].id == sync_myid) continue;
+    DART_ASSERT_RETURNS(
+      MPI_Accumulate(&one, 1, MPI_INT32_T, units[i].id, sync_myid,
+                     1, MPI_INT32_T, MPI_SUM, sync_win),
+      MPI_SUCCESS);
+  }
+  for (size_t i = 0; i < nunits; ++i) {
+    if (units[i].id == sync_myid) continue;
+    DART_ASSERT_RETURNS(MPI_Win_flush(units[i].id, sync_win), MPI_SUCCESS);
+  }
+  /* Wait for the matching notifications of all units in the set */
+  for (size_t i = 0; i < nunits; ++i) {
+    int32_t unit = units[i].id;
+    if (unit == sync_myid) continue;
+    int32_t expected = ++sync_expected[unit];
+    int32_t count;
+    do {
+      DART_ASSERT_RETURNS(
+        MPI_Fetch_and_op(NULL, &count, MPI_INT32_T, sync_myid, unit,
+                         MPI_NO_OP, sync_win),
+        MPI_SUCCESS);
+      DART_ASSERT_RETURNS(MPI_Win_flush(sync_myid, sync_win), MPI_SUCCESS);
+    } while (count < expected);
+  }
+  DART_LOG_DEBUG("dart_sync_units: synchronized with %zu units", nunits);
+  return DART_OK;
+}
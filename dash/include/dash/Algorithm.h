@@ -16,8 +16,11 @@
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
+#include <dash/algorithm/Assign.h>
 #include <dash/algorithm/Accumulate.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/CopyPlan.h>
+#include <dash/algorithm/CopyStream.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/AllOf.h>
@@ -26,5 +29,6 @@
 #include <dash/algorithm/Equal.h>
 
 #include <dash/algorithm/SUMMA.h>
+#include <dash/algorithm/SpMV.h>
 
 #endif // DASH__ALGORITHM_H_
@@ -3,6 +3,7 @@
 
 #include <dash/allocator/LocalAllocator.h>
 #include <dash/allocator/SymmetricAllocator.h>
+#include <dash/allocator/FileBackedAllocator.h>
 #include <dash/allocator/EpochSynchronizedAllocator.h>
 
 namespace dash {
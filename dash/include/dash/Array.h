@@ -12,14 +12,19 @@
 #include <dash/Shared.h>
 #include <dash/HView.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
+#include <dash/ReadCache.h>
 
 #include <dash/pattern/BlockPattern1D.h>
 
 #include <dash/iterator/GlobIter.h>
 
+#include <algorithm>
 #include <iterator>
 #include <initializer_list>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 
 /**
@@ -74,6 +79,11 @@
  * <tt>bool</tt>            | <tt>is_local</tt>     | <tt>index_type gi</tt>                                  | Whether the element at the given linear offset in global index space <tt>gi</tt> is local.
  * <tt>bool</tt>            | <tt>allocate</tt>     | <tt>size_type n, DistributionSpec\<DD\> ds, Team t</tt> | Allocation of <tt>n</tt> container elements distributed in Team <tt>t</tt> as specified by distribution spec <tt>ds</tt>
  * <tt>void</tt>            | <tt>deallocate</tt>   | &nbsp;                                                  | Deallocation of the container and its elements.
+ * <tt>void</tt>            | <tt>resize</tt>       | <tt>size_type n</tt>                                    | Change the number of container elements to <tt>n</tt>, preserving the values of existing elements.
+ * <tt>void</tt>            | <tt>reserve</tt>      | <tt>size_type n</tt>                                    | Allocate global memory for at least <tt>n</tt> container elements.
+ * <tt>void</tt>            | <tt>rebalance</tt>    | <tt>pattern_type p</tt>                                 | Move the container elements to the distribution of pattern <tt>p</tt>.
+ * <tt>void</tt>            | <tt>rebalance_async</tt> | <tt>pattern_type p</tt>                              | Start moving the container elements to the distribution of pattern <tt>p</tt> in the background.
+ * <tt>void</tt>            | <tt>rebalance_wait</tt> | &nbsp;                                                | Complete a redistribution started with <tt>rebalance_async</tt>.
  *
  * \}
  *
@@ -709,6 +719,15 @@ private:
   typedef std::unique_ptr<glob_mem_type>
     PtrGlobMemType_t;
 
+  /// Redistribution started by \c rebalance_async and completed by
+  /// \c rebalance_wait.
+  struct rebalance_state_t {
+    PatternType                pattern;
+    PtrGlobMemType_t           globmem;
+    size_type                  lcapacity;
+    std::vector<dart_handle_t> handles;
+  };
+
 public:
   /// Local proxy object, allows use in range-based for loops.
   local_type           local;
@@ -728,6 +747,8 @@ private:
   iterator             m_end;
   /// Total number of elements in the array
   size_type            m_size;
+  /// Number of elements the array can hold without reallocation
+  size_type            m_capacity  = 0;
   /// Number of local elements in the array
   size_type            m_lsize;
   /// Number allocated local elements in the array
@@ -740,6 +761,8 @@ private:
   team_unit_t          m_myid;
   /// Whether or not the array was actually allocated
   bool                 m_registered = false;
+  /// Pending redistribution, started in \c rebalance_async
+  std::unique_ptr<rebalance_state_t> m_rebalance;
 
 public:
   /**
@@ -902,10 +925,12 @@ public:
     m_begin(other.m_begin),
     m_end(other.m_end),
     m_size(other.m_size),
+    m_capacity(other.m_capacity),
     m_lsize(other.m_lsize),
     m_lcapacity(other.m_lcapacity),
     m_lbegin(other.m_lbegin),
-    m_lend(other.m_lend) {
+    m_lend(other.m_lend),
+    m_rebalance(std::move(other.m_rebalance)) {
 
     other.m_globmem = nullptr;
     other.m_lbegin  = nullptr;
@@ -960,7 +985,9 @@ public:
     this->m_myid      = other.m_myid;
     this->m_pattern   = std::move(other.m_pattern);
     this->m_size      = other.m_size;
+    this->m_capacity  = other.m_capacity;
     this->m_team      = other.m_team;
+    this->m_rebalance = std::move(other.m_rebalance);
 
     other.m_globmem = nullptr;
     other.m_lbegin  = nullptr;
@@ -1004,6 +1031,18 @@ public:
     return *m_globmem;
   }
 
+  /**
+   * Software cache for reads of remote array elements.
+   * Arguments are forwarded to the constructor of \c dash::ReadCache.
+   *
+   * \see  dash::ReadCache
+   */
+  template<typename ... Args>
+  ReadCache<self_t> cached(Args && ... args) const
+  {
+    return ReadCache<self_t>(*this, std::forward<Args>(args)...);
+  }
+
   /**
    * Global const pointer to the beginning of the array.
    */
@@ -1154,11 +1193,14 @@ public:
    * The number of elements that can be held in currently allocated storage
    * of the array.
    *
-   * \return  The number of elements in the array.
+   * \return  The number of elements the array can be resized to without
+   *          reallocation of its global memory.
+   *
+   * \see  reserve
    */
   constexpr size_type capacity() const noexcept
   {
-    return m_size;
+    return m_capacity;
   }
 
   /**
@@ -1325,6 +1367,228 @@ public:
     return allocate(nelem, dash::BLOCKED, team);
   }
 
+  /**
+   * Change the number of elements in the array, preserving the values of
+   * the first <tt>min(size(), nelem)</tt> elements. Elements appended to
+   * the array are value-initialized.
+   *
+   * The pattern of the array is rebuilt for the new size using the
+   * array's distribution spec and team.
+   * Global memory is reused if its local capacity suffices for the new
+   * pattern, elements whose unit and local offset do not change are not
+   * transferred then. All other elements are read by their new owner in
+   * one non-blocking get per range that is contiguous in the local memory
+   * of both the previous and the new owner.
+   *
+   * Collective operation, invalidates all iterators, references and
+   * native pointers to array elements.
+   *
+   * \see  reserve
+   */
+  void resize(size_type nelem)
+  {
+    DASH_LOG_TRACE_VAR("Array.resize()", nelem);
+    check_no_rebalance("Array.resize");
+    if (m_globmem == nullptr) {
+      allocate(nelem, m_pattern.distspec());
+      return;
+    }
+    if (nelem == m_size) {
+      return;
+    }
+    PatternType new_pattern(
+      SizeSpec_t(nelem), m_pattern.distspec(), *m_team);
+    auto lcapacity = std::max<size_type>(
+                       new_pattern.local_capacity(), m_lcapacity);
+    redistribute(new_pattern, lcapacity);
+    m_capacity = std::max(m_capacity, m_size);
+    DASH_LOG_TRACE("Array.resize >", "size:", m_size);
+  }
+
+  /**
+   * Change the capacity of the array such that it can be resized to
+   * \c nelem elements without reallocation of its global memory.
+   * Does not change the size of the array.
+   *
+   * Collective operation, invalidates all iterators, references and
+   * native pointers to array elements if the array is reallocated.
+   *
+   * \see  resize
+   */
+  void reserve(size_type nelem)
+  {
+    DASH_LOG_TRACE_VAR("Array.reserve()", nelem);
+    check_no_rebalance("Array.reserve");
+    if (m_globmem == nullptr || nelem <= m_capacity) {
+      return;
+    }
+    PatternType cap_pattern(
+      SizeSpec_t(nelem), m_pattern.distspec(), *m_team);
+    if (cap_pattern.local_capacity() > m_lcapacity) {
+      PatternType pattern(m_pattern);
+      redistribute(pattern, cap_pattern.local_capacity());
+    }
+    m_capacity = nelem;
+    DASH_LOG_TRACE("Array.reserve >", "local capacity:", m_lcapacity);
+  }
+
+  /**
+   * Move the array elements to the distribution of the given pattern,
+   * typically a copy of the array's pattern with updated load balance
+   * weights. The size of the pattern must equal the size of the array.
+   *
+   * Like in \c resize, only elements that are assigned to a different
+   * unit or local offset are transferred, global memory is reused if its
+   * local capacity suffices for the new pattern.
+   *
+   * Collective operation, invalidates all iterators, references and
+   * native pointers to array elements.
+   *
+   * \code
+   *   auto pattern = array.pattern();
+   *   pattern.update_load_weights(local_elapsed);
+   *   array.rebalance(pattern);
+   * \endcode
+   *
+   * \see  dash::LoadBalancePattern::update_load_weights
+   */
+  void rebalance(const PatternType & pattern)
+  {
+    DASH_LOG_TRACE_VAR("Array.rebalance()", pattern.local_size());
+    check_no_rebalance("Array.rebalance");
+    DASH_ASSERT_EQ(pattern.size(), m_size,
+                   "Pattern size differs from array size");
+    auto lcapacity = std::max<size_type>(
+                       pattern.local_capacity(), m_lcapacity);
+    redistribute(pattern, lcapacity);
+    DASH_LOG_TRACE("Array.rebalance >");
+  }
+
+  /**
+   * Start moving the array elements to the distribution of the given
+   * pattern in the background, e.g. after
+   * \c dash::DynamicPattern::balance. The size of the pattern must equal
+   * the size of the array.
+   *
+   * Every unit writes its local elements that are assigned to a different
+   * unit to new global memory, using one non-blocking put per range that
+   * is contiguous at both units. Elements that remain at their unit are
+   * copied locally.
+   * The array keeps its previous distribution until \c rebalance_wait,
+   * so its elements can still be read while they are migrated but must
+   * not be modified. Resizing, reallocating or rebalancing the array
+   * before \c rebalance_wait throws \c dash::exception::RuntimeError.
+   *
+   * Collective operation.
+   *
+   * \code
+   *   auto pattern = array.pattern();
+   *   pattern.balance();
+   *   array.rebalance_async(pattern);
+   *   // ... read array elements, compute on other data ...
+   *   array.rebalance_wait();
+   * \endcode
+   *
+   * \see  rebalance_wait
+   */
+  void rebalance_async(const PatternType & pattern)
+  {
+    DASH_LOG_TRACE_VAR("Array.rebalance_async()", pattern.local_size());
+    DASH_ASSERT_EQ(pattern.size(), m_size,
+                   "Pattern size differs from array size");
+    check_no_rebalance("Array.rebalance_async");
+    // Range of local elements contiguous at their new owner:
+    struct range_t {
+      team_unit_t unit;
+      index_type  gindex;
+      index_type  lindex;
+      index_type  dst;
+      size_type   count;
+    };
+    std::unique_ptr<rebalance_state_t> state(new rebalance_state_t {
+      pattern,
+      nullptr,
+      std::max<size_type>(pattern.local_capacity(), m_lcapacity),
+      std::vector<dart_handle_t>() });
+
+    std::vector<range_t> ranges;
+    for (size_type l = 0; l < m_lsize; ++l) {
+      index_type g   = m_pattern.global(static_cast<index_type>(l));
+      auto       dst = state->pattern.local(g);
+      if (!ranges.empty()) {
+        auto & last = ranges.back();
+        auto   n    = static_cast<index_type>(last.count);
+        if (last.unit == dst.unit &&
+            last.lindex + n == static_cast<index_type>(l) &&
+            last.dst    + n == dst.index) {
+          ++last.count;
+          continue;
+        }
+      }
+      ranges.push_back(
+        range_t { dst.unit, g, static_cast<index_type>(l), dst.index, 1 });
+    }
+
+    state->globmem = PtrGlobMemType_t(
+                       new glob_mem_type(state->lcapacity, *m_team));
+    // Global memory of all units must be allocated before it is written:
+    m_team->barrier();
+    iterator new_begin(state->globmem.get(), state->pattern);
+    value_type * new_lbegin = state->globmem->lbegin();
+    for (const auto & range : ranges) {
+      if (range.unit == m_myid) {
+        std::copy(m_lbegin + range.lindex,
+                  m_lbegin + range.lindex + range.count,
+                  new_lbegin + range.dst);
+      } else {
+        state->handles.push_back(DART_HANDLE_NULL);
+        dash::internal::put_handle(
+          (new_begin + range.gindex).dart_gptr(),
+          m_lbegin + range.lindex, range.count,
+          &state->handles.back());
+      }
+    }
+    m_rebalance = std::move(state);
+    DASH_LOG_TRACE("Array.rebalance_async >", "puts:",
+                   m_rebalance->handles.size());
+  }
+
+  /**
+   * Complete the redistribution started by \c rebalance_async and switch
+   * the array to its new distribution at all units.
+   * Does nothing if no redistribution is pending.
+   *
+   * Collective operation, invalidates all iterators, references and
+   * native pointers to array elements.
+   *
+   * \see  rebalance_async
+   */
+  void rebalance_wait()
+  {
+    DASH_LOG_TRACE("Array.rebalance_wait()");
+    if (m_rebalance == nullptr) {
+      return;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_waitall(m_rebalance->handles.data(),
+                   m_rebalance->handles.size()),
+      DART_OK);
+    // All units must have written their elements before the array is
+    // switched to the new distribution:
+    m_team->barrier();
+
+    m_globmem   = std::move(m_rebalance->globmem);
+    m_pattern   = m_rebalance->pattern;
+    m_lcapacity = m_rebalance->lcapacity;
+    m_rebalance.reset();
+    m_lsize     = m_pattern.local_size();
+    m_begin     = iterator(m_globmem.get(), m_pattern);
+    m_end       = iterator(m_begin) + m_size;
+    m_lbegin    = m_globmem->lbegin();
+    m_lend      = m_lbegin + m_lsize;
+    DASH_LOG_TRACE("Array.rebalance_wait >", "local size:", m_lsize);
+  }
+
   /**
    * Delayed allocation of global memory using a
    * one-dimensional distribution spec and
@@ -1367,11 +1631,19 @@ public:
   {
     DASH_LOG_TRACE_VAR("Array.deallocate()", this);
     DASH_LOG_TRACE_VAR("Array.deallocate()", m_size);
+    // Complete pending redistribution before its target memory is freed:
+    if (m_rebalance != nullptr) {
+      DASH_ASSERT_RETURNS(
+        dart_waitall(m_rebalance->handles.data(),
+                     m_rebalance->handles.size()),
+        DART_OK);
+    }
     // Assure all units are synchronized before deallocation, otherwise
     // other units might still be working on the array:
     if (dash::is_initialized()) {
       barrier();
     }
+    m_rebalance.reset();
     // Remove this function from team deallocator list to avoid
     // double-free:
     if (m_registered) {
@@ -1383,7 +1655,8 @@ public:
     if (m_globmem != nullptr) {
       m_globmem.reset();
     }
-    m_size = 0;
+    m_size     = 0;
+    m_capacity = 0;
     DASH_LOG_TRACE_VAR("Array.deallocate >", this);
   }
 
@@ -1394,12 +1667,14 @@ public:
   {
     DASH_LOG_TRACE("Array._allocate()", "pattern",
                    pattern.memory_layout().extents());
+    check_no_rebalance("Array.allocate");
     if (&m_pattern != &pattern) {
       DASH_LOG_TRACE("Array.allocate()", "using specified pattern");
       m_pattern = pattern;
     }
     // Check requested capacity:
     m_size      = m_pattern.capacity();
+    m_capacity  = m_size;
     m_team      = &(m_pattern.team());
     if (m_size == 0) {
       DASH_LOG_WARN("Array.allocate", "allocating dash::Array with size 0");
@@ -1447,8 +1722,10 @@ private:
   {
     DASH_LOG_TRACE("Array._allocate()", "pattern",
                    pattern.memory_layout().extents());
+    check_no_rebalance("Array.allocate");
     // Check requested capacity:
     m_size      = pattern.capacity();
+    m_capacity  = m_size;
     m_team      = &pattern.team();
     if (m_size == 0) {
       DASH_THROW(
@@ -1491,6 +1768,143 @@ private:
     return true;
   }
 
+  /**
+   * Global memory must not be replaced while puts of a redistribution
+   * started in \c rebalance_async are pending.
+   */
+  void check_no_rebalance(const char * context) const
+  {
+    if (m_rebalance != nullptr) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        context << ": rebalance pending, call rebalance_wait first");
+    }
+  }
+
+  /**
+   * Move the array elements to the distribution of the given pattern in
+   * global memory of the given local capacity.
+   */
+  void redistribute(
+    const PatternType & new_pattern,
+    size_type           lcapacity)
+  {
+    DASH_LOG_TRACE("Array.redistribute()", "size:", new_pattern.size(),
+                   "local capacity:", lcapacity);
+    // Range of elements contiguous in local memory at their previous and
+    // new owner:
+    struct range_t {
+      team_unit_t unit;
+      index_type  gindex;
+      index_type  lindex;
+      index_type  dst;
+      size_type   count;
+    };
+    const bool in_place  = (lcapacity == m_lcapacity);
+    const auto nkeep     = std::min<size_type>(new_pattern.size(), m_size);
+    const auto new_lsize = new_pattern.local_size();
+
+    std::vector<range_t> ranges;
+    std::vector<index_type> appended;
+    for (size_type l = 0; l < new_lsize; ++l) {
+      index_type g = new_pattern.global(static_cast<index_type>(l));
+      if (static_cast<size_type>(g) >= nkeep) {
+        appended.push_back(l);
+        continue;
+      }
+      auto src = m_pattern.local(g);
+      if (in_place && src.unit == m_myid &&
+          src.index == static_cast<index_type>(l)) {
+        continue;
+      }
+      if (!ranges.empty()) {
+        auto & last = ranges.back();
+        auto   n    = static_cast<index_type>(last.count);
+        if (last.unit == src.unit &&
+            last.lindex + n == src.index &&
+            last.dst    + n == static_cast<index_type>(l)) {
+          ++last.count;
+          continue;
+        }
+      }
+      ranges.push_back(
+        range_t { src.unit, g, src.index, static_cast<index_type>(l), 1 });
+    }
+
+    // Elements are read from the previous global memory into new global
+    // memory or, if the memory is reused, into a buffer:
+    PtrGlobMemType_t new_globmem;
+    std::vector<value_type> buffer;
+    std::vector<value_type *> targets(ranges.size());
+    if (in_place) {
+      size_type nbuf = 0;
+      for (const auto & range : ranges) {
+        nbuf += range.count;
+      }
+      buffer.resize(nbuf);
+      nbuf = 0;
+      for (size_t r = 0; r < ranges.size(); ++r) {
+        targets[r] = buffer.data() + nbuf;
+        nbuf      += ranges[r].count;
+      }
+    } else {
+      new_globmem = PtrGlobMemType_t(new glob_mem_type(lcapacity, *m_team));
+      for (size_t r = 0; r < ranges.size(); ++r) {
+        targets[r] = new_globmem->lbegin() + ranges[r].dst;
+      }
+    }
+    // Complete writes to elements before they are read:
+    barrier();
+    std::vector<dart_handle_t> handles;
+    handles.reserve(ranges.size());
+    for (size_t r = 0; r < ranges.size(); ++r) {
+      const auto & range = ranges[r];
+      if (range.unit == m_myid) {
+        std::copy(m_lbegin + range.lindex,
+                  m_lbegin + range.lindex + range.count,
+                  targets[r]);
+      } else {
+        handles.push_back(DART_HANDLE_NULL);
+        dash::internal::get_handle(
+          (m_begin + range.gindex).dart_gptr(),
+          targets[r], range.count, &handles.back());
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_waitall(handles.data(), handles.size()),
+      DART_OK);
+    // All units must have read their elements before previous global
+    // memory is overwritten or freed:
+    m_team->barrier();
+
+    if (!in_place) {
+      m_globmem = std::move(new_globmem);
+    }
+    value_type * lbegin = m_globmem->lbegin();
+    if (in_place) {
+      for (size_t r = 0; r < ranges.size(); ++r) {
+        std::copy(targets[r], targets[r] + ranges[r].count,
+                  lbegin + ranges[r].dst);
+      }
+    }
+    for (auto l : appended) {
+      lbegin[l] = value_type();
+    }
+
+    m_pattern   = new_pattern;
+    m_size      = m_pattern.capacity();
+    m_lsize     = m_pattern.local_size();
+    m_lcapacity = lcapacity;
+    m_begin     = iterator(m_globmem.get(), m_pattern);
+    m_end       = iterator(m_begin) + m_size;
+    m_lbegin    = lbegin;
+    m_lend      = m_lbegin + m_lsize;
+    // Assure all units completed redistribution before elements are
+    // accessed:
+    m_team->barrier();
+    DASH_LOG_TRACE("Array.redistribute >");
+  }
+
 };
 
 } // namespace dash
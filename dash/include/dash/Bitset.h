@@ -0,0 +1,238 @@
+#ifndef DASH__BITSET_H__INCLUDED
+#define DASH__BITSET_H__INCLUDED
+
+#include <dash/Array.h>
+#include <dash/Distribution.h>
+#include <dash/Exception.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+
+namespace dash {
+
+/**
+ * A fixed-size sequence of bits distributed to units in a team.
+ *
+ * Bits are packed into words of type \c word_type which are stored and
+ * distributed like the elements of a \c dash::Array, using one eighth of
+ * the memory of a \c dash::Array<bool>.
+ * Setting, resetting and testing a bit are single atomic operations on
+ * the containing word, so concurrent updates of bits in the same word by
+ * different units are not lost.
+ *
+ * \code
+ *   dash::Bitset visited(nvertices);
+ *   // ...
+ *   if (!visited.set(v)) {
+ *     // v has not been visited before
+ *   }
+ * \endcode
+ */
+class Bitset {
+private:
+  typedef Bitset                                 self_t;
+
+public:
+  typedef uint64_t                            word_type;
+  typedef size_t                              size_type;
+  typedef dash::default_index_t              index_type;
+  typedef dash::Array<word_type>             array_type;
+  typedef typename array_type::pattern_type pattern_type;
+
+  /// Number of bits in a word.
+  static constexpr size_type word_bits =
+    std::numeric_limits<word_type>::digits;
+
+public:
+  /**
+   * Constructor, allocates a bitset of \c nbits bits with all bits reset.
+   * Words are distributed as specified by \c distribution.
+   *
+   * Collective operation.
+   */
+  explicit Bitset(
+    size_type                 nbits,
+    const DistributionSpec<1> & distribution = dash::BLOCKED,
+    Team                    & team         = dash::Team::All())
+  : _nbits(nbits),
+    _words(nwords(nbits), distribution, team)
+  {
+    DASH_LOG_TRACE("Bitset(nbits)", "nbits:", nbits);
+    std::fill(_words.lbegin(), _words.lend(), 0);
+    _words.barrier();
+  }
+
+  /**
+   * Constructor, allocates a bitset of \c nbits bits distributed in
+   * blocks to the units in the given team.
+   *
+   * Collective operation.
+   */
+  Bitset(
+    size_type   nbits,
+    Team      & team)
+  : Bitset(nbits, dash::BLOCKED, team)
+  { }
+
+  Bitset(const self_t & other)             = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Atomically set the bit at the given index.
+   *
+   * \return  The previous value of the bit.
+   */
+  bool set(index_type pos)
+  {
+    return update(pos, mask(pos), DART_OP_BOR) & mask(pos);
+  }
+
+  /**
+   * Atomically reset the bit at the given index.
+   *
+   * \return  The previous value of the bit.
+   */
+  bool reset(index_type pos)
+  {
+    return update(pos, ~mask(pos), DART_OP_BAND) & mask(pos);
+  }
+
+  /**
+   * Atomically read the bit at the given index.
+   */
+  bool test(index_type pos) const
+  {
+    return const_cast<self_t *>(this)->update(pos, 0, DART_OP_NO_OP)
+           & mask(pos);
+  }
+
+  /**
+   * Same as \c test.
+   */
+  inline bool operator[](index_type pos) const
+  {
+    return test(pos);
+  }
+
+  /**
+   * Number of set bits in the local words.
+   */
+  size_type local_count() const
+  {
+    // Counting in a simple loop over contiguous words allows the
+    // compiler to vectorize the population count:
+    size_type count = 0;
+    const word_type * words  = _words.lbegin();
+    const size_type   nlocal = _words.lsize();
+    for (size_type w = 0; w < nlocal; ++w) {
+      count += __builtin_popcountll(words[w]);
+    }
+    return count;
+  }
+
+  /**
+   * Number of set bits in the bitset.
+   *
+   * Collective operation, does not synchronize with preceding updates.
+   */
+  size_type count() const
+  {
+    unsigned long long local = local_count();
+    unsigned long long total = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&local, &total, 1, DART_TYPE_ULONGLONG, DART_OP_SUM,
+                     _words.team().dart_id()),
+      DART_OK);
+    return static_cast<size_type>(total);
+  }
+
+  /**
+   * Reset all bits.
+   *
+   * Collective operation.
+   */
+  void clear()
+  {
+    _words.barrier();
+    std::fill(_words.lbegin(), _words.lend(), 0);
+    _words.barrier();
+  }
+
+  /**
+   * Number of bits in the bitset.
+   */
+  constexpr size_type size() const noexcept
+  {
+    return _nbits;
+  }
+
+  /**
+   * Whether the word containing the bit at the given index is local.
+   */
+  bool is_local(index_type pos) const
+  {
+    return _words.is_local(pos / word_bits);
+  }
+
+  /**
+   * The array of words containing the bits, bit \c i is stored at bit
+   * <tt>i % word_bits</tt> of word <tt>i / word_bits</tt>.
+   */
+  const array_type & words() const noexcept
+  {
+    return _words;
+  }
+
+  inline Team & team() const noexcept
+  {
+    return _words.team();
+  }
+
+  inline void barrier() const
+  {
+    _words.barrier();
+  }
+
+private:
+  static constexpr size_type nwords(size_type nbits)
+  {
+    return (nbits + word_bits - 1) / word_bits;
+  }
+
+  static constexpr word_type mask(index_type pos)
+  {
+    return word_type(1) << (pos % word_bits);
+  }
+
+  word_type update(index_type pos, word_type operand, dart_operation_t op)
+  {
+    DASH_ASSERT_RANGE(0, pos, static_cast<index_type>(_nbits) - 1,
+                      "Bitset index out of range");
+    auto gptr = (_words.begin() + pos / word_bits).dart_gptr();
+    word_type result;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(gptr, &operand, &result,
+                        dash::dart_datatype<word_type>::value, op),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_flush_local(gptr),
+      DART_OK);
+    return result;
+  }
+
+private:
+  size_type    _nbits;
+  array_type   _words;
+};
+
+} // namespace dash
+
+#endif // DASH__BITSET_H__INCLUDED
@@ -0,0 +1,208 @@
+#ifndef DASH__BLOOM_FILTER_H__INCLUDED
+#define DASH__BLOOM_FILTER_H__INCLUDED
+
+#include <dash/Bitset.h>
+#include <dash/Team.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+
+
+namespace dash {
+
+/**
+ * A distributed Bloom filter, a probabilistic set that reports whether
+ * an element is possibly contained or definitely not contained.
+ *
+ * Elements are mapped to \c k bits in a \c dash::Bitset using double
+ * hashing of the value of \c Hash. Inserting an element sets its bits
+ * atomically, so all units can insert and query concurrently.
+ *
+ * \code
+ *   dash::BloomFilter<uint64_t> seen(expected_elements, 0.01);
+ *   for (auto key : local_keys) {
+ *     if (!seen.insert(key)) {
+ *       // key has definitely not been inserted before
+ *     }
+ *   }
+ * \endcode
+ *
+ * \tparam  Key   Type of the elements.
+ * \tparam  Hash  Hash function object on elements.
+ */
+template<
+  typename Key,
+  typename Hash = std::hash<Key> >
+class BloomFilter {
+private:
+  typedef BloomFilter<Key, Hash>                  self_t;
+
+public:
+  typedef Key                                   key_type;
+  typedef Hash                                    hasher;
+  typedef typename Bitset::size_type           size_type;
+
+public:
+  /**
+   * Constructor, allocates a filter of \c nbits bits using \c nhashes
+   * hash functions.
+   *
+   * Collective operation.
+   */
+  BloomFilter(
+    size_type   nbits,
+    int         nhashes,
+    Team      & team = dash::Team::All(),
+    const Hash & hash = Hash())
+  : _bits(std::max<size_type>(nbits, 1), team),
+    _nhashes(static_cast<unsigned>(std::max(nhashes, 1))),
+    _hash(hash)
+  { }
+
+  /**
+   * Constructor, allocates a filter of optimal size for the expected
+   * number of elements and false positive rate.
+   *
+   * Collective operation.
+   */
+  BloomFilter(
+    size_type   expected_elements,
+    double      false_positive_rate,
+    Team      & team = dash::Team::All(),
+    const Hash & hash = Hash())
+  : BloomFilter(
+      optimal_bits(expected_elements, false_positive_rate),
+      optimal_hashes(expected_elements, false_positive_rate),
+      team,
+      hash)
+  { }
+
+  /**
+   * Insert an element.
+   *
+   * \return  \c true if the element was possibly inserted before,
+   *          \c false if it definitely was not.
+   */
+  bool insert(const key_type & key)
+  {
+    uint64_t h1, h2;
+    hashes(key, h1, h2);
+    bool contained = true;
+    for (unsigned i = 0; i < _nhashes; ++i) {
+      contained &= _bits.set(bit_index(h1, h2, i));
+    }
+    return contained;
+  }
+
+  /**
+   * Whether the element possibly has been inserted.
+   *
+   * \return  \c true if the element was possibly inserted, \c false if it
+   *          definitely was not.
+   */
+  bool contains(const key_type & key) const
+  {
+    uint64_t h1, h2;
+    hashes(key, h1, h2);
+    for (unsigned i = 0; i < _nhashes; ++i) {
+      if (!_bits.test(bit_index(h1, h2, i))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Remove all elements.
+   *
+   * Collective operation.
+   */
+  void clear()
+  {
+    _bits.clear();
+  }
+
+  /**
+   * Number of bits in the filter.
+   */
+  size_type size() const noexcept
+  {
+    return _bits.size();
+  }
+
+  /**
+   * Number of hash functions applied to every element.
+   */
+  unsigned num_hashes() const noexcept
+  {
+    return _nhashes;
+  }
+
+  /**
+   * The bitset of the filter.
+   */
+  const Bitset & bits() const noexcept
+  {
+    return _bits;
+  }
+
+  inline Team & team() const noexcept
+  {
+    return _bits.team();
+  }
+
+  inline void barrier() const
+  {
+    _bits.barrier();
+  }
+
+private:
+  static size_type optimal_bits(size_type n, double p)
+  {
+    const double ln2 = std::log(2.0);
+    return static_cast<size_type>(
+             std::ceil(-static_cast<double>(n) * std::log(p) / (ln2 * ln2)));
+  }
+
+  static int optimal_hashes(size_type n, double p)
+  {
+    const double m = static_cast<double>(optimal_bits(n, p));
+    return static_cast<int>(
+             std::round(m / std::max<double>(n, 1) * std::log(2.0)));
+  }
+
+  /**
+   * Finalizer of SplitMix64, spreads hash values of \c std::hash which is
+   * the identity for integral types.
+   */
+  static uint64_t mix(uint64_t x)
+  {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  void hashes(const key_type & key, uint64_t & h1, uint64_t & h2) const
+  {
+    h1 = mix(static_cast<uint64_t>(_hash(key)));
+    // odd second hash so all bits are reachable if the size is a power
+    // of two:
+    h2 = mix(h1) | 1;
+  }
+
+  Bitset::index_type bit_index(uint64_t h1, uint64_t h2, unsigned i) const
+  {
+    return static_cast<Bitset::index_type>((h1 + i * h2) % _bits.size());
+  }
+
+private:
+  Bitset     _bits;
+  unsigned   _nhashes;
+  Hash       _hash;
+};
+
+} // namespace dash
+
+#endif // DASH__BLOOM_FILTER_H__INCLUDED
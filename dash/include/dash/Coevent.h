@@ -4,10 +4,12 @@
 #include <dash/Exception.h>
 #include <dash/Team.h>
 #include <dash/Types.h>
-#include <dash/GlobPtr.h>
-#include <dash/Atomic.h>
 
-#include <dash/Algorithm.h>
+#include <dash/dart/if/dart_synchronization.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
 
 #include <dash/coarray/CoEventIter.h>
 #include <dash/coarray/CoEventRef.h>
@@ -23,8 +25,9 @@ namespace dash {
  * Coevent can be used for point-to-point synchronization. Events can be posted
  * to any image. Waiting on non-local events is not supported.
  *
- * \note Coevents might deadlock if multiple units are pinned to the same
- *       cpu-core. This is due to progress problems in MPI.
+ * Waiting units do not poll their event counter but block until they are
+ * notified by a unit posting an event. Whether a blocked unit occupies its
+ * CPU core depends on the progress mode of the underlying MPI library.
  *
  * Example:
  *
@@ -39,8 +42,7 @@ namespace dash {
  */
 class Coevent {
 private:
-  using event_cnt_t    = dash::Atomic<int>;
-  using gptr_t         = GlobPtr<event_cnt_t>;
+  using self_t         = Coevent;
 public:
   // Types
   using iterator       = coarray::CoEventIter;
@@ -48,9 +50,6 @@ public:
   using reference      = coarray::CoEventRef;
   using size_type      = int;
 
-private:
-  dash::Array<event_cnt_t> _event_counts;
-
 public:
 
   /**
@@ -63,22 +62,33 @@ public:
       }
     }
 
+  Coevent(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  ~Coevent() {
+    if (_is_initialized) {
+      _team->unregister_deallocator(
+        this, std::bind(&Coevent::deallocate, this));
+      deallocate();
+    }
+  }
+
   iterator begin() noexcept {
-    return iterator(static_cast<gptr_t>(_event_counts.begin()));
+    return iterator(_event, 0, *_team);
   }
 
   const_iterator begin() const noexcept {
-    return const_iterator(static_cast<gptr_t>(_event_counts.begin()));
+    return const_iterator(_event, 0, *_team);
   }
 
   iterator end() {
     DASH_ASSERT_MSG(dash::is_initialized(), "DASH is not initialized");
-    return iterator(static_cast<gptr_t>(_event_counts.end()));
+    return iterator(_event, size(), *_team);
   }
 
   const_iterator end() const {
     DASH_ASSERT_MSG(dash::is_initialized(), "DASH is not initialized");
-    return const_iterator(static_cast<gptr_t>(_event_counts.end()));
+    return const_iterator(_event, size(), *_team);
   }
 
   size_type size() const {
@@ -88,40 +98,62 @@ public:
 
   /**
    * wait for a given number of incoming events.
-   * This function is thread-safe
+   * The calling unit blocks until notified by posting units instead of
+   * polling its event counter.
    */
   inline void wait(int count = 1) {
-    auto gref = _event_counts.at(_team->myid().id);
-    int current;
-    do {
-#ifdef DASH_DEBUG
-      // avoid spamming the logs while busy waiting
-      DASH_LOG_DEBUG("waiting for event at gptr",
-                     static_cast<gptr_t>(_event_counts.begin()
-                                         +_team->myid().id));
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-#endif
-      current = gref.get();
-    } while (current < count);
-    // decrement the counter
-    gref.sub(count);
+    DASH_LOG_DEBUG("Coevent.wait()", "count:", count);
+    DASH_ASSERT_RETURNS(
+      dart_event_wait(_event, count),
+      DART_OK);
+  }
+
+  /**
+   * wait for a given number of incoming events until the given timeout
+   * expired.
+   * Events are only consumed if the given number of events arrived.
+   * Other than \c wait, this polls for the events with a bounded sleep
+   * interval.
+   *
+   * \return  \c true if the events arrived before the timeout expired,
+   *          \c false otherwise
+   */
+  template<class Rep, class Period>
+  inline bool wait_for(
+    const std::chrono::duration<Rep, Period> & timeout,
+    int count = 1) {
+    auto timeout_us = std::chrono::duration_cast<
+                        std::chrono::microseconds>(timeout).count();
+    int32_t signaled;
+    DASH_LOG_DEBUG("Coevent.wait_for()", "count:", count,
+                   "timeout us:", timeout_us);
+    DASH_ASSERT_RETURNS(
+      dart_event_timedwait(
+        _event, count,
+        static_cast<uint64_t>(std::max<decltype(timeout_us)>(timeout_us, 0)),
+        &signaled),
+      DART_OK);
+    return signaled != 0;
   }
 
   inline int test() {
     DASH_LOG_DEBUG("test for events on this unit");
-    return _event_counts.at(static_cast<int>(_team->myid())).load();
+    return this->operator()(_team->myid()).test();
   }
 
   /**
    * initializes the Coevent. If it was already initialized in the Ctor,
    * the second initialization is skipped.
    */
-  inline void initialize(Team & team = dash::Team::All()) noexcept {
+  inline void initialize(Team & team = dash::Team::All()) {
     if(!_is_initialized){
       _team = &team;
-      _event_counts.allocate(_team->size());
-      dash::fill(_event_counts.begin(), _event_counts.end(), 0);
-      _event_counts.barrier();
+      DASH_ASSERT_RETURNS(
+        dart_team_event_init(_team->dart_id(), &_event),
+        DART_OK);
+      // Free the event before the team is destroyed:
+      _team->register_deallocator(
+        this, std::bind(&Coevent::deallocate, this));
       _is_initialized = true;
     }
   }
@@ -135,8 +167,7 @@ public:
    */
   inline reference operator()(const int & unit) noexcept {
     DASH_ASSERT_MSG(dash::is_initialized(), "DASH is not initialized");
-    auto ptr = static_cast<gptr_t>(_event_counts.begin() + unit);
-    return reference(ptr);
+    return reference(_event, unit, *_team);
   }
 
   /**
@@ -147,8 +178,19 @@ public:
   }
 
 private:
-  Team * _team;
-  bool   _is_initialized = false;
+  void deallocate() {
+    if (_event != nullptr && dash::is_initialized()) {
+      DASH_ASSERT_RETURNS(
+        dart_team_event_destroy(&_event),
+        DART_OK);
+    }
+    _event = nullptr;
+  }
+
+private:
+  Team         * _team;
+  dart_event_t   _event          = nullptr;
+  bool           _is_initialized = false;
 };
 
 } // namespace dash
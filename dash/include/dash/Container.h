@@ -8,6 +8,7 @@
  * \see DashArrayConcept
  * \see DashMapConcept
  * \see DashMatrixConcept
+ * \see DashQueueConcept
  * \see DashViewConcept
  * \see DashRangeConcept
  * \see DashIteratorConcept
@@ -71,9 +72,13 @@
 #include<dash/Array.h>
 #include<dash/Matrix.h>
 #include<dash/Coarray.h>
+#include<dash/Bitset.h>
+#include<dash/BloomFilter.h>
+#include<dash/SparseMatrix.h>
 
 // Dynamic containers:
 #include<dash/List.h>
 #include<dash/UnorderedMap.h>
+#include<dash/Queue.h>
 
 #endif // DASH__CONTAINER_H_
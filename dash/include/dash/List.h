@@ -9,12 +9,15 @@
 #include <dash/Allocator.h>
 #include <dash/Array.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
 
 #include <dash/list/ListRef.h>
 #include <dash/list/LocalListRef.h>
 #include <dash/list/GlobListIter.h>
 #include <dash/list/internal/ListTypes.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <limits>
 #include <vector>
@@ -271,6 +274,21 @@ private:
   /// Default is 4 KB.
   size_type            _local_buffer_size
                          = 4096 / sizeof(value_type);
+  /// Segments receiving elements appended by remote units, one segment of
+  /// \c _append_capacity elements at every unit.
+  dash::Array<value_type> _append_slots;
+  /// Number of element slots reserved in the segment of every unit.
+  dash::Array<uint64_t>   _append_tails;
+  /// Number of elements that can be appended to a unit between two calls
+  /// of \c barrier without deferring them.
+  size_type            _append_capacity
+                         = 0;
+  /// Elements appended to remote units that exceeded the capacity of the
+  /// target's segment, appended in the next call of \c barrier.
+  std::vector<std::vector<value_type>> _append_deferred;
+  /// Elements inserted in \c push_back that have not been appended to the
+  /// last unit yet.
+  std::vector<value_type> _push_back_staged;
 
 public:
   /**
@@ -353,15 +371,75 @@ public:
    * inserted element.
    * Increases the container size by one.
    *
-   * The operation takes immediate effect for the calling unit.
-   * For other units, changes will only be visible after the next call of
+   * The element is appended to the local elements of the last unit in the
+   * list's team and is globally visible after the next call of
    * \c barrier.
-   * As one-sided, non-collective allocation on remote units is not possible
-   * with most DART communication backends, the new list element is allocated
-   * locally and moved to its final position in global memory in \c barrier.
+   *
+   * Elements are staged at the calling unit and appended to the last unit
+   * in batches of the list's local buffer size, so only one atomic
+   * reservation and one put per batch are required. All units inserting
+   * with \c push_back still target the last unit, use \c append to
+   * distribute elements among units.
+   *
+   * \see  append
    */
   void push_back(const value_type & element)
   {
+    _push_back_staged.push_back(element);
+    if (_push_back_staged.size() >= _local_buffer_size) {
+      flush_push_back();
+    }
+  }
+
+  /**
+   * Appends the given elements to the local elements of the specified
+   * unit.
+   *
+   * Lock-free operation: the calling unit reserves slots in a segment at
+   * the target unit using a single atomic fetch-and-add on the segment's
+   * tail and writes the elements to the reserved slots in a single
+   * one-sided put, so any number of units can append concurrently.
+   * Elements become local elements of the target unit and are globally
+   * visible after the next call of \c barrier.
+   * Elements exceeding the segment's capacity are buffered at the calling
+   * unit and transferred in \c barrier, which also increases the
+   * segment capacity to the largest number of elements appended to a
+   * unit.
+   */
+  void append(
+    team_unit_t        unit,
+    const value_type * values,
+    size_type          num_values)
+  {
+    DASH_LOG_TRACE("List.append()", "unit:", unit, "n:", num_values);
+    if (num_values == 0) {
+      return;
+    }
+    uint64_t n    = num_values;
+    uint64_t slot = 0;
+    auto tail_gptr = (_append_tails.begin() + unit.id).dart_gptr();
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(tail_gptr, &n, &slot,
+                        dash::dart_datatype<uint64_t>::value,
+                        DART_OP_SUM),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_flush(tail_gptr),
+      DART_OK);
+    size_type nput = 0;
+    if (slot < _append_capacity) {
+      nput = std::min<size_type>(num_values, _append_capacity - slot);
+      auto slot_gptr = (_append_slots.begin() +
+                        (unit.id * _append_capacity + slot)).dart_gptr();
+      dash::internal::put_blocking(slot_gptr, values, nput);
+    }
+    if (nput < num_values) {
+      DASH_LOG_TRACE("List.append", "segment capacity exceeded,",
+                     "deferring", num_values - nput, "elements");
+      auto & deferred = _append_deferred[unit.id];
+      deferred.insert(deferred.end(), values + nput, values + num_values);
+    }
+    DASH_LOG_TRACE("List.append >");
   }
 
   /**
@@ -591,6 +669,11 @@ public:
   void barrier()
   {
     DASH_LOG_TRACE_VAR("List.barrier()", _team);
+    // Move elements appended by remote units to local memory:
+    if (_append_capacity > 0) {
+      flush_push_back();
+      commit_appended();
+    }
     // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
       _globmem->commit();
@@ -642,6 +725,7 @@ public:
     DASH_LOG_TRACE_VAR("List.allocate", lcap);
 
     _globmem     = new glob_mem_type(lcap, *_team);
+    allocate_append_segments(_local_buffer_size);
     // Global iterators:
     _begin       = iterator(_globmem, _nil_node);
     _end         = _begin;
@@ -693,9 +777,88 @@ public:
     }
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
+    _append_capacity      = 0;
+    _push_back_staged.clear();
     DASH_LOG_TRACE_VAR("List.deallocate >", this);
   }
 
+private:
+  /**
+   * Allocate segments of the given capacity for elements appended by
+   * remote units.
+   */
+  void allocate_append_segments(size_type capacity)
+  {
+    DASH_LOG_TRACE_VAR("List.allocate_append_segments()", capacity);
+    auto nunits = _team->size();
+    _append_slots.deallocate();
+    _append_tails.deallocate();
+    _append_slots.allocate(capacity * nunits, dash::BLOCKED, *_team);
+    _append_tails.allocate(nunits, dash::BLOCKED, *_team);
+    _append_tails.local[0] = 0;
+    _append_capacity = capacity;
+    _append_deferred.resize(nunits);
+    _append_tails.barrier();
+  }
+
+  /**
+   * Append elements staged in \c push_back to the last unit.
+   */
+  void flush_push_back()
+  {
+    if (!_push_back_staged.empty()) {
+      append(team_unit_t(_team->size() - 1),
+             _push_back_staged.data(), _push_back_staged.size());
+      _push_back_staged.clear();
+    }
+  }
+
+  /**
+   * Move elements appended by remote units since the last call of
+   * \c barrier to local memory.
+   *
+   * Collective operation.
+   */
+  void commit_appended()
+  {
+    DASH_LOG_TRACE("List.commit_appended()");
+    while (true) {
+      // Complete appends of all units:
+      _append_tails.barrier();
+      if (_append_tails.size() == 0) {
+        // Segments have been freed in team deallocation:
+        _append_capacity = 0;
+        return;
+      }
+      uint64_t reserved = _append_tails.local[0];
+      local.append(_append_slots.lbegin(),
+                   std::min<uint64_t>(reserved, _append_capacity));
+      // Segments are increased to the largest number of elements appended
+      // to a unit if any appends have been deferred:
+      uint64_t max_reserved = 0;
+      DASH_ASSERT_RETURNS(
+        dart_allreduce(&reserved, &max_reserved, 1,
+                       dash::dart_datatype<uint64_t>::value,
+                       DART_OP_MAX, _team->dart_id()),
+        DART_OK);
+      if (max_reserved <= _append_capacity) {
+        _append_tails.local[0] = 0;
+        _append_tails.barrier();
+        break;
+      }
+      allocate_append_segments(
+        std::max<size_type>(max_reserved, 2 * _append_capacity));
+      for (int u = 0; u < _team->size(); ++u) {
+        auto & deferred = _append_deferred[u];
+        if (!deferred.empty()) {
+          append(team_unit_t(u), deferred.data(), deferred.size());
+          deferred.clear();
+        }
+      }
+    }
+    DASH_LOG_TRACE("List.commit_appended >");
+  }
+
 };
 
 } // namespace dash
@@ -10,6 +10,7 @@
 #include <dash/Allocator.h>
 #include <dash/HView.h>
 #include <dash/Meta.h>
+#include <dash/ReadCache.h>
 
 #include <dash/iterator/GlobIter.h>
 
@@ -440,6 +441,21 @@ public:
    */
   constexpr const Pattern_t & pattern() const;
 
+  /**
+   * The instance of \c GlobStaticMem used by this matrix to resolve
+   * addresses in global memory.
+   */
+  constexpr const GlobMem_t & globmem() const noexcept;
+
+  /**
+   * Software cache for reads of remote matrix elements.
+   * Arguments are forwarded to the constructor of \c dash::ReadCache.
+   *
+   * \see  dash::ReadCache
+   */
+  template<typename ... Args>
+  ReadCache<self_t> cached(Args && ... args) const;
+
   /**
    * Iterator referencing first matrix element in global index space.
    *
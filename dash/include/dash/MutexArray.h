@@ -0,0 +1,119 @@
+#ifndef DASH__MUTEX_ARRAY_H__INCLUDED
+#define DASH__MUTEX_ARRAY_H__INCLUDED
+
+#include <dash/Team.h>
+
+#include <cstddef>
+
+namespace dash {
+
+/**
+ * Fixed-size array of mutexes used to ensure mutual exclusion on
+ * individual elements of a shared data structure within a dash team,
+ * e.g. for per-bucket locking.
+ *
+ * In contrast to a \c std::vector of \c dash::Mutex, all locks of the
+ * array share a single global memory segment and the queues of different
+ * locks are distributed over the units of the team.
+ *
+ * \note Elements work properly with \c std::lock_guard
+ * \note MutexArray cannot be placed in DASH containers
+ *
+ * \code
+ * dash::MutexArray mxa(nbuckets);
+ * {
+ *    auto mx = mxa[bucket_idx];
+ *    std::lock_guard<dash::MutexArray::reference> lg(mx);
+ *    // ... modify bucket
+ * }
+ * \endcode
+ */
+class MutexArray {
+private:
+  using self_t = MutexArray;
+
+public:
+  /**
+   * Proxy referencing a single lock in the array, satisfies the
+   * Lockable concept.
+   */
+  class reference {
+  public:
+    reference(MutexArray & array, size_t idx)
+    : _array(&array), _idx(idx)
+    { }
+
+    void lock()     { _array->lock(_idx); }
+    bool try_lock() { return _array->try_lock(_idx); }
+    void unlock()   { _array->unlock(_idx); }
+
+  private:
+    MutexArray * _array;
+    size_t       _idx;
+  };
+
+public:
+  /**
+   * Creates an array of \c nlocks mutexes for the given team, team all
+   * if no team is passed.
+   *
+   * This function is not thread-safe
+   * @param nlocks number of mutexes in the array
+   * @param team   team for mutual exclusive accesses
+   */
+  explicit MutexArray(
+    size_t nlocks,
+    Team & team = dash::Team::All());
+
+  MutexArray(const MutexArray & other)     = delete;
+  MutexArray(MutexArray && other)          = delete;
+
+  self_t & operator=(const self_t & other) = delete;
+  self_t & operator=(self_t && other)      = delete;
+
+  /**
+   * Collective destructor to destruct the DART lock array.
+   *
+   * This function is not thread-safe
+   */
+  ~MutexArray();
+
+  /**
+   * Number of mutexes in the array.
+   */
+  size_t size() const noexcept {
+    return _nlocks;
+  }
+
+  /**
+   * Reference to the mutex at the given index.
+   */
+  reference operator[](size_t idx) {
+    return reference(*this, idx);
+  }
+
+  /**
+   * Block until the mutex at the given index was acquired.
+   */
+  void lock(size_t idx);
+
+  /**
+   * Try to acquire the mutex at the given index and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock(size_t idx);
+
+  /**
+   * Release the mutex at the given index acquired through \c lock() or
+   * \c try_lock().
+   */
+  void unlock(size_t idx);
+
+private:
+  dart_lock_array_t _locks;
+  size_t            _nlocks;
+}; // class MutexArray
+
+} // namespace dash
+
+#endif // DASH__MUTEX_ARRAY_H__INCLUDED
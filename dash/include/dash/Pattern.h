@@ -624,6 +624,7 @@ public:
 #include <dash/pattern/TilePattern.h>
 #include <dash/pattern/ShiftTilePattern.h>
 #include <dash/pattern/SeqTilePattern.h>
+#include <dash/pattern/CurveTilePattern.h>
 
 // Static irregular pattern types:
 #include <dash/pattern/CSRPattern.h>
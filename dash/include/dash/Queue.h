@@ -0,0 +1,418 @@
+#ifndef DASH__QUEUE_H__INCLUDED
+#define DASH__QUEUE_H__INCLUDED
+
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/Onesided.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+
+namespace dash {
+
+/**
+ * \defgroup  DashQueueConcept  Queue Concept
+ * Concept of a distributed concurrent queue.
+ *
+ * \ingroup DashContainerConcept
+ * \{
+ * \par Description
+ *
+ * A distributed queue consists of one bounded FIFO queue per unit in a
+ * team. Any unit can append elements to the queue of any unit and remove
+ * elements from the front of any unit's queue without participation of
+ * the owning unit, e.g. to distribute irregular work items and to balance
+ * load by work stealing.
+ *
+ * \par Member Functions
+ *
+ * Return Type              | Method              | Parameters                           | Description
+ * ------------------------ | ------------------- | ------------------------------------ | ------------------------------------------------------------
+ * <tt>bool</tt>            | <tt>push</tt>       | <tt>unit u, value_type v</tt>        | Append an element to the queue of unit \c u.
+ * <tt>bool</tt>            | <tt>push</tt>       | <tt>unit u, value_type * v, n</tt>   | Append \c n elements to the queue of unit \c u at once.
+ * <tt>size_type</tt>       | <tt>pop</tt>        | <tt>value_type * out, n</tt>         | Remove up to \c n elements from the local queue.
+ * <tt>size_type</tt>       | <tt>steal</tt>      | <tt>unit u, value_type * out, n</tt> | Remove a batch of up to \c n elements from the queue of unit \c u.
+ * <tt>size_type</tt>       | <tt>size</tt>       | <tt>unit u</tt>                      | Number of elements in the queue of unit \c u.
+ * <tt>size_type</tt>       | <tt>capacity</tt>   | &nbsp;                               | Maximum number of elements in the queue of a single unit.
+ *
+ * \}
+ */
+
+/**
+ * A distributed concurrent queue with one bounded ring buffer per unit
+ * in global memory.
+ *
+ * Positions in the ring buffers are 32-bit counters in modular arithmetic
+ * so the local capacity is rounded up to the next power of two.
+ *
+ * Elements are appended by reserving slots in the target unit's ring
+ * buffer with a single atomic update of its tail, copying the elements
+ * with a one-sided put and publishing every slot by an atomic update of
+ * its sequence number. Consumers claim a range of published elements
+ * from the front of a queue with a single atomic update of its head, so
+ * a thief obtains a whole batch of work items at once.
+ * Appending to a full queue does not block but fails.
+ *
+ * \code
+ *   dash::Queue<vertex_t> frontier(max_local_vertices);
+ *   // ... frontier.push(owner(v), v) for all discovered vertices
+ *   std::vector<vertex_t> batch(64);
+ *   size_t n;
+ *   while ((n = frontier.pop(batch.data(), batch.size())) > 0 ||
+ *          (n = frontier.steal(batch.data(), batch.size())) > 0) {
+ *     process(batch.data(), n);
+ *   }
+ * \endcode
+ *
+ * \tparam  ElementType  Type of the elements in the queue, must be
+ *                       trivially copyable.
+ *
+ * \concept{DashQueueConcept}
+ */
+template<typename ElementType>
+class Queue {
+  static_assert(
+    std::is_trivially_copyable<ElementType>::value,
+    "Element type of dash::Queue must be trivially copyable");
+
+private:
+  typedef Queue<ElementType>                           self_t;
+  typedef uint32_t                                    counter_t;
+  typedef dash::Atomic<counter_t>                atomic_counter_t;
+  typedef dash::Array<atomic_counter_t>          counter_array_t;
+  typedef dash::GlobRef<atomic_counter_t>          counter_ref_t;
+
+  enum ctrl_index : int {
+    HEAD = 0,
+    TAIL = 1,
+    NCTRL
+  };
+
+public:
+  typedef ElementType                                 value_type;
+  typedef size_t                                       size_type;
+
+public:
+  /**
+   * Constructor, allocates a queue with capacity for \c local_capacity
+   * elements at every unit in the given team.
+   *
+   * Collective operation.
+   */
+  explicit Queue(
+    /// Maximum number of elements in the queue of a single unit
+    size_type   local_capacity,
+    /// Team containing all units accessing the queue
+    Team      & team = dash::Team::All())
+  : _team(&team),
+    _myid(team.myid()),
+    _capacity(ring_capacity(local_capacity)),
+    _data(_capacity * team.size(), team),
+    _seq(_capacity * team.size(), team),
+    _ctrl(NCTRL * team.size(), team)
+  {
+    // Every slot is published for the first time at its own position:
+    for (size_type slot = 0; slot < _capacity; ++slot) {
+      _seq.lbegin()[slot] = atomic_counter_t(slot);
+    }
+    _ctrl.lbegin()[HEAD] = atomic_counter_t(0);
+    _ctrl.lbegin()[TAIL] = atomic_counter_t(0);
+    _team->barrier();
+  }
+
+  Queue(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Append an element to the queue of the calling unit.
+   *
+   * \return  \c true if the element was appended, \c false if the queue
+   *          is full.
+   */
+  bool push(const value_type & value)
+  {
+    return push(_myid, &value, 1);
+  }
+
+  /**
+   * Append an element to the queue of the given unit.
+   *
+   * \return  \c true if the element was appended, \c false if the queue
+   *          is full.
+   */
+  bool push(team_unit_t unit, const value_type & value)
+  {
+    return push(unit, &value, 1);
+  }
+
+  /**
+   * Append \c n elements to the queue of the given unit, either all or
+   * none of the elements are appended.
+   *
+   * \return  \c true if the elements were appended, \c false if the queue
+   *          does not have sufficient free capacity.
+   *
+   * \complexity  One atomic update to reserve the slots, one or two
+   *              one-sided puts and \c n atomic updates to publish the
+   *              elements.
+   */
+  bool push(team_unit_t unit, const value_type * values, size_type n)
+  {
+    DASH_LOG_TRACE("Queue.push()", "unit:", unit, "n:", n);
+    if (n == 0) {
+      return true;
+    }
+    if (n > _capacity) {
+      return false;
+    }
+    auto head = ctrl(unit, HEAD);
+    auto tail = ctrl(unit, TAIL);
+    // Reserve n slots at the tail:
+    counter_t pos = tail.load();
+    for (;;) {
+      counter_t used = static_cast<counter_t>(pos - head.load());
+      if (used > _capacity) {
+        // Head has moved past the stale tail position:
+        pos = tail.load();
+        continue;
+      }
+      if (used + n > _capacity) {
+        // Queue is full unless the tail changed since it has been read:
+        counter_t cur = tail.load();
+        if (cur == pos) {
+          DASH_LOG_TRACE("Queue.push >", "queue full");
+          return false;
+        }
+        pos = cur;
+        continue;
+      }
+      if (tail.compare_exchange(pos, static_cast<counter_t>(pos + n))) {
+        break;
+      }
+      pos = tail.load();
+    }
+    // Wait until consumers of the previous round released the slots:
+    for (size_type i = 0; i < n; ++i) {
+      auto seq = slot_seq(unit, pos + i);
+      while (seq.load() != static_cast<counter_t>(pos + i)) { }
+    }
+    transfer_slots(unit, pos, n, [&](dart_gptr_t gptr, size_type offset,
+                                     size_type nelem) {
+      dash::internal::put_blocking(gptr, values + offset, nelem);
+    });
+    // Publish the elements:
+    for (size_type i = 0; i < n; ++i) {
+      slot_seq(unit, pos + i).store(static_cast<counter_t>(pos + i + 1));
+    }
+    DASH_LOG_TRACE("Queue.push >", "position:", pos);
+    return true;
+  }
+
+  /**
+   * Remove up to \c n elements from the front of the calling unit's queue.
+   *
+   * \return  The number of elements removed and stored in \c out.
+   */
+  size_type pop(value_type * out, size_type n = 1)
+  {
+    return claim(_myid, out, n, false);
+  }
+
+  /**
+   * Remove a batch of elements from the front of the queue of unit
+   * \c victim, at most \c n elements and half of the elements in the
+   * victim's queue.
+   *
+   * \return  The number of elements stolen and stored in \c out.
+   *
+   * \complexity  Two atomic reads of head and tail, one atomic read per
+   *              element to verify it is published, a single atomic
+   *              update to claim the batch and one or two one-sided gets.
+   */
+  size_type steal(team_unit_t victim, value_type * out, size_type n)
+  {
+    return claim(victim, out, n, true);
+  }
+
+  /**
+   * Steal a batch of at most \c n elements from the first unit with a
+   * non-empty queue, starting at the victim following the one of the
+   * last successful steal. The victim of the last successful steal is
+   * tried last.
+   *
+   * \return  The number of elements stolen and stored in \c out.
+   */
+  size_type steal(value_type * out, size_type n)
+  {
+    const auto nunits = _team->size();
+    for (size_type i = 1; i <= nunits; ++i) {
+      team_unit_t victim((_last_victim.id + i) % nunits);
+      if (victim == _myid) {
+        continue;
+      }
+      auto nstolen = steal(victim, out, n);
+      if (nstolen > 0) {
+        _last_victim = victim;
+        return nstolen;
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * Number of elements in the queue of the given unit including elements
+   * that are not published yet.
+   */
+  size_type size(team_unit_t unit) const
+  {
+    counter_t head = ctrl(unit, HEAD).load();
+    counter_t tail = ctrl(unit, TAIL).load();
+    return static_cast<counter_t>(tail - head);
+  }
+
+  /**
+   * Number of elements in the queue of the calling unit.
+   */
+  size_type local_size() const
+  {
+    return size(_myid);
+  }
+
+  /**
+   * Whether the queue of the calling unit is empty.
+   */
+  bool empty() const
+  {
+    return local_size() == 0;
+  }
+
+  /**
+   * Maximum number of elements in the queue of a single unit, the
+   * capacity requested at construction rounded up to the next power of two.
+   */
+  constexpr size_type capacity() const noexcept
+  {
+    return _capacity;
+  }
+
+  inline Team & team() const noexcept
+  {
+    return *_team;
+  }
+
+  inline void barrier() const
+  {
+    _team->barrier();
+  }
+
+private:
+  counter_ref_t ctrl(team_unit_t unit, ctrl_index idx) const
+  {
+    return counter_ref_t(
+             (_ctrl.begin() + (unit.id * NCTRL + idx)).dart_gptr());
+  }
+
+  counter_ref_t slot_seq(team_unit_t unit, counter_t pos) const
+  {
+    return counter_ref_t(
+             (_seq.begin() + (unit.id * _capacity + (pos & (_capacity - 1))))
+               .dart_gptr());
+  }
+
+  /**
+   * Applies the given transfer to the contiguous ranges of slots at
+   * positions \c [pos, pos + n) in the ring buffer of \c unit.
+   */
+  template<typename TransferFun>
+  void transfer_slots(
+    team_unit_t unit, counter_t pos, size_type n, TransferFun && transfer)
+    const
+  {
+    size_type first = static_cast<size_type>(pos & (_capacity - 1));
+    size_type nhead = std::min(n, _capacity - first);
+    transfer((_data.begin() + (unit.id * _capacity + first)).dart_gptr(),
+             0, nhead);
+    if (nhead < n) {
+      transfer((_data.begin() + (unit.id * _capacity)).dart_gptr(),
+               nhead, n - nhead);
+    }
+  }
+
+  static size_type ring_capacity(size_type local_capacity)
+  {
+    DASH_ASSERT_GT(local_capacity, 0, "Queue capacity must be positive");
+    DASH_ASSERT_LT(local_capacity, size_type(1) << 31,
+                   "Queue capacity exceeds 2^31 elements");
+    size_type capacity = 1;
+    while (capacity < local_capacity) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  size_type claim(
+    team_unit_t   unit,
+    value_type  * out,
+    size_type     n,
+    bool          half)
+  {
+    auto head = ctrl(unit, HEAD);
+    auto tail = ctrl(unit, TAIL);
+    counter_t pos;
+    size_type nclaim;
+    for (;;) {
+      pos = head.load();
+      counter_t avail = tail.load() - pos;
+      if (avail == 0 || n == 0) {
+        return 0;
+      }
+      nclaim = std::min<size_type>(
+                 n, half ? (avail + 1) / 2 : avail);
+      // Only claim elements that have been published:
+      for (size_type i = 0; i < nclaim; ++i) {
+        if (slot_seq(unit, pos + i).load() !=
+            static_cast<counter_t>(pos + i + 1)) {
+          nclaim = i;
+          break;
+        }
+      }
+      if (nclaim == 0) {
+        return 0;
+      }
+      if (head.compare_exchange(pos, static_cast<counter_t>(pos + nclaim))) {
+        break;
+      }
+    }
+    transfer_slots(unit, pos, nclaim, [&](dart_gptr_t gptr, size_type offset,
+                                          size_type nelem) {
+      dash::internal::get_blocking(gptr, out + offset, nelem);
+    });
+    // Release the slots to producers of the next round:
+    for (size_type i = 0; i < nclaim; ++i) {
+      slot_seq(unit, pos + i).store(
+        static_cast<counter_t>(pos + i + _capacity));
+    }
+    DASH_LOG_TRACE("Queue.claim >", "unit:", unit, "position:", pos,
+                   "n:", nclaim);
+    return nclaim;
+  }
+
+private:
+  Team                    * _team;
+  team_unit_t               _myid;
+  size_type                 _capacity;
+  dash::Array<value_type>   _data;
+  counter_array_t           _seq;
+  counter_array_t           _ctrl;
+  team_unit_t               _last_victim {0};
+};
+
+} // namespace dash
+
+#endif // DASH__QUEUE_H__INCLUDED
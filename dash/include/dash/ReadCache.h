@@ -0,0 +1,289 @@
+#ifndef DASH__READ_CACHE_H__INCLUDED
+#define DASH__READ_CACHE_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+#include <dash/Types.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Software cache for reads of remote elements of a DASH container.
+ *
+ * Remote elements are read in lines of consecutive elements in the local
+ * memory of their owning unit and stored in a set-associative cache with
+ * least-recently-used replacement. Reads of elements in the calling unit's
+ * local memory bypass the cache.
+ *
+ * The cache is not coherent: elements modified after they have been
+ * cached are only read again after \c invalidate(), typically called at
+ * the synchronization points separating phases of reads and updates.
+ * Cached lines are discarded automatically if the container's global
+ * memory, size or local capacity changed since they have been read, e.g.
+ * in \c dash::Array::resize or \c dash::Array::reserve.
+ *
+ * \code
+ *   auto cache = graph_weights.cached();
+ *   for (auto e : edges) {
+ *     sum += cache[e.target];
+ *   }
+ *   graph_weights.barrier();
+ *   cache.invalidate();
+ * \endcode
+ *
+ * \tparam  ContainerType  Type of the container, model of
+ *                         \c DashContainerConcept with static global
+ *                         memory (\c dash::Array, \c dash::Matrix).
+ */
+template<typename ContainerType>
+class ReadCache {
+private:
+  typedef ReadCache<ContainerType>                    self_t;
+
+public:
+  typedef typename ContainerType::value_type       value_type;
+  typedef typename ContainerType::index_type       index_type;
+  typedef typename ContainerType::size_type         size_type;
+  typedef typename ContainerType::pattern_type   pattern_type;
+
+  static constexpr dim_t NumDimensions = ContainerType::ndim();
+
+  /// Default number of bytes in a cache line.
+  static constexpr size_type DefaultLineBytes = 256;
+  /// Default number of sets.
+  static constexpr size_type DefaultNumSets   = 256;
+  /// Default number of lines in a set.
+  static constexpr size_type DefaultNumWays   = 4;
+
+private:
+  struct line_tag {
+    /// Owner of the cached elements, -1 if the line is invalid
+    dart_unit_t   unit      = -1;
+    /// Index of the line in the owner's local memory
+    index_type    line      = -1;
+    /// Time of the last access of the line
+    uint64_t      last_use  = 0;
+  };
+
+public:
+  /**
+   * Creates a cache of \c nsets sets of \c nways lines of \c line_size
+   * elements each for reads of the given container.
+   *
+   * A cache with a single way per set is direct-mapped.
+   */
+  explicit ReadCache(
+    const ContainerType & container,
+    size_type             line_size = std::max<size_type>(
+                                        1,
+                                        DefaultLineBytes /
+                                          sizeof(value_type)),
+    size_type             nsets     = DefaultNumSets,
+    size_type             nways     = DefaultNumWays)
+  : _container(&container),
+    _myid(container.team().myid()),
+    _line_size(std::max<size_type>(line_size, 1)),
+    _nsets(std::max<size_type>(nsets, 1)),
+    _nways(std::max<size_type>(nways, 1)),
+    _tags(_nsets * _nways),
+    _lines(_nsets * _nways * _line_size)
+  {
+    DASH_LOG_TRACE("ReadCache()",
+                   "line size:", _line_size,
+                   "sets:",      _nsets,
+                   "ways:",      _nways);
+  }
+
+  /**
+   * Read the element at the given global index.
+   */
+  value_type operator[](index_type g_index)
+  {
+    return get(_container->pattern().local(g_index));
+  }
+
+  /**
+   * Read the element at the given global coordinates.
+   */
+  template<typename ... Indices>
+  value_type operator()(Indices ... coords)
+  {
+    static_assert(sizeof...(Indices) == NumDimensions,
+                  "ReadCache: number of coordinates does not match the "
+                  "container's number of dimensions");
+    return at(std::array<index_type, NumDimensions> {{
+                static_cast<index_type>(coords)... }});
+  }
+
+  /**
+   * Read the element at the given global coordinates.
+   */
+  value_type at(const std::array<index_type, NumDimensions> & g_coords)
+  {
+    return get(_container->pattern().local_index(g_coords));
+  }
+
+  /**
+   * Discard all cached lines. Elements are read from their owner on their
+   * next access.
+   */
+  void invalidate()
+  {
+    DASH_LOG_TRACE("ReadCache.invalidate()");
+    std::fill(_tags.begin(), _tags.end(), line_tag());
+  }
+
+  /// Number of reads of remote elements served from the cache.
+  uint64_t hits() const noexcept
+  {
+    return _hits;
+  }
+
+  /// Number of reads of remote elements that fetched a line.
+  uint64_t misses() const noexcept
+  {
+    return _misses;
+  }
+
+  /// Reset hit and miss counters.
+  void reset_stats() noexcept
+  {
+    _hits   = 0;
+    _misses = 0;
+  }
+
+  /// Number of elements in a cache line.
+  size_type line_size() const noexcept
+  {
+    return _line_size;
+  }
+
+  /// Number of lines the cache can hold.
+  size_type num_lines() const noexcept
+  {
+    return _nsets * _nways;
+  }
+
+private:
+  template<typename LocalIndexT>
+  value_type get(const LocalIndexT & l_index)
+  {
+    if (l_index.unit == _myid) {
+      return _container->lbegin()[l_index.index];
+    }
+    check_layout();
+    const dart_unit_t unit   = l_index.unit.id;
+    const index_type  line   = l_index.index / _line_size;
+    const size_type   offset = l_index.index % _line_size;
+    const size_type   set    = set_index(unit, line);
+    line_tag *        ways   = _tags.data() + set * _nways;
+    ++_clock;
+
+    size_type victim = 0;
+    for (size_type w = 0; w < _nways; ++w) {
+      if (ways[w].unit == unit && ways[w].line == line) {
+        ++_hits;
+        ways[w].last_use = _clock;
+        return line_data(set, w)[offset];
+      }
+      if (ways[w].last_use < ways[victim].last_use) {
+        victim = w;
+      }
+    }
+    ++_misses;
+    fetch(unit, line, set, victim);
+    ways[victim].unit     = unit;
+    ways[victim].line     = line;
+    ways[victim].last_use = _clock;
+    return line_data(set, victim)[offset];
+  }
+
+  void fetch(
+    dart_unit_t  unit,
+    index_type   line,
+    size_type    set,
+    size_type    way)
+  {
+    const size_type first = line * _line_size;
+    const size_type count = std::min(_line_size, _lcapacity - first);
+    DASH_LOG_TRACE("ReadCache.fetch()",
+                   "unit:", unit, "line:", line, "count:", count);
+    auto gptr = _container->globmem().at(team_unit_t(unit), first);
+    dash::internal::get_blocking(
+      gptr.dart_gptr(), line_data(set, way), count);
+  }
+
+  /**
+   * Discards all cached lines if the container has been reallocated or
+   * resized since the lines have been read.
+   */
+  void check_layout()
+  {
+    const void *    globmem   = &_container->globmem();
+    const size_type size      = _container->size();
+    const size_type lcapacity = _container->pattern().local_capacity();
+    if (globmem != _globmem || size != _size || lcapacity != _lcapacity) {
+      invalidate();
+      _globmem   = globmem;
+      _size      = size;
+      _lcapacity = lcapacity;
+    }
+  }
+
+  size_type set_index(dart_unit_t unit, index_type line) const
+  {
+    // Consecutive lines of a unit are mapped to consecutive sets, the
+    // first set of a unit's lines is scattered to avoid conflicts between
+    // lines at identical offsets at different units:
+    uint64_t first = static_cast<uint64_t>(unit) * 0x9e3779b97f4a7c15ULL;
+    first ^= first >> 29;
+    return static_cast<size_type>(
+             (first + static_cast<uint64_t>(line)) % _nsets);
+  }
+
+  value_type * line_data(size_type set, size_type way)
+  {
+    return _lines.data() + (set * _nways + way) * _line_size;
+  }
+
+private:
+  const ContainerType       * _container;
+  team_unit_t                 _myid;
+  /// Global memory, size and local capacity of the container the cached
+  /// lines have been read from
+  const void                * _globmem   = nullptr;
+  size_type                   _size      = 0;
+  size_type                   _lcapacity = 0;
+  size_type                   _line_size;
+  size_type                   _nsets;
+  size_type                   _nways;
+  std::vector<line_tag>       _tags;
+  std::vector<value_type>     _lines;
+  uint64_t                    _clock  = 0;
+  uint64_t                    _hits   = 0;
+  uint64_t                    _misses = 0;
+};
+
+template<typename ContainerType>
+constexpr dim_t ReadCache<ContainerType>::NumDimensions;
+template<typename ContainerType>
+constexpr typename ReadCache<ContainerType>::size_type
+ReadCache<ContainerType>::DefaultLineBytes;
+template<typename ContainerType>
+constexpr typename ReadCache<ContainerType>::size_type
+ReadCache<ContainerType>::DefaultNumSets;
+template<typename ContainerType>
+constexpr typename ReadCache<ContainerType>::size_type
+ReadCache<ContainerType>::DefaultNumWays;
+
+} // namespace dash
+
+#endif // DASH__READ_CACHE_H__INCLUDED
@@ -2,39 +2,67 @@
 #define DASH__SHARED_COUNTER_H_
 
 #include <dash/Array.h>
+#include <dash/Onesided.h>
+#include <dash/Types.h>
+
+#include <chrono>
+#include <vector>
 
 namespace dash {
 
 /**
- * A simple shared counter that allows atomic increment-
- * and decrement operations.
+ * A shared counter that allows atomic increment- and decrement
+ * operations.
+ *
+ * Every unit accumulates its increments and decrements in its own
+ * contribution which is updated atomically without communication.
+ * The counter value is the sum of all units' contributions and can be
+ * obtained
+ *
+ * - exactly and one-sided using \c get(), which reads all contributions
+ *   atomically in a single round of non-blocking transfers,
+ * - exactly and collectively using \c allreduce() in O(log u) steps, or
+ * - approximately using \c get_relaxed() which returns the total obtained
+ *   in the last refresh, adjusted by the calling unit's own contribution,
+ *   and only communicates if the refresh interval has passed.
  *
- * TODO: Should probably be based on MPI_ACCUMULATE.
+ * \code
+ *   dash::SharedCounter<size_t> work_done;
+ *   while (work_done.get_relaxed() < total_work) {
+ *     work_done.inc(process_next());
+ *   }
+ * \endcode
  */
 template<typename ValueType = int>
 class SharedCounter {
 private:
-  typedef SharedCounter<ValueType> self_t;
+  typedef SharedCounter<ValueType>   self_t;
+  typedef std::chrono::steady_clock  clock_t;
+
+public:
+  /**
+   * Default interval after which the cached total returned by
+   * \c get_relaxed() is refreshed.
+   */
+  static constexpr std::chrono::microseconds DefaultRefreshInterval {
+    1000 };
 
 public:
   /**
    * Constructor.
    */
   SharedCounter()
-  : _num_units(dash::Team::All().size()),
-    _myid(dash::Team::All().myid()),
-    _local_counts(_num_units)
-  {
-    _local_counts.local[0] = 0;
-    _local_counts.barrier();
-  }
+  : SharedCounter(dash::Team::All())
+  { }
 
   SharedCounter(dash::Team& team)
-  : _num_units(team.size()),
+  : _team(&team),
+    _num_units(team.size()),
     _myid(team.myid()),
     _local_counts(_num_units, team)
   {
     _local_counts.local[0] = 0;
+    _my_gptr = (_local_counts.begin() + _myid.id).dart_gptr();
     _local_counts.barrier();
   }
 
@@ -45,7 +73,7 @@ public:
     /// Increment value
     ValueType increment)
   {
-    _local_counts[_myid] += increment;
+    update(increment);
   }
 
   /**
@@ -55,37 +83,148 @@ public:
     /// Decrement value
     ValueType increment)
   {
-    _local_counts[_myid] -= increment;
+    update(-increment);
   }
 
   /**
    * Read the current value of the shared counter.
    * Accumulates increment/decrement values of every unit.
-   * Reading a shared is not atomic, use Team::barrier() to synchronize.
+   * Contributions of other units are read atomically but not at the same
+   * instant, use Team::barrier() to obtain a consistent total.
    *
-   * \complexity  O(u) for \c u units in the associated team
+   * \complexity  O(u) atomic reads completed in a single round trip for
+   *              \c u units in the associated team
    */
   ValueType get() const
   {
-    ValueType acc = 0;
+    std::vector<ValueType> counts(_num_units);
+    ValueType              nothing = 0;
     for (team_unit_t i{0}; i < _num_units; ++i) {
-      // use local access on own counter value:
-      acc += (i == _myid
-                ? _local_counts.local[0]
-                : _local_counts[i]);
+      if (i != _myid) {
+        // Atomic read as contributions are updated using accumulate:
+        DASH_ASSERT_RETURNS(
+          dart_fetch_and_op(
+            (_local_counts.begin() + i.id).dart_gptr(),
+            &nothing,
+            &counts[i.id],
+            dash::dart_punned_datatype<ValueType>::value,
+            DART_OP_NO_OP),
+          DART_OK);
+      }
+    }
+    // use local access on own counter value:
+    counts[_myid.id] = _local_counts.local[0];
+    DASH_ASSERT_RETURNS(
+      dart_flush_local_all(_local_counts.begin().dart_gptr()),
+      DART_OK);
+
+    ValueType acc = 0;
+    for (const auto & count : counts) {
+      acc += count;
     }
+    refresh(acc, counts[_myid.id]);
     return acc;
   }
 
+  /**
+   * Read the current value of the shared counter in a collective
+   * reduction over all units in the associated team.
+   *
+   * \complexity  O(log u) for \c u units in the associated team
+   */
+  ValueType allreduce() const
+  {
+    ValueType own = _local_counts.local[0];
+    ValueType acc = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &own, &acc, 1,
+        dash::dart_punned_datatype<ValueType>::value,
+        DART_OP_SUM,
+        _team->dart_id()),
+      DART_OK);
+    refresh(acc, own);
+    return acc;
+  }
+
+  /**
+   * Approximate value of the shared counter.
+   * Returns the total obtained in the last call of \c get() or
+   * \c allreduce() including all increments and decrements of the calling
+   * unit since then. The total is refreshed using \c get() if it is older
+   * than the refresh interval.
+   *
+   * \complexity  O(1), O(u) if the cached total is refreshed
+   */
+  ValueType get_relaxed() const
+  {
+    if (!_cache_valid ||
+        clock_t::now() - _cached_at >= _refresh_interval) {
+      return get();
+    }
+    return _cached_total - _cached_own + _local_counts.local[0];
+  }
+
+  /**
+   * Set the interval after which the cached total returned by
+   * \c get_relaxed() is refreshed.
+   */
+  void set_refresh_interval(std::chrono::microseconds interval)
+  {
+    _refresh_interval = interval;
+  }
+
+private:
+  void update(ValueType delta)
+  {
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(
+        _my_gptr,
+        reinterpret_cast<const void *>(&delta),
+        1,
+        dash::dart_punned_datatype<ValueType>::value,
+        DART_OP_SUM),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_flush(_my_gptr),
+      DART_OK);
+  }
+
+  void refresh(ValueType total, ValueType own) const
+  {
+    _cached_total = total;
+    _cached_own   = own;
+    _cached_at    = clock_t::now();
+    _cache_valid  = true;
+  }
+
 private:
+  /// The team associated with the counter
+  dash::Team                 * _team;
   /// The number of units interacting with the counter
-  size_t                 _num_units;
+  size_t                       _num_units;
   /// The DART id of the unit that created this local counter intance
-  team_unit_t            _myid;
+  team_unit_t                  _myid;
   /// Buffer containing counter increments/decrements of every unit
-  dash::Array<ValueType> _local_counts;
+  dash::Array<ValueType>       _local_counts;
+  /// Global pointer to the contribution of the calling unit
+  dart_gptr_t                  _my_gptr          = DART_GPTR_NULL;
+  /// Interval after which the cached total is refreshed
+  std::chrono::microseconds    _refresh_interval = DefaultRefreshInterval;
+  /// Total obtained in the last refresh
+  mutable ValueType            _cached_total     = 0;
+  /// Own contribution at the last refresh
+  mutable ValueType            _cached_own       = 0;
+  /// Time of the last refresh
+  mutable clock_t::time_point  _cached_at;
+  /// Whether the cached total has been obtained
+  mutable bool                 _cache_valid      = false;
 };
 
+template<typename ValueType>
+constexpr std::chrono::microseconds
+SharedCounter<ValueType>::DefaultRefreshInterval;
+
 } // namespace dash
 
 #endif // DASH__SHARED_COUNTER_H_
@@ -0,0 +1,99 @@
+#ifndef DASH__SHARED_MUTEX_H__INCLUDED
+#define DASH__SHARED_MUTEX_H__INCLUDED
+
+#include <dash/Team.h>
+
+namespace dash {
+
+/**
+ * Behaves similar to \c std::shared_timed_mutex and is used to ensure
+ * mutual exclusion of writers and concurrent access of readers within a
+ * dash team.
+ *
+ * Units waiting for exclusive access block new readers, so writers are
+ * not starved by a continuous stream of readers.
+ *
+ * \note This works properly with \c std::lock_guard and
+ *       \c std::shared_lock
+ * \note SharedMutex cannot be placed in DASH containers
+ *
+ * \code
+ * dash::SharedMutex mx; // mutex for dash::Team::All();
+ * dash::Shared<int> table;
+ * {
+ *    std::shared_lock<dash::SharedMutex> sl(mx);
+ *    int value = table.get();
+ * }
+ * {
+ *    std::lock_guard<dash::SharedMutex> lg(mx);
+ *    table.set(42);
+ * }
+ * \endcode
+ */
+class SharedMutex {
+private:
+  using self_t = SharedMutex;
+
+public:
+  /**
+   * DASH SharedMutex is only valid for a dash team. If no team is passed,
+   * team all is used.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  explicit SharedMutex(Team & team = dash::Team::All());
+
+  SharedMutex(const SharedMutex & other)   = delete;
+  SharedMutex(SharedMutex && other)        = delete;
+
+  self_t & operator=(const self_t & other) = delete;
+  self_t & operator=(self_t && other)      = delete;
+
+  /**
+   * Collective destructor to destruct a DART reader-writer lock.
+   *
+   * This function is not thread-safe
+   */
+  ~SharedMutex();
+
+  /**
+   * Block until exclusive access was acquired.
+   */
+  void lock();
+
+  /**
+   * Try to acquire exclusive access and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock();
+
+  /**
+   * Release exclusive access acquired through \c lock() or \c try_lock().
+   */
+  void unlock();
+
+  /**
+   * Block until shared access was acquired.
+   */
+  void lock_shared();
+
+  /**
+   * Try to acquire shared access and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock_shared();
+
+  /**
+   * Release shared access acquired through \c lock_shared() or
+   * \c try_lock_shared().
+   */
+  void unlock_shared();
+
+private:
+  dart_rwlock_t _mutex;
+}; // class SharedMutex
+
+} // namespace dash
+
+#endif // DASH__SHARED_MUTEX_H__INCLUDED
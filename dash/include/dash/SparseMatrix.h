@@ -0,0 +1,487 @@
+#ifndef DASH__SPARSE_MATRIX_H__INCLUDED
+#define DASH__SPARSE_MATRIX_H__INCLUDED
+
+#include <dash/Array.h>
+#include <dash/Exception.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/pattern/CSRPattern.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Communication plan of a sparse matrix-vector multiplication
+ * <tt>y = A x</tt> at a single unit.
+ *
+ * Column indices of the local rows of \c A are mapped to local offsets
+ * of \c x or to ghost entries of \c x owned by other units. Ghost entries
+ * are grouped in ranges that are contiguous in the owning unit's local
+ * memory so every range is transferred in a single one-sided get.
+ *
+ * The plan owns the buffer of entries of \c x referenced by rows with
+ * ghost entries, which is reused in every multiplication.
+ *
+ * \see dash::spmv
+ */
+template<
+  typename ValueType,
+  typename IndexType = dash::default_index_t>
+class SpMVPlan {
+public:
+  typedef ValueType                                 value_type;
+  typedef IndexType                                 index_type;
+  typedef typename std::make_unsigned<IndexType>::type size_type;
+
+  /**
+   * Contiguous range of ghost entries in the local memory of a unit.
+   */
+  struct ghost_range {
+    /// Unit owning the entries
+    team_unit_t  unit;
+    /// Local offset of the first entry at the owning unit
+    index_type   offset;
+    /// Number of entries
+    size_type    count;
+    /// Offset of the first entry in the buffer
+    size_type    buffer_offset;
+    /// Global index of the first entry in \c x
+    index_type   global_index;
+  };
+
+public:
+  /**
+   * Creates the communication plan for the local rows of the given
+   * matrix and the distribution of a vector \c x.
+   */
+  template<typename MatrixT, typename PatternT>
+  SpMVPlan(const MatrixT & matrix, const PatternT & x_pattern)
+  : _x_layout(layout(x_pattern)),
+    _nlocal_x(x_pattern.local_size())
+  {
+    DASH_LOG_TRACE("SpMVPlan()", "local nnz:", matrix.local_nnz());
+    const auto   myid      = x_pattern.team().myid();
+    const auto   nnz       = matrix.local_nnz();
+    const auto * col_idx   = matrix.local_col_indices();
+    const auto & row_ptr   = matrix.local_row_ptr();
+
+    // Owner and local offset of every column index:
+    typedef std::pair<dart_unit_t, index_type> ghost_t;
+    std::vector<ghost_t> ghosts;
+    _col_local.resize(nnz);
+    std::vector<bool> is_ghost(nnz, false);
+    for (size_type k = 0; k < nnz; ++k) {
+      auto l_idx = x_pattern.local(col_idx[k]);
+      if (l_idx.unit == myid) {
+        _col_local[k] = l_idx.index;
+      } else {
+        ghosts.push_back(ghost_t(l_idx.unit.id, l_idx.index));
+        _col_local[k] = ghosts.size() - 1;
+        is_ghost[k]   = true;
+      }
+    }
+    // Every ghost entry is transferred once, in order of owner and local
+    // offset:
+    std::vector<ghost_t> unique_ghosts(ghosts);
+    std::sort(unique_ghosts.begin(), unique_ghosts.end());
+    unique_ghosts.erase(
+      std::unique(unique_ghosts.begin(), unique_ghosts.end()),
+      unique_ghosts.end());
+    for (size_type k = 0; k < nnz; ++k) {
+      if (is_ghost[k]) {
+        auto pos = std::lower_bound(unique_ghosts.begin(),
+                                    unique_ghosts.end(),
+                                    ghosts[_col_local[k]]);
+        _col_local[k] = pos - unique_ghosts.begin();
+      }
+    }
+    _nghost = unique_ghosts.size();
+    // Rows only referencing local entries of x can be computed while
+    // ghost entries are transferred:
+    const size_type nrows = row_ptr.size() - 1;
+    for (size_type r = 0; r < nrows; ++r) {
+      bool boundary = false;
+      for (auto k = row_ptr[r]; k < row_ptr[r + 1]; ++k) {
+        if (is_ghost[k]) {
+          boundary = true;
+          break;
+        }
+      }
+      (boundary ? _boundary_rows : _interior_rows).push_back(r);
+    }
+    // Local entries of x referenced by boundary rows precede the ghost
+    // entries in the buffer:
+    for (auto r : _boundary_rows) {
+      for (auto k = row_ptr[r]; k < row_ptr[r + 1]; ++k) {
+        if (!is_ghost[k]) {
+          _boundary_x.push_back(_col_local[k]);
+        }
+      }
+    }
+    std::sort(_boundary_x.begin(), _boundary_x.end());
+    _boundary_x.erase(
+      std::unique(_boundary_x.begin(), _boundary_x.end()),
+      _boundary_x.end());
+    const size_type nboundary_x = _boundary_x.size();
+    for (auto r : _boundary_rows) {
+      for (auto k = row_ptr[r]; k < row_ptr[r + 1]; ++k) {
+        if (is_ghost[k]) {
+          _col_local[k] += nboundary_x;
+        } else {
+          _col_local[k] = std::lower_bound(_boundary_x.begin(),
+                                           _boundary_x.end(),
+                                           _col_local[k])
+                          - _boundary_x.begin();
+        }
+      }
+    }
+    _buffer.resize(nboundary_x + _nghost);
+    for (size_type g = 0; g < _nghost; ++g) {
+      const auto & ghost = unique_ghosts[g];
+      if (!_ranges.empty() &&
+          _ranges.back().unit.id == ghost.first &&
+          _ranges.back().offset + static_cast<index_type>(
+            _ranges.back().count) == ghost.second) {
+        ++_ranges.back().count;
+      } else {
+        team_unit_t unit(ghost.first);
+        _ranges.push_back(
+          ghost_range {
+            unit, ghost.second, 1, nboundary_x + g,
+            x_pattern.global_index(
+              unit, std::array<index_type, 1> {{ ghost.second }})
+          });
+      }
+    }
+    DASH_LOG_TRACE("SpMVPlan >",
+                   "ghosts:",         _nghost,
+                   "ranges:",         _ranges.size(),
+                   "interior rows:",  _interior_rows.size(),
+                   "boundary rows:",  _boundary_rows.size());
+  }
+
+  /**
+   * Whether the plan has been created for vectors with the given
+   * distribution.
+   */
+  template<typename PatternT>
+  bool is_valid_for(const PatternT & x_pattern) const
+  {
+    return layout(x_pattern) == _x_layout;
+  }
+
+  /**
+   * Number of ghost entries of \c x transferred in every multiplication.
+   */
+  size_type num_ghosts() const noexcept
+  {
+    return _nghost;
+  }
+
+  /**
+   * Ranges of ghost entries, ordered by owning unit and local offset.
+   */
+  const std::vector<ghost_range> & ghost_ranges() const noexcept
+  {
+    return _ranges;
+  }
+
+  /**
+   * Index of every local non-zero's column in the local entries of \c x
+   * for interior rows, or in the buffer for boundary rows.
+   */
+  const std::vector<index_type> & local_col_indices() const noexcept
+  {
+    return _col_local;
+  }
+
+  /// Local rows referencing local entries of \c x only.
+  const std::vector<index_type> & interior_rows() const noexcept
+  {
+    return _interior_rows;
+  }
+
+  /// Local rows referencing ghost entries of \c x.
+  const std::vector<index_type> & boundary_rows() const noexcept
+  {
+    return _boundary_rows;
+  }
+
+  /// Number of local entries of \c x.
+  size_type num_local_x() const noexcept
+  {
+    return _nlocal_x;
+  }
+
+  /**
+   * Offsets of the local entries of \c x referenced by boundary rows, in
+   * the order of their copies at the front of the buffer.
+   */
+  const std::vector<index_type> & boundary_x_offsets() const noexcept
+  {
+    return _boundary_x;
+  }
+
+  /**
+   * Buffer of the local entries of \c x referenced by boundary rows
+   * followed by the ghost entries.
+   */
+  value_type * buffer() noexcept
+  {
+    return _buffer.data();
+  }
+
+private:
+  /**
+   * Local size and global index of the first local element of every unit.
+   */
+  template<typename PatternT>
+  static std::vector<index_type> layout(const PatternT & pattern)
+  {
+    const size_type nunits = pattern.team().size();
+    std::vector<index_type> result(2 * nunits, -1);
+    for (size_type u = 0; u < nunits; ++u) {
+      team_unit_t unit(u);
+      result[2 * u] = pattern.local_size(unit);
+      if (result[2 * u] > 0) {
+        result[2 * u + 1] = pattern.global_index(
+                              unit, std::array<index_type, 1> {{ 0 }});
+      }
+    }
+    return result;
+  }
+
+private:
+  std::vector<index_type>   _x_layout;
+  size_type                 _nlocal_x;
+  size_type                 _nghost = 0;
+  std::vector<index_type>   _col_local;
+  std::vector<ghost_range>  _ranges;
+  std::vector<index_type>   _interior_rows;
+  std::vector<index_type>   _boundary_rows;
+  std::vector<index_type>   _boundary_x;
+  std::vector<value_type>   _buffer;
+};
+
+/**
+ * A sparse matrix in compressed sparse row (CSR) format with rows
+ * distributed to units in a team.
+ *
+ * Every unit owns a contiguous range of rows as specified by a
+ * \c dash::CSRPattern. Column indices and values of the non-zeros are
+ * stored in \c dash::Array instances distributed accordingly, row
+ * offsets of local rows are stored at their owning unit.
+ *
+ * \code
+ *   // every unit assembles its local rows in CSR format with global
+ *   // column indices:
+ *   dash::SparseMatrix<double> A(n, row_ptr, col_idx, values);
+ *   dash::Array<double, dash::default_index_t, decltype(A)::pattern_type>
+ *     x(A.row_pattern()), y(A.row_pattern());
+ *   dash::spmv(A, x, y);
+ * \endcode
+ *
+ * \see dash::spmv
+ */
+template<
+  typename ElementType,
+  typename IndexType = dash::default_index_t>
+class SparseMatrix {
+private:
+  typedef SparseMatrix<ElementType, IndexType>        self_t;
+
+public:
+  typedef ElementType                             value_type;
+  typedef IndexType                               index_type;
+  typedef typename std::make_unsigned<IndexType>::type size_type;
+  typedef CSRPattern<1, ROW_MAJOR, IndexType>   pattern_type;
+  typedef dash::Array<value_type, IndexType, pattern_type>
+                                                value_array_type;
+  typedef dash::Array<index_type, IndexType, pattern_type>
+                                                index_array_type;
+  typedef SpMVPlan<ElementType, IndexType>        plan_type;
+
+public:
+  /**
+   * Constructor, creates a sparse matrix from the local rows of every unit
+   * in CSR format.
+   *
+   * Collective operation.
+   */
+  SparseMatrix(
+    /// Number of columns of the matrix
+    size_type                 ncols,
+    /// Offsets of the local rows' first non-zero, number of local rows
+    /// plus one elements
+    std::vector<index_type>   row_ptr,
+    /// Global column indices of the local non-zeros
+    const std::vector<index_type> & col_idx,
+    /// Values of the local non-zeros
+    const std::vector<value_type> & values,
+    /// Team containing all units owning rows of the matrix
+    Team                    & team = dash::Team::All())
+  : _ncols(ncols),
+    _row_ptr(std::move(row_ptr)),
+    _row_pattern(
+      gather_local_sizes(
+        _row_ptr.empty() ? 0 : _row_ptr.size() - 1, team),
+      team),
+    _nnz_pattern(gather_local_sizes(values.size(), team), team),
+    _col_idx(_nnz_pattern),
+    _values(_nnz_pattern)
+  {
+    if (_row_ptr.empty()) {
+      _row_ptr.push_back(0);
+    }
+    DASH_ASSERT_EQ(static_cast<size_type>(_row_ptr.back()), values.size(),
+                   "SparseMatrix: row offsets do not match number of values");
+    DASH_ASSERT_EQ(col_idx.size(), values.size(),
+                   "SparseMatrix: number of column indices and values "
+                   "differ");
+    std::copy(col_idx.begin(), col_idx.end(), _col_idx.lbegin());
+    std::copy(values.begin(),  values.end(),  _values.lbegin());
+    _values.barrier();
+  }
+
+  SparseMatrix(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)       = delete;
+
+  /// Number of rows of the matrix.
+  size_type nrows() const noexcept
+  {
+    return _row_pattern.size();
+  }
+
+  /// Number of columns of the matrix.
+  size_type ncols() const noexcept
+  {
+    return _ncols;
+  }
+
+  /// Number of non-zeros of the matrix.
+  size_type nnz() const noexcept
+  {
+    return _nnz_pattern.size();
+  }
+
+  /// Number of rows owned by the calling unit.
+  size_type local_rows() const noexcept
+  {
+    return _row_pattern.local_size();
+  }
+
+  /// Number of non-zeros in the rows owned by the calling unit.
+  size_type local_nnz() const noexcept
+  {
+    return _nnz_pattern.local_size();
+  }
+
+  /// Global index of the first row owned by the calling unit.
+  index_type row_offset() const noexcept
+  {
+    return _row_pattern.lbegin();
+  }
+
+  /// Distribution of the matrix rows.
+  const pattern_type & row_pattern() const noexcept
+  {
+    return _row_pattern;
+  }
+
+  /// Offsets of the local rows' first non-zero in the local non-zeros.
+  const std::vector<index_type> & local_row_ptr() const noexcept
+  {
+    return _row_ptr;
+  }
+
+  /// Global column indices of the local non-zeros.
+  const index_type * local_col_indices() const noexcept
+  {
+    return _col_idx.lbegin();
+  }
+
+  /// Values of the local non-zeros.
+  const value_type * local_values() const noexcept
+  {
+    return _values.lbegin();
+  }
+
+  /// Values of the local non-zeros.
+  value_type * local_values() noexcept
+  {
+    return _values.lbegin();
+  }
+
+  /// Global column indices of all non-zeros, ordered by row.
+  const index_array_type & col_indices() const noexcept
+  {
+    return _col_idx;
+  }
+
+  /// Values of all non-zeros, ordered by row.
+  value_array_type & values() noexcept
+  {
+    return _values;
+  }
+
+  inline Team & team() const noexcept
+  {
+    return _row_pattern.team();
+  }
+
+  inline void barrier() const
+  {
+    _values.barrier();
+  }
+
+  /**
+   * Communication plan for multiplications with vectors distributed as
+   * specified by \c x_pattern, created on first use and reused as long as
+   * the distribution of vectors does not change.
+   */
+  template<typename PatternT>
+  plan_type & spmv_plan(const PatternT & x_pattern) const
+  {
+    if (!_plan || !_plan->is_valid_for(x_pattern)) {
+      _plan.reset(new plan_type(*this, x_pattern));
+    }
+    return *_plan;
+  }
+
+private:
+  static std::vector<size_type> gather_local_sizes(
+    size_type   local_size,
+    Team      & team)
+  {
+    std::vector<size_type> local_sizes(team.size());
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&local_size, local_sizes.data(), 1,
+                     dash::dart_datatype<size_type>::value,
+                     team.dart_id()),
+      DART_OK);
+    return local_sizes;
+  }
+
+private:
+  size_type                            _ncols;
+  std::vector<index_type>              _row_ptr;
+  pattern_type                         _row_pattern;
+  pattern_type                         _nnz_pattern;
+  index_array_type                     _col_idx;
+  value_array_type                     _values;
+  mutable std::unique_ptr<plan_type>   _plan;
+};
+
+} // namespace dash
+
+#include <dash/algorithm/SpMV.h>
+
+#endif // DASH__SPARSE_MATRIX_H__INCLUDED
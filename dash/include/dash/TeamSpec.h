@@ -7,8 +7,13 @@
 #include <dash/Cartesian.h>
 #include <dash/internal/Logging.h>
 
+#include <dash/dart/if/dart_locality.h>
+
 #include <array>
+#include <map>
 #include <set>
+#include <string>
+#include <vector>
 #include <algorithm>
 #include <sstream>
 #include <iostream>
@@ -25,6 +30,11 @@ namespace dash {
  *
  * Reoccurring units are currently not supported.
  *
+ * By default, units are arranged in the Cartesian grid in row-major order
+ * of their ids. With \c map_to_nodes, units sharing a node are assigned
+ * to a compact sub-grid instead so that adjacent positions in the grid are
+ * mostly located at the same node.
+ *
  * \tparam  NumDimensions  Number of dimensions
  */
 template<
@@ -132,6 +142,11 @@ public:
     update_rank();
     DASH_LOG_TRACE_VAR("TeamSpec(ts, dist, t)", this->_extents);
     this->resize(this->_extents);
+    // Keep arrangement of units if extents have not been adjusted:
+    if (this->_extents == other._extents) {
+      _unit_at    = other._unit_at;
+      _unit_index = other._unit_index;
+    }
     DASH_LOG_TRACE_VAR("TeamSpec(ts, dist, t)", this->size());
   }
 
@@ -277,6 +292,208 @@ public:
     DASH_LOG_TRACE_VAR("TeamSpec.balance_extents() ->", this->_extents);
   }
 
+  /**
+   * Arranges the units in the grid such that units located at the same
+   * node are assigned to a compact sub-grid of positions. Units at a node
+   * are arranged in row-major order of their ids in the node's sub-grid,
+   * sub-grids of nodes are arranged in row-major order of the nodes' lowest
+   * unit ids.
+   *
+   * The arrangement is reset when the extents of the team spec change.
+   *
+   * \b Example:
+   *
+   * \code
+   *   // 4 units at 2 nodes, units 0,2 at node 0 and units 1,3 at node 1:
+   *   TeamSpec<2> ts(2,2);
+   *   ts.map_to_nodes({ 0, 1, 0, 1 });
+   *   // Default arrangement:   Node-blocked arrangement:
+   *   //   0 1                    0 2
+   *   //   2 3                    1 3
+   * \endcode
+   *
+   * \returns  \c true if the units have been arranged by nodes, \c false
+   *           if the number of units differs between nodes or the extents
+   *           cannot be partitioned into sub-grids of the nodes' size, in
+   *           which case the arrangement is not modified.
+   */
+  bool map_to_nodes(
+    /// Node id of every unit in the team spec
+    const std::vector<IndexType> & unit_nodes)
+  {
+    DASH_LOG_TRACE_VAR("TeamSpec.map_to_nodes()", unit_nodes);
+    auto nunits = this->size();
+    if (unit_nodes.size() != nunits) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "Number of node ids (" << unit_nodes.size() << ") differs from " <<
+        "size of teamspec (" << nunits << ") in TeamSpec.map_to_nodes()");
+    }
+    // Units of every node in the order of the nodes' lowest unit id:
+    std::vector<std::vector<IndexType>> node_units;
+    std::map<IndexType, size_t>         node_index;
+    for (IndexType u = 0; u < static_cast<IndexType>(nunits); ++u) {
+      auto node_it = node_index.find(unit_nodes[u]);
+      if (node_it == node_index.end()) {
+        node_it = node_index.insert(
+                    std::make_pair(unit_nodes[u], node_units.size())).first;
+        node_units.emplace_back();
+      }
+      node_units[node_it->second].push_back(u);
+    }
+    SizeType node_size = node_units.front().size();
+    for (const auto & units : node_units) {
+      if (units.size() != node_size) {
+        DASH_LOG_TRACE("TeamSpec.map_to_nodes >",
+                       "number of units differs between nodes");
+        return false;
+      }
+    }
+    // Extents of the sub-grid of a node, distribute prime factors of the
+    // number of units per node to the dimension with the most remaining
+    // positions:
+    std::array<SizeType, MaxDimensions> node_extents;
+    node_extents.fill(1);
+    auto factors = dash::math::factorize(node_size);
+    for (auto it = factors.rbegin(); it != factors.rend(); ++it) {
+      for (auto i = 0; i < it->second; ++i) {
+        dim_t    d_max  = -1;
+        SizeType n_max  = 0;
+        for (dim_t d = 0; d < MaxDimensions; ++d) {
+          auto n_left = this->_extents[d] / node_extents[d];
+          if (n_left % it->first == 0 && n_left > n_max) {
+            d_max = d;
+            n_max = n_left;
+          }
+        }
+        if (d_max < 0) {
+          DASH_LOG_TRACE("TeamSpec.map_to_nodes >",
+                         "no sub-grid for node size", node_size);
+          return false;
+        }
+        node_extents[d_max] *= it->first;
+      }
+    }
+    std::array<SizeType, MaxDimensions> node_grid_extents;
+    for (dim_t d = 0; d < MaxDimensions; ++d) {
+      node_grid_extents[d] = this->_extents[d] / node_extents[d];
+    }
+    CartesianIndexSpace<MaxDimensions, ROW_MAJOR, IndexType>
+      node_grid(node_grid_extents);
+    CartesianIndexSpace<MaxDimensions, ROW_MAJOR, IndexType>
+      node_block(node_extents);
+
+    std::vector<IndexType> unit_at(nunits);
+    std::vector<IndexType> unit_index(nunits);
+    bool is_identity = true;
+    for (size_t n = 0; n < node_units.size(); ++n) {
+      auto node_coords = node_grid.coords(n);
+      for (size_t i = 0; i < node_size; ++i) {
+        auto unit_coords = node_block.coords(i);
+        for (dim_t d = 0; d < MaxDimensions; ++d) {
+          unit_coords[d] += node_coords[d] * node_extents[d];
+        }
+        auto index        = parent_t::at(unit_coords);
+        auto unit         = node_units[n][i];
+        unit_at[index]    = unit;
+        unit_index[unit]  = index;
+        is_identity       = is_identity && (unit == index);
+      }
+    }
+    if (is_identity) {
+      _unit_at.clear();
+      _unit_index.clear();
+    } else {
+      _unit_at    = std::move(unit_at);
+      _unit_index = std::move(unit_index);
+    }
+    DASH_LOG_TRACE("TeamSpec.map_to_nodes >",
+                   "node extents:", node_extents,
+                   "identity:",     is_identity);
+    return true;
+  }
+
+  /**
+   * Arranges the units in the grid such that units located at the same
+   * node are assigned to a compact sub-grid of positions, using the host
+   * names of the units in the given team.
+   *
+   * \see  map_to_nodes(const std::vector<IndexType> &)
+   */
+  bool map_to_nodes(
+    Team & team)
+  {
+    std::vector<IndexType>            unit_nodes(team.size());
+    std::map<std::string, IndexType>  host_ids;
+    for (size_t u = 0; u < team.size(); ++u) {
+      dart_unit_locality_t * uloc;
+      DASH_ASSERT_RETURNS(
+        dart_unit_locality(team.dart_id(), team_unit_t(u), &uloc),
+        DART_OK);
+      auto host_it = host_ids.insert(
+                       std::make_pair(std::string(uloc->hwinfo.host),
+                                      static_cast<IndexType>(
+                                        host_ids.size()))).first;
+      unit_nodes[u] = host_it->second;
+    }
+    return map_to_nodes(unit_nodes);
+  }
+
+  /**
+   * Whether units are arranged in the grid differently from row-major
+   * order of their ids.
+   */
+  bool is_node_mapped() const
+  {
+    return !_unit_at.empty();
+  }
+
+  /**
+   * Unit id at the given coordinates in the grid.
+   */
+  template<typename OffsetType>
+  IndexType at(
+    const std::array<OffsetType, MaxDimensions> & coords) const
+  {
+    auto index = parent_t::at(coords);
+    return _unit_at.empty() ? index : _unit_at[index];
+  }
+
+  /**
+   * Unit id at the given coordinates in the grid.
+   */
+  template<typename... Args>
+  IndexType at(IndexType arg, Args... args) const
+  {
+    static_assert(
+      sizeof...(Args) == MaxDimensions-1,
+      "Invalid number of arguments");
+    return at(std::array<IndexType, MaxDimensions> {{
+                arg, (IndexType)(args) ... }});
+  }
+
+  /**
+   * Coordinates of the given unit in the grid.
+   * Inverse of \c at(...).
+   */
+  std::array<IndexType, MaxDimensions> coords(
+    IndexType unit) const
+  {
+    return parent_t::coords(
+             _unit_index.empty() ? unit : _unit_index[unit]);
+  }
+
+  bool operator==(const self_t & other) const
+  {
+    return parent_t::operator==(other) &&
+           _unit_at == other._unit_at;
+  }
+
+  bool operator!=(const self_t & other) const
+  {
+    return !(*this == other);
+  }
+
   /**
    * Resolve unit id at given offset in Cartesian team grid relative to the
    * active unit's position in the team.
@@ -397,6 +614,8 @@ public:
   void resize(const std::array<SizeType_, MaxDimensions> & extents)
   {
     _is_linear = false;
+    _unit_at.clear();
+    _unit_index.clear();
     parent_t::resize(extents);
     update_rank();
   }
@@ -446,6 +665,11 @@ protected:
   bool        _is_linear  = false;
   /// Unit id of active unit
   team_unit_t _myid;
+  /// Unit id at every linear position in the grid, empty for row-major
+  /// arrangement of unit ids
+  std::vector<IndexType> _unit_at;
+  /// Linear position in the grid of every unit, inverse of \c _unit_at
+  std::vector<IndexType> _unit_index;
 
 }; // class TeamSpec
 
@@ -48,6 +48,12 @@
  * <tt>dash::blocks</tt>     | Decompose domain into blocks
  * <tt>dash::block</tt>      | Subspace of decomposed domain in a specific block
  * <tt>dash::index</tt>      | Returns a view's index set
+ * <tt>dash::cached</tt>     | View with index set evaluated once, opt-in
+ *
+ * Index sets of views are not cached by default: iterators of composed
+ * views and algorithms operating on them resolve every index through all
+ * layers of the view. Use \c dash::cached to evaluate the index set of a
+ * composed view once before repeated iteration.
  *
  * \par Examples
  *
@@ -73,6 +79,7 @@
 
 #include <dash/view/Apply.h>
 #include <dash/view/Block.h>
+#include <dash/view/Cached.h>
 #include <dash/view/Chunked.h>
 #include <dash/view/Domain.h>
 #include <dash/view/Origin.h>
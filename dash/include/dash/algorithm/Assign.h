@@ -0,0 +1,502 @@
+#ifndef DASH__ALGORITHM__ASSIGN_H__INCLUDED
+#define DASH__ALGORITHM__ASSIGN_H__INCLUDED
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/Onesided.h>
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/internal/Logging.h>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <dash/util/UnitLocality.h>
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Lazy element-wise expressions on DASH containers.
+ *
+ * Arithmetic operators on \c dash::Array and \c dash::Matrix instances do
+ * not compute a result but return an expression object that is evaluated
+ * by \c dash::assign:
+ *
+ * \code
+ *   auto e = 2.0 * a + b * c;
+ *   dash::assign(d, e);
+ * \endcode
+ *
+ * All operations are fused into a single loop over the local elements of
+ * the destination container, no temporary containers are allocated.
+ *
+ * \ingroup  DashAlgorithms
+ */
+namespace expr {
+
+/**
+ * Whether a type is a node of a lazy element-wise expression.
+ */
+template <class T>
+struct is_expression : public std::false_type { };
+
+/**
+ * Whether a type is a container that can be used as operand in a lazy
+ * element-wise expression.
+ */
+template <class T>
+struct is_container : public std::false_type { };
+
+template <typename T, typename IndexT, class PatternT>
+struct is_container<dash::Array<T, IndexT, PatternT>>
+: public std::true_type { };
+
+template <typename T, dim_t NDim, typename IndexT, class PatternT>
+struct is_container<dash::Matrix<T, NDim, IndexT, PatternT>>
+: public std::true_type { };
+
+/**
+ * Whether a type can be combined with other operands in a lazy
+ * element-wise expression.
+ */
+template <class T>
+struct is_operand
+: public std::integral_constant<bool,
+    is_expression<typename std::decay<T>::type>::value ||
+    is_container<typename std::decay<T>::type>::value ||
+    std::is_arithmetic<typename std::decay<T>::type>::value >
+{ };
+
+/**
+ * Whether the operands of a binary operator form a lazy element-wise
+ * expression, i.e. at least one operand is a container or an expression.
+ */
+template <class LhsT, class RhsT>
+struct is_binary_operation
+: public std::integral_constant<bool,
+    is_operand<LhsT>::value && is_operand<RhsT>::value &&
+    ( !std::is_arithmetic<typename std::decay<LhsT>::type>::value ||
+      !std::is_arithmetic<typename std::decay<RhsT>::type>::value ) >
+{ };
+
+namespace internal {
+
+template <class PatternA, class PatternB>
+bool patterns_conform(const PatternA &, const PatternB &) {
+  return false;
+}
+
+template <class PatternT>
+bool patterns_conform(const PatternT & a, const PatternT & b) {
+  return a == b;
+}
+
+} // namespace internal
+
+/**
+ * Expression node referencing the elements of a container.
+ *
+ * If the container's pattern differs from the destination pattern, the
+ * elements corresponding to the destination's local elements are read
+ * into a local buffer before evaluation, using one non-blocking get per
+ * range that is contiguous in the local memory of a remote unit.
+ */
+template <class ContainerT>
+class ContainerExpression
+{
+public:
+  typedef typename ContainerT::value_type              value_type;
+
+private:
+  typedef std::vector<value_type>                      buffer_t;
+
+  const ContainerT            * _container;
+  const value_type            * _values   = nullptr;
+  bool                          _conforms = true;
+  std::shared_ptr<buffer_t>     _buffer;
+  std::vector<dart_handle_t>    _handles;
+
+public:
+  explicit ContainerExpression(const ContainerT & container)
+  : _container(&container)
+  { }
+
+  ContainerExpression(const ContainerExpression & other)
+  : _container(other._container),
+    _values(other._values),
+    _conforms(other._conforms),
+    _buffer(other._buffer)
+  { }
+
+  ContainerExpression(ContainerExpression && other)      = default;
+
+  template <class PatternT>
+  void prepare(const PatternT & pattern)
+  {
+    _conforms = internal::patterns_conform(pattern, _container->pattern());
+    if (_conforms) {
+      _values = _container->lbegin();
+      return;
+    }
+    DASH_ASSERT_EQ(pattern.size(), _container->size(),
+                   "dash::assign: operand size differs from destination");
+    typedef typename PatternT::index_type index_t;
+    const auto & src_pattern = _container->pattern();
+    auto    myid   = _container->team().myid();
+    auto    gbegin = _container->begin();
+    index_t lsize  = pattern.local_size();
+    _buffer.reset(new buffer_t(lsize));
+    _values = _buffer->data();
+    index_t l = 0;
+    while (l < lsize) {
+      // Range of local elements with contiguous global indices that are
+      // contiguous in the local memory of a single unit of the operand:
+      index_t g     = pattern.global(l);
+      auto    l_pos = src_pattern.local(g);
+      index_t count = 1;
+      while (l + count < lsize && pattern.global(l + count) == g + count) {
+        auto l_next = src_pattern.local(g + count);
+        if (l_next.unit  != l_pos.unit ||
+            l_next.index != l_pos.index + count) {
+          break;
+        }
+        ++count;
+      }
+      if (l_pos.unit == myid) {
+        std::copy(_container->lbegin() + l_pos.index,
+                  _container->lbegin() + l_pos.index + count,
+                  _buffer->data() + l);
+      } else {
+        _handles.push_back(DART_HANDLE_NULL);
+        dash::internal::get_handle(
+          (gbegin + g).dart_gptr(),
+          _buffer->data() + l, count, &_handles.back());
+      }
+      l += count;
+    }
+    DASH_LOG_TRACE("dash::expr::ContainerExpression.prepare",
+                   "remote fetches:", _handles.size());
+  }
+
+  bool conforms() const {
+    return _conforms;
+  }
+
+  void wait()
+  {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(_handles.data(), _handles.size()),
+      DART_OK);
+    _handles.clear();
+  }
+
+  template <class IndexT>
+  value_type operator[](IndexT l) const {
+    return _values[l];
+  }
+};
+
+/**
+ * Expression node of a scalar value.
+ */
+template <typename ValueT>
+class ScalarExpression
+{
+public:
+  typedef ValueT value_type;
+
+private:
+  ValueT _value;
+
+public:
+  explicit ScalarExpression(ValueT value)
+  : _value(value)
+  { }
+
+  template <class PatternT>
+  void prepare(const PatternT &) { }
+
+  bool conforms() const {
+    return true;
+  }
+
+  void wait() { }
+
+  template <class IndexT>
+  value_type operator[](IndexT) const {
+    return _value;
+  }
+};
+
+/**
+ * Expression node applying a binary operation to the values of two
+ * expressions.
+ */
+template <class OpT, class LhsT, class RhsT>
+class BinaryExpression
+{
+public:
+  typedef decltype(
+            std::declval<OpT>()(
+              std::declval<typename LhsT::value_type>(),
+              std::declval<typename RhsT::value_type>()))
+    value_type;
+
+private:
+  LhsT _lhs;
+  RhsT _rhs;
+  OpT  _op;
+
+public:
+  BinaryExpression(LhsT lhs, RhsT rhs)
+  : _lhs(std::move(lhs)),
+    _rhs(std::move(rhs))
+  { }
+
+  template <class PatternT>
+  void prepare(const PatternT & pattern)
+  {
+    _lhs.prepare(pattern);
+    _rhs.prepare(pattern);
+  }
+
+  bool conforms() const {
+    return _lhs.conforms() && _rhs.conforms();
+  }
+
+  void wait()
+  {
+    _lhs.wait();
+    _rhs.wait();
+  }
+
+  template <class IndexT>
+  value_type operator[](IndexT l) const {
+    return _op(_lhs[l], _rhs[l]);
+  }
+};
+
+/**
+ * Expression node applying a unary operation to the values of an
+ * expression.
+ */
+template <class OpT, class OperandT>
+class UnaryExpression
+{
+public:
+  typedef decltype(
+            std::declval<OpT>()(
+              std::declval<typename OperandT::value_type>()))
+    value_type;
+
+private:
+  OperandT _operand;
+  OpT      _op;
+
+public:
+  explicit UnaryExpression(OperandT operand)
+  : _operand(std::move(operand))
+  { }
+
+  template <class PatternT>
+  void prepare(const PatternT & pattern)
+  {
+    _operand.prepare(pattern);
+  }
+
+  bool conforms() const {
+    return _operand.conforms();
+  }
+
+  void wait()
+  {
+    _operand.wait();
+  }
+
+  template <class IndexT>
+  value_type operator[](IndexT l) const {
+    return _op(_operand[l]);
+  }
+};
+
+template <class ContainerT>
+struct is_expression<ContainerExpression<ContainerT>>
+: public std::true_type { };
+
+template <typename ValueT>
+struct is_expression<ScalarExpression<ValueT>>
+: public std::true_type { };
+
+template <class OpT, class LhsT, class RhsT>
+struct is_expression<BinaryExpression<OpT, LhsT, RhsT>>
+: public std::true_type { };
+
+template <class OpT, class OperandT>
+struct is_expression<UnaryExpression<OpT, OperandT>>
+: public std::true_type { };
+
+/**
+ * Expression node type of an operand.
+ */
+template <class T, class Enable = void>
+struct expression_type;
+
+template <class T>
+struct expression_type<T,
+  typename std::enable_if<is_expression<T>::value>::type> {
+  typedef T type;
+  static type make(const T & operand) { return operand; }
+};
+
+template <class T>
+struct expression_type<T,
+  typename std::enable_if<is_container<T>::value>::type> {
+  typedef ContainerExpression<T> type;
+  static type make(const T & operand) { return type(operand); }
+};
+
+template <class T>
+struct expression_type<T,
+  typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+  typedef ScalarExpression<T> type;
+  static type make(const T & operand) { return type(operand); }
+};
+
+template <class OpT, class LhsT, class RhsT>
+using binary_expression_t =
+  BinaryExpression<
+    OpT,
+    typename expression_type<typename std::decay<LhsT>::type>::type,
+    typename expression_type<typename std::decay<RhsT>::type>::type >;
+
+template <class OpT, class LhsT, class RhsT>
+binary_expression_t<OpT, LhsT, RhsT>
+make_binary(const LhsT & lhs, const RhsT & rhs) {
+  return binary_expression_t<OpT, LhsT, RhsT>(
+           expression_type<LhsT>::make(lhs),
+           expression_type<RhsT>::make(rhs));
+}
+
+template <class OpT, class OperandT>
+using unary_expression_t =
+  UnaryExpression<
+    OpT,
+    typename expression_type<typename std::decay<OperandT>::type>::type >;
+
+#define DASH__EXPR_BINARY_OPERATOR(op, op_type)                         \
+template <class LhsT, class RhsT>                                       \
+typename std::enable_if<                                                \
+  is_binary_operation<LhsT, RhsT>::value,                               \
+  binary_expression_t<op_type<void>, LhsT, RhsT>                        \
+>::type                                                                 \
+operator op(const LhsT & lhs, const RhsT & rhs) {                       \
+  return make_binary<op_type<void>>(lhs, rhs);                          \
+}
+
+DASH__EXPR_BINARY_OPERATOR(+, std::plus)
+DASH__EXPR_BINARY_OPERATOR(-, std::minus)
+DASH__EXPR_BINARY_OPERATOR(*, std::multiplies)
+DASH__EXPR_BINARY_OPERATOR(/, std::divides)
+
+#undef DASH__EXPR_BINARY_OPERATOR
+
+template <class OperandT>
+typename std::enable_if<
+  is_expression<OperandT>::value || is_container<OperandT>::value,
+  unary_expression_t<std::negate<void>, OperandT>
+>::type
+operator-(const OperandT & operand) {
+  return unary_expression_t<std::negate<void>, OperandT>(
+           expression_type<OperandT>::make(operand));
+}
+
+} // namespace expr
+
+// Operators on containers are found by argument dependent lookup in
+// namespace dash:
+using expr::operator+;
+using expr::operator-;
+using expr::operator*;
+using expr::operator/;
+
+/**
+ * Evaluates a lazy element-wise expression and assigns its values to the
+ * elements of a container.
+ *
+ * Every unit evaluates the expression for the local elements of the
+ * destination container in a single loop. Operands with the same pattern
+ * as the destination are read from local memory directly. Elements of
+ * operands with a different pattern are read into a local buffer first,
+ * in one non-blocking get per contiguous remote range, before any
+ * destination element is written.
+ *
+ * Operand values written by other units must be visible before the
+ * operation is called, e.g. after a barrier.
+ *
+ * Collective operation.
+ *
+ * \code
+ *   dash::Array<double> x(n), y(n), r(n);
+ *   // ...
+ *   // r = y - a * x without temporary arrays:
+ *   dash::assign(r, y - a * x);
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class ContainerT, class ExprT>
+typename std::enable_if<
+  expr::is_container<ContainerT>::value && expr::is_operand<ExprT>::value
+>::type
+assign(
+  /// Destination container
+  ContainerT  & dst,
+  /// Expression, container or scalar value to assign
+  const ExprT & expression)
+{
+  typedef typename ContainerT::index_type index_t;
+  DASH_LOG_DEBUG("dash::assign()");
+  auto expr = expr::expression_type<ExprT>::make(expression);
+  expr.prepare(dst.pattern());
+  expr.wait();
+  if (!expr.conforms()) {
+    // Remote operands may refer to the destination, all units must have
+    // read their operand values before destination elements are written:
+    dst.barrier();
+  }
+  auto    lbegin = dst.lbegin();
+  index_t lsize  = dst.pattern().local_size();
+  DASH_LOG_TRACE_VAR("dash::assign", lsize);
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  auto n_threads = uloc.num_domain_threads();
+  if (n_threads > 1) {
+    #pragma omp parallel for num_threads(n_threads) schedule(static)
+    for (index_t l = 0; l < lsize; ++l) {
+      lbegin[l] = expr[l];
+    }
+    dst.barrier();
+    return;
+  }
+#endif
+  // No OpenMP or insufficient number of threads for parallelization:
+  for (index_t l = 0; l < lsize; ++l) {
+    lbegin[l] = expr[l];
+  }
+  dst.barrier();
+  DASH_LOG_DEBUG("dash::assign >");
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__ASSIGN_H__INCLUDED
@@ -5,10 +5,14 @@
 #include <dash/Iterator.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/iterator/GlobSegment.h>
+
+#include <dash/util/ScratchArena.h>
 
 #include <dash/dart/if/dart_communication.h>
 
 #include <algorithm>
+#include <type_traits>
 #include <vector>
 #include <memory>
 #include <future>
@@ -93,6 +97,15 @@ dash::Future<ValueType *> copy_async(
 
 namespace internal {
 
+/**
+ * Handles of pending transfers in blocking copy operations, allocated
+ * from the unit's scratch arena.
+ */
+typedef std::vector<
+          dart_handle_t,
+          dash::util::ScratchAllocator<dart_handle_t> >
+  scratch_handles_t;
+
 // =========================================================================
 // Global to Local
 // =========================================================================
@@ -103,20 +116,21 @@ namespace internal {
  */
 template <
   typename ValueType,
-  class GlobInputIt >
+  class GlobInputIt,
+  class HandleVector >
 ValueType * copy_impl(
   GlobInputIt                  in_first,
   GlobInputIt                  in_last,
   ValueType                  * out_first,
-  std::vector<dart_handle_t> & handles)
+  HandleVector               & handles)
 {
   DASH_LOG_TRACE("dash::copy_impl()",
                  "in_first:",  in_first.pos(),
                  "in_last:",   in_last.pos(),
                  "out_first:", out_first);
-  auto pattern = in_first.pattern();
-  typedef typename decltype(pattern)::index_type index_type;
-  typedef typename decltype(pattern)::size_type  size_type;
+  typedef typename GlobInputIt::index_type                  index_type;
+  typedef typename GlobInputIt::local_pointer            local_pointer;
+  typedef typename GlobInputIt::pattern_type::size_type      size_type;
   size_type num_elem_total = dash::distance(in_first, in_last);
   if (num_elem_total <= 0) {
     DASH_LOG_TRACE("dash::copy_impl", "input range empty");
@@ -125,87 +139,31 @@ ValueType * copy_impl(
   DASH_LOG_TRACE("dash::copy_impl",
                  "total elements:",    num_elem_total,
                  "expected out_last:", out_first + num_elem_total);
-  // Input iterators could be relative to a view. Map first input iterator
-  // to global index range and use it to resolve last input iterator.
-  // Do not use in_last.global() as this would span over the relative input
-  // range.
-  auto g_in_first      = in_first.global();
-  auto g_in_last       = g_in_first + num_elem_total;
-  DASH_LOG_TRACE("dash::copy_impl",
-                 "g_in_first:", g_in_first.pos(),
-                 "g_in_last:",  g_in_last.pos());
-  auto unit_first      = pattern.unit_at(g_in_first.pos());
-  DASH_LOG_TRACE_VAR("dash::copy_impl", unit_first);
-  auto unit_last       = pattern.unit_at(g_in_last.pos() - 1);
-  DASH_LOG_TRACE_VAR("dash::copy_impl", unit_last);
-
+  // Input iterators could be relative to a view. The input range is
+  // resolved in segments that are contiguous in the local memory of a
+  // unit, every remote segment is transferred in a single get operation:
   size_type num_elem_copied = 0;
-  if (unit_first == unit_last) {
-    // Input range is located at a single remote unit:
-    DASH_LOG_TRACE("dash::copy_impl", "input range at single unit");
-    DASH_LOG_TRACE("dash::copy_impl",
-                    "get elements:",   num_elem_total);
-    auto cur_in_first  = g_in_first;
-    auto cur_out_first = out_first;
-    dart_handle_t handle;
-    dash::internal::get_handle(
-      cur_in_first.dart_gptr(),
-      cur_out_first,
-      num_elem_total,
-      &handle);
-    if (handle != DART_HANDLE_NULL) {
-      handles.push_back(handle);
-    }
-    num_elem_copied = num_elem_total;
-  } else {
-    // Input range is spread over several remote units:
-    DASH_LOG_TRACE("dash::copy_impl", "input range spans multiple units");
-    //
-    // Copy elements from every unit:
-    //
-    while (num_elem_copied < num_elem_total) {
-      // Global iterator pointing at begin of current unit's input range:
-      auto cur_in_first    = g_in_first + num_elem_copied;
-      // unit and local index of first element in current range segment:
-      auto local_pos       = pattern.local(static_cast<index_type>(
-                                             cur_in_first.pos()));
-      // Number of elements located at current source unit:
-      size_type max_elem_per_unit = pattern.local_size(local_pos.unit);
-      // Local offset of first element in input range at current unit:
-      auto l_in_first_idx  = local_pos.index;
-      // Maximum number of elements to copy from current unit:
-      auto num_unit_elem   = max_elem_per_unit - l_in_first_idx;
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      // Number of elements to copy in this iteration.
-      auto num_copy_elem   = num_unit_elem;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
-      }
-      DASH_ASSERT_GT(num_copy_elem, 0,
-                     "Number of element to copy is 0");
+  dash::for_each_segment(
+    in_first, in_last,
+    [&](const GlobSegment<index_type, local_pointer> & segment) {
+      auto dest_ptr = out_first + segment.offset;
       DASH_LOG_TRACE("dash::copy_impl",
-                     "start g_idx:",    cur_in_first.pos(),
-                     "->",
-                     "unit:",           local_pos.unit,
-                     "l_idx:",          l_in_first_idx,
-                     "->",
-                     "unit elements:",  num_unit_elem,
-                     "max elem/unit:",  max_elem_per_unit,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto dest_ptr = out_first + num_elem_copied;
-      auto src_gptr = cur_in_first.dart_gptr();
-      dart_handle_t handle;
-      dash::internal::get_handle(src_gptr, dest_ptr, num_copy_elem, &handle);
-      num_elem_copied += num_copy_elem;
-      if (handle != DART_HANDLE_NULL) {
-        handles.push_back(handle);
+                     "offset:",        segment.offset,
+                     "unit:",          segment.unit,
+                     "l_idx:",         segment.lindex,
+                     "get elements:",  segment.size);
+      if (segment.lbegin != nullptr) {
+        std::copy(segment.lbegin, segment.lbegin + segment.size, dest_ptr);
+      } else {
+        dart_handle_t handle;
+        dash::internal::get_handle(
+          segment.gptr, dest_ptr, segment.size, &handle);
+        if (handle != DART_HANDLE_NULL) {
+          handles.push_back(handle);
+        }
       }
-    }
-  }
+      num_elem_copied += segment.size;
+    });
 
   ValueType * out_last = out_first + num_elem_copied;
   DASH_LOG_TRACE_VAR("dash::copy_impl >", out_last);
@@ -222,12 +180,61 @@ ValueType * copy_impl(
  */
 template <
   typename ValueType,
-  class GlobOutputIt >
+  class GlobOutputIt,
+  class HandleVector >
 GlobOutputIt copy_impl(
   ValueType                  * in_first,
   ValueType                  * in_last,
   GlobOutputIt                 out_first,
-  std::vector<dart_handle_t> & handles)
+  HandleVector               & handles)
+{
+  DASH_LOG_TRACE("dash::copy_impl()",
+                 "l_in_first:",  in_first,
+                 "l_in_last:",   in_last,
+                 "g_out_first:", out_first);
+
+  typedef typename GlobOutputIt::index_type    index_type;
+  typedef typename GlobOutputIt::local_pointer local_pointer;
+  auto num_elements = std::distance(in_first, in_last);
+  // One put operation per segment of the output range that is contiguous
+  // in the local memory of a unit:
+  auto out_last     = out_first + num_elements;
+  dash::for_each_segment(
+    out_first, out_last,
+    [&](const GlobSegment<index_type, local_pointer> & segment) {
+      auto src_ptr = in_first + segment.offset;
+      if (segment.lbegin != nullptr) {
+        std::copy(src_ptr, src_ptr + segment.size, segment.lbegin);
+      } else {
+        dart_handle_t handle;
+        dash::internal::put_handle(
+          segment.gptr, src_ptr, segment.size, &handle);
+        if (handle != DART_HANDLE_NULL) {
+          handles.push_back(handle);
+        }
+      }
+    });
+
+  DASH_LOG_TRACE("dash::copy_impl >",
+                 "g_out_last:", out_last.dart_gptr());
+
+  return out_last;
+}
+
+/**
+ * Blocking implementation of \c dash::copy (local to global) to a range of
+ * consecutive elements referenced by a global pointer.
+ */
+template <
+  typename ValueType,
+  typename T,
+  class    MemSpaceT,
+  class    HandleVector >
+GlobPtr<T, MemSpaceT> copy_impl(
+  ValueType                  * in_first,
+  ValueType                  * in_last,
+  GlobPtr<T, MemSpaceT>        out_first,
+  HandleVector               & handles)
 {
   DASH_LOG_TRACE("dash::copy_impl()",
                  "l_in_first:",  in_first,
@@ -336,125 +343,13 @@ dash::Future<ValueType *> copy_async(
                  li_range_in.begin,
                  li_range_in.end,
                  "in_first.is_local:", in_first.is_local());
-  // Check if global input range is partially local:
-  if (num_local_elem > 0) {
-    // Part of the input range is local, copy local input subrange to local
-    // output range directly.
-    auto pattern          = in_first.pattern();
-    // Map input iterators to global index domain:
-    auto g_in_first       = in_first.global();
-    auto g_in_last        = g_in_first + total_copy_elem;
-    DASH_LOG_TRACE("dash::copy_async", "resolving local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy_async", num_local_elem);
-    // Local index range to global input index range:
-    // Global index of local range begin index:
-    auto g_l_offset_begin = pattern.global(li_range_in.begin);
-    // Global index of local range end index:
-    auto g_l_offset_end   = pattern.global(li_range_in.end-1)
-                            + 1; // pat.global(l_end) would be out of range
-    DASH_LOG_TRACE("dash::copy_async",
-                   "global index range of local subrange:",
-                   "begin:", g_l_offset_begin, "end:", g_l_offset_end);
-    // Global position of input start iterator:
-    auto g_offset_begin   = g_in_first.pos();
-    // Convert local subrange to global iterators:
-    auto g_l_in_first     = g_in_first + (g_l_offset_begin - g_offset_begin);
-    auto g_l_in_last      = g_in_first + (g_l_offset_end   - g_offset_begin);
-    DASH_LOG_TRACE("dash::copy_async", "global it. range of local subrange:",
-                   "begin:", g_l_in_first.pos(), "end:", g_l_in_last.pos());
-    DASH_LOG_TRACE_VAR("dash::copy_async", g_l_in_last.pos());
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements preceding the local subrange:
-    //
-    auto num_prelocal_elem = g_l_in_first.pos() - g_in_first.pos();
-    DASH_LOG_TRACE_VAR("dash::copy_async", num_prelocal_elem);
-    if (num_prelocal_elem > 0) {
-      DASH_LOG_TRACE("dash::copy_async",
-                     "copy global range preceding local subrange",
-                     "g_in_first:", g_in_first.pos(),
-                     "g_in_last:",  g_l_in_first.pos());
-      // ... [ --- copy --- | ... l ... | ........ ]
-      //     ^              ^           ^          ^
-      //     in_first       l_in_first  l_in_last  in_last
-      dash::internal::copy_impl(g_in_first,
-                                g_l_in_first,
-                                dest_first,
-                                *handles);
-      // Advance output pointers:
-      out_last   += num_prelocal_elem;
-      dest_first  = out_last;
-    }
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements succeeding the local subrange:
-    //
-    auto num_postlocal_elem = in_last.pos() - g_l_offset_end;
-    DASH_LOG_TRACE_VAR("dash::copy_async", num_postlocal_elem);
-    if (num_postlocal_elem > 0) {
-      dest_first += num_local_elem;
-      DASH_LOG_TRACE("dash::copy_async",
-                     "copy global range succeeding local subrange",
-                     "in_first:", g_l_in_last.pos(),
-                     "in_last:",  g_in_last.pos());
-      // ... [ ........ | ... l ... | --- copy --- ]
-      //     ^          ^           ^              ^
-      //     in_first   l_in_first  l_in_last      in_last
-      dash::internal::copy_impl(g_l_in_last,
-                                g_in_last,
-                                dest_first,
-                                *handles);
-      out_last += num_postlocal_elem;
-    }
-    //
-    // -----------------------------------------------------------------------
-    // Copy local subrange:
-    //
-    // Convert local subrange of global input to native pointers:
-    //
-    // ... [ ........ | --- l --- | ........ ]
-    //     ^          ^           ^          ^
-    //     in_first   l_in_first  l_in_last  in_last
-    //
-    ValueType * l_in_first = g_l_in_first.local();
-    ValueType * l_in_last  = l_in_first + num_local_elem;
-    DASH_LOG_TRACE_VAR("dash::copy_async", l_in_first);
-    DASH_LOG_TRACE_VAR("dash::copy_async", l_in_last);
-    // Verify conversion of global input iterators to local pointers:
-    DASH_ASSERT_MSG(l_in_first != nullptr,
-                    "dash::copy_async: first index in global input (" <<
-                    g_l_in_first.pos() << ") is not local");
-
-    DASH_LOG_TRACE("dash::copy_async", "copy local subrange",
-                   "num_copy_elem:", l_in_last - l_in_first);
-    ValueType * local_out_first = out_first + num_prelocal_elem;
-    ValueType * local_out_last  = local_out_first + num_local_elem;
-
-    // Use memcpy for data ranges below 64 KB
-    if (use_memcpy) {
-      std::memcpy(local_out_first, // destination
-                  l_in_first,      // source
-                  num_local_elem * sizeof(ValueType));
-      local_out_last = local_out_first + num_local_elem;
-    } else {
-      local_out_last = std::copy(l_in_first,
-                                 l_in_last,
-                                 local_out_first);
-    }
-    DASH_LOG_TRACE("dash::copy_async", "<< std::shared_future >>",
-                   "finished local copy of",
-                   (local_out_last - local_out_first),
-                   "elements");
-    out_last += (local_out_last - local_out_first);
-  } else {
-    DASH_LOG_TRACE("dash::copy_async", "no local subrange");
-    // All elements in input range are remote
-    dash::internal::copy_impl(in_first,
-                              in_last,
-                              dest_first,
-                              *handles);
-    out_last = out_first + total_copy_elem;
-  }
+  // One get per segment of the input range that is contiguous at a unit,
+  // local segments are copied directly:
+  dash::internal::copy_impl(in_first,
+                            in_last,
+                            dest_first,
+                            *handles);
+  out_last = out_first + total_copy_elem;
   DASH_LOG_TRACE("dash::copy_async", "preparing future");
   if (handles->size() == 0) {
     DASH_LOG_TRACE("dash::copy_async >", "finished (no pending handles), ",
@@ -573,130 +468,22 @@ ValueType * copy(
     return out_last;
   }
 
-  std::vector<dart_handle_t> handles;
+  // Handles are released before returning, allocate from scratch arena:
+  auto & arena = dash::util::ScratchArena::local();
+  dash::util::ScratchArena::Scope arena_scope(arena);
+  dash::internal::scratch_handles_t handles(
+    (dash::util::ScratchAllocator<dart_handle_t>(arena)));
 
   DASH_LOG_TRACE("dash::copy", "local range:",
                  li_range_in.begin,
                  li_range_in.end,
                  "in_first.is_local:", in_first.is_local());
-  // Check if global input range is partially local:
-  if (num_local_elem > 0) {
-    // Part of the input range is local, copy local input subrange to local
-    // output range directly.
-    auto pattern          = in_first.pattern();
-    // Map input iterators to global index domain:
-    auto g_in_first       = in_first.global();
-    auto g_in_last        = g_in_first + total_copy_elem;
-    DASH_LOG_TRACE("dash::copy", "resolving local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy", num_local_elem);
-    // Local index range to global input index range:
-    // Global index of local range begin index:
-    auto g_l_offset_begin = pattern.global(li_range_in.begin);
-    // Global index of local range end index:
-    auto g_l_offset_end   = pattern.global(li_range_in.end-1)
-                            + 1; // pat.global(l_end) would be out of range
-    DASH_LOG_TRACE("dash::copy",
-                   "global index range of local subrange:",
-                   "begin:", g_l_offset_begin, "end:", g_l_offset_end);
-
-    // Global position of input start iterator:
-    auto g_offset_begin   = g_in_first.pos();
-    // Convert local subrange to global iterators:
-    auto g_l_in_first     = g_in_first + (g_l_offset_begin - g_offset_begin);
-    auto g_l_in_last      = g_in_first + (g_l_offset_end   - g_offset_begin);
-    DASH_LOG_TRACE("dash::copy", "global it. range of local subrange:",
-                   "begin:", g_l_in_first.pos(), "end:", g_l_in_last.pos());
-    DASH_LOG_TRACE_VAR("dash::copy", g_l_in_last.pos());
-
-    auto num_prelocal_elem  = g_l_in_first.pos() - g_in_first.pos();
-    auto num_postlocal_elem = in_last.pos() - g_l_offset_end;
-    DASH_LOG_TRACE_VAR("dash::copy", num_prelocal_elem);
-    DASH_LOG_TRACE_VAR("dash::copy", num_postlocal_elem);
-
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements preceding the local subrange:
-    //
-    if (num_prelocal_elem > 0) {
-      DASH_LOG_TRACE("dash::copy",
-                     "copy global range preceding local subrange",
-                     "g_in_first:", g_in_first.pos(),
-                     "g_in_last:",  g_l_in_first.pos());
-      // ... [ --- copy --- | ... l ... | ........ ]
-      //     ^              ^           ^          ^
-      //     in_first       l_in_first  l_in_last  in_last
-      out_last = dash::internal::copy_impl(g_in_first,
-                                           g_l_in_first,
-                                           dest_first,
-                                           handles);
-      // Advance output pointers:
-      dest_first = out_last;
-    }
-    //
-    // -----------------------------------------------------------------------
-    // Copy local subrange:
-    //
-    // Convert local subrange of global input to native pointers:
-    //
-    // ... [ ........ | --- l --- | ........ ]
-    //     ^          ^           ^          ^
-    //     in_first   l_in_first  l_in_last  in_last
-    //
-    ValueType * l_in_first = g_l_in_first.local();
-    ValueType * l_in_last  = l_in_first + num_local_elem;
-    DASH_LOG_TRACE_VAR("dash::copy", l_in_first);
-    DASH_LOG_TRACE_VAR("dash::copy", l_in_last);
-    // Verify conversion of global input iterators to local pointers:
-    DASH_ASSERT_MSG(l_in_first != nullptr,
-                    "dash::copy: first index in global input (" <<
-                    g_l_in_first.pos() << ") is not local");
-
-    DASH_LOG_TRACE("dash::copy", "copy local subrange",
-                   "num_copy_elem:", l_in_last - l_in_first);
-    // Use memcpy for data ranges below 64 KB
-    if (use_memcpy) {
-      std::memcpy(dest_first, // destination
-                  l_in_first, // source
-                  num_local_elem * sizeof(ValueType));
-      out_last = dest_first + num_local_elem;
-    } else {
-      out_last = std::copy(l_in_first,
-                           l_in_last,
-                           dest_first);
-    }
-    // Assert that all elements in local range have been copied:
-    DASH_ASSERT_EQ(out_last, dest_first + num_local_elem,
-                   "Expected to copy " << num_local_elem << " local elements "
-                   "but copied " << (out_last - dest_first));
-    DASH_LOG_TRACE("dash::copy", "finished local copy of",
-                   (out_last - dest_first), "elements");
-    // Advance output pointers:
-    dest_first = out_last;
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements succeeding the local subrange:
-    //
-    if (num_postlocal_elem > 0) {
-      DASH_LOG_TRACE("dash::copy",
-                     "copy global range succeeding local subrange",
-                     "in_first:", g_l_in_last.pos(),
-                     "in_last:",  g_in_last.pos());
-      // ... [ ........ | ... l ... | --- copy --- ]
-      //     ^          ^           ^              ^
-      //     in_first   l_in_first  l_in_last      in_last
-      out_last = dash::internal::copy_impl(g_l_in_last,
-                                           g_in_last,
-                                           dest_first,
-                                           handles);
-    }
-  } else {
-    DASH_LOG_TRACE("dash::copy", "no local subrange");
-    // All elements in input range are remote
-    out_last = dash::internal::copy_impl(in_first,
-                                         in_last,
-                                         dest_first,
-                                         handles);
-  }
+  // One get per segment of the input range that is contiguous at a unit,
+  // local segments are copied directly:
+  out_last = dash::internal::copy_impl(in_first,
+                                       in_last,
+                                       dest_first,
+                                       handles);
 
   if (handles.size() > 0) {
     DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
@@ -802,81 +589,20 @@ GlobOutputIt copy(
   // Return value, initialize with begin of output range, indicating no values
   // have been copied:
   GlobOutputIt out_last   = out_first;
-  // Number of elements to copy in total:
-  auto num_elements       = std::distance(in_first, in_last);
-  DASH_LOG_TRACE_VAR("dash::copy", num_elements);
-  // Global iterator pointing at hypothetical end of output range:
-  GlobOutputIt out_h_last = out_first + num_elements;
+  DASH_LOG_TRACE_VAR("dash::copy", std::distance(in_first, in_last));
   DASH_LOG_TRACE_VAR("dash::copy", out_first.pos());
-  DASH_LOG_TRACE_VAR("dash::copy", out_h_last.pos());
-  // Test if a subrange of global output range is local:
-  auto li_range_out       = local_index_range(out_first, out_h_last);
-  DASH_LOG_TRACE_VAR("dash::copy", li_range_out.begin);
-  DASH_LOG_TRACE_VAR("dash::copy", li_range_out.end);
-  // Number of elements in the local subrange:
-  auto num_local_elem     = li_range_out.end - li_range_out.begin;
-  // handles to wait on at the end
-  std::vector<dart_handle_t> handles;
-  // Check if part of the output range is local:
-  if (num_local_elem > 0) {
-    // Part of the output range is local
-    // Copy local input subrange to local output range directly:
-    auto pattern            = out_first.pattern();
-    DASH_LOG_TRACE("dash::copy", "resolving local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy", num_local_elem);
-    // Local index range to global output index range:
-    auto g_l_offset_begin   = pattern.global(li_range_out.begin);
-    DASH_LOG_TRACE_VAR("dash::copy", g_l_offset_begin);
-    auto g_l_offset_end     = pattern.global(li_range_out.end-1)
-                              + 1; // pat.global(l_end) would be out of range
-    DASH_LOG_TRACE_VAR("dash::copy", g_l_offset_end);
-    // Offset of local subrange in output range
-    auto l_elem_offset      = g_l_offset_begin - out_first.pos();
-    DASH_LOG_TRACE_VAR("dash::copy",l_elem_offset);
-    // Convert local subrange of global output to native pointers:
-    ValueType * l_out_first = (out_first + l_elem_offset).local();
-    DASH_LOG_TRACE_VAR("dash::copy", l_out_first);
-    ValueType * l_out_last  = l_out_first + num_local_elem;
-    DASH_LOG_TRACE_VAR("dash::copy", l_out_last);
-    // ... [ ........ | ---- l ---- | ......... ] ...
-    //     ^          ^             ^           ^
-    //     out_first  l_out_first   l_out_last  out_last
-    out_last                = out_first + num_local_elem;
-    // Assert that all elements in local range have been copied:
-    DASH_LOG_TRACE("dash::copy", "copying local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy", in_first);
-    DASH_ASSERT_RETURNS(
-      std::copy(in_first + l_elem_offset,
-                in_first + l_elem_offset + num_local_elem,
-                l_out_first),
-      l_out_last);
-    // Copy to remote elements preceding the local subrange:
-    if (g_l_offset_begin > out_first.pos()) {
-      DASH_LOG_TRACE("dash::copy", "copy to global preceding local subrange");
-      out_last = dash::internal::copy_impl(
-                   in_first,
-                   in_first + l_elem_offset,
-                   out_first,
-                   handles);
-    }
-    // Copy to remote elements succeeding the local subrange:
-    if (g_l_offset_end < out_h_last.pos()) {
-      DASH_LOG_TRACE("dash::copy", "copy to global succeeding local subrange");
-      out_last = dash::internal::copy_impl(
-                   in_first + l_elem_offset + num_local_elem,
-                   in_last,
-                   out_first + num_local_elem,
-                   handles);
-    }
-  } else {
-    // All elements in output range are remote
-    DASH_LOG_TRACE("dash::copy", "no local subrange");
-    out_last = dash::internal::copy_impl(
-                 in_first,
-                 in_last,
-                 out_first,
-                 handles);
-  }
+  // handles to wait on at the end, released before returning:
+  auto & arena = dash::util::ScratchArena::local();
+  dash::util::ScratchArena::Scope arena_scope(arena);
+  dash::internal::scratch_handles_t handles(
+    (dash::util::ScratchAllocator<dart_handle_t>(arena)));
+  // One put per segment of the output range that is contiguous at a unit,
+  // local segments are copied directly:
+  out_last = dash::internal::copy_impl(
+               in_first,
+               in_last,
+               out_first,
+               handles);
 
   if (handles.size() > 0) {
     DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
@@ -937,10 +663,99 @@ copy_async(
 }
 #endif
 
+namespace internal {
+
+/**
+ * Global-to-global copy for output ranges in views: every unit puts the
+ * elements in its local segments of the input range to the output range.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class HandleVector >
+void copy_global_impl(
+  GlobInputIt    in_first,
+  GlobInputIt    in_last,
+  GlobOutputIt   out_first,
+  HandleVector & handles,
+  std::true_type /* output has view */)
+{
+  typedef typename GlobInputIt::index_type    index_type;
+  typedef typename GlobInputIt::local_pointer local_pointer;
+  dash::for_each_segment(
+    in_first, in_last,
+    [&](const GlobSegment<index_type, local_pointer> & segment) {
+      if (segment.lbegin != nullptr) {
+        dash::internal::copy_impl(segment.lbegin,
+                                  segment.lbegin + segment.size,
+                                  out_first + segment.offset,
+                                  handles);
+      }
+    });
+  if (handles.size() > 0) {
+    dart_waitall(handles.data(), handles.size());
+  }
+}
+
+/**
+ * Global-to-global copy: every unit reads the elements of the input range
+ * corresponding to its local elements in the output range, walking its
+ * local memory in runs of consecutive global indices.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class HandleVector >
+void copy_global_impl(
+  GlobInputIt    in_first,
+  GlobInputIt    in_last,
+  GlobOutputIt   out_first,
+  HandleVector & handles,
+  std::false_type /* output has view */)
+{
+  typedef typename GlobOutputIt::index_type index_type;
+  const auto & pattern   = out_first.pattern();
+  index_type   out_begin = out_first.pos();
+  index_type   out_end   = out_begin + dash::distance(in_first, in_last);
+  index_type   lsize     = pattern.local_size();
+  auto         out_gbegin = out_first - out_begin;
+  index_type   l = 0;
+  while (l < lsize) {
+    index_type g     = pattern.global(l);
+    index_type count = 1;
+    while (l + count < lsize && pattern.global(l + count) == g + count) {
+      ++count;
+    }
+    // Part of the run in the output range:
+    index_type r_begin = std::max(g, out_begin);
+    index_type r_end   = std::min(g + count, out_end);
+    if (r_begin < r_end) {
+      auto in_run = in_first + (r_begin - out_begin);
+      dash::internal::copy_impl(in_run,
+                                in_run + (r_end - r_begin),
+                                (out_gbegin + r_begin).local(),
+                                handles);
+    }
+    l += count;
+  }
+  if (handles.size() > 0) {
+    dart_waitall_local(handles.data(), handles.size());
+  }
+}
+
+} // namespace internal
+
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Collective operation, every unit reads the elements of the input range
+ * that are copied to its local elements of the output range, so the cost
+ * at every unit depends on the number of its local elements only.
+ * Elements in the input range must have been written before the copy,
+ * units must be synchronized before elements in the output range are
+ * read.
+ *
  * \ingroup  DashAlgorithms
  */
 template <
@@ -954,11 +769,16 @@ GlobOutputIt copy(
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
 
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
+  auto & arena = dash::util::ScratchArena::local();
+  dash::util::ScratchArena::Scope arena_scope(arena);
+  dash::internal::scratch_handles_t handles(
+    (dash::util::ScratchAllocator<dart_handle_t>(arena)));
 
-  return GlobOutputIt();
+  dash::internal::copy_global_impl(
+    in_first, in_last, out_first, handles,
+    typename GlobOutputIt::has_view());
+  DASH_LOG_TRACE("dash::copy >", "num_handles:", handles.size());
+  return out_first + (in_last - in_first);
 }
 
 #endif // DOXYGEN
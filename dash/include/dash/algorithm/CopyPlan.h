@@ -0,0 +1,359 @@
+#ifndef DASH__ALGORITHM__COPY_PLAN_H__INCLUDED
+#define DASH__ALGORITHM__COPY_PLAN_H__INCLUDED
+
+#include <dash/Future.h>
+#include <dash/Onesided.h>
+#include <dash/Exception.h>
+
+#include <dash/iterator/GlobSegment.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Communication plan of a copy operation between a global and a local
+ * range that is executed repeatedly.
+ *
+ * The segments of the global range that are contiguous in the local memory
+ * of a unit are resolved once when the plan is created. Adjacent segments
+ * at the same unit are coalesced.
+ * Every execution of the plan issues one one-sided transfer per remaining
+ * remote segment and copies segments in the calling unit's local memory
+ * directly, without mapping the range to the pattern again.
+ *
+ * The plan references the local and global ranges it has been created for,
+ * both must remain valid while the plan is used.
+ * At most one execution of a plan may be in progress.
+ *
+ * \code
+ *   // Every iteration reads the same halo range from a neighbor:
+ *   auto plan = dash::copy_plan(halo_first, halo_last, halo_buffer);
+ *   for (int iter = 0; iter < num_iter; ++iter) {
+ *     auto fut = plan.execute_async();
+ *     compute_inner();
+ *     fut.wait();
+ *     compute_border();
+ *     array.barrier();
+ *   }
+ * \endcode
+ *
+ * \tparam  ValueType  Type of the elements in the local range.
+ * \tparam  OutputIt   Type of the output iterator, \c ValueType * for
+ *                     global-to-local copies or a global iterator type for
+ *                     local-to-global copies.
+ *
+ * \see  dash::copy_plan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    OutputIt >
+class CopyPlan
+{
+private:
+  typedef CopyPlan<ValueType, OutputIt>  self_t;
+
+public:
+  typedef ValueType                      value_type;
+  typedef size_t                          size_type;
+
+private:
+  /// Segment of the global range in the calling unit's local memory.
+  struct local_chunk {
+    const value_type * src;
+    value_type       * dst;
+    size_type          count;
+  };
+
+  /// Segment of the global range in the local memory of a remote unit.
+  struct remote_chunk {
+    dart_gptr_t        gptr;
+    value_type       * buf;
+    size_type          count;
+    /// Owner and local offset at the owner, used for coalescing
+    team_unit_t        unit;
+    size_type          lindex;
+  };
+
+public:
+  /**
+   * Creates a plan for copying elements from the global range
+   * <tt>[in_first, in_last)</tt> to the local range starting at
+   * \c out_first.
+   */
+  template<class GlobInputIt>
+  CopyPlan(
+    GlobInputIt   in_first,
+    GlobInputIt   in_last,
+    value_type  * out_first)
+  : _put(false),
+    _out_last(out_first + (in_last - in_first))
+  {
+    typedef typename GlobInputIt::index_type    index_type;
+    typedef typename GlobInputIt::local_pointer local_pointer;
+    DASH_LOG_TRACE("CopyPlan()", "global to local");
+    dash::for_each_segment(
+      in_first, in_last,
+      [&](const GlobSegment<index_type, local_pointer> & segment) {
+        value_type * buf = out_first + segment.offset;
+        if (segment.lbegin != nullptr) {
+          add_local(segment.lbegin, buf, segment.size);
+        } else {
+          add_remote(segment.gptr, buf, segment.size,
+                     segment.unit, segment.lindex);
+        }
+      });
+    DASH_LOG_TRACE("CopyPlan >",
+                   "local chunks:",  _local_chunks.size(),
+                   "remote chunks:", _remote_chunks.size());
+  }
+
+  /**
+   * Creates a plan for copying elements from the local range
+   * <tt>[in_first, in_last)</tt> to the global range starting at
+   * \c out_first.
+   */
+  template<class GlobOutputIt>
+  CopyPlan(
+    value_type    * in_first,
+    value_type    * in_last,
+    GlobOutputIt    out_first)
+  : _put(true),
+    _out_last(out_first + std::distance(in_first, in_last))
+  {
+    typedef typename GlobOutputIt::index_type    index_type;
+    typedef typename GlobOutputIt::local_pointer local_pointer;
+    DASH_LOG_TRACE("CopyPlan()", "local to global");
+    dash::for_each_segment(
+      out_first, _out_last,
+      [&](const GlobSegment<index_type, local_pointer> & segment) {
+        value_type * buf = in_first + segment.offset;
+        if (segment.lbegin != nullptr) {
+          add_local(buf, segment.lbegin, segment.size);
+        } else {
+          add_remote(segment.gptr, buf, segment.size,
+                     segment.unit, segment.lindex);
+        }
+      });
+    DASH_LOG_TRACE("CopyPlan >",
+                   "local chunks:",  _local_chunks.size(),
+                   "remote chunks:", _remote_chunks.size());
+  }
+
+  CopyPlan(const self_t & other)            = delete;
+  CopyPlan(self_t && other)                 = default;
+  self_t & operator=(const self_t & other)  = delete;
+  self_t & operator=(self_t && other)       = default;
+
+  ~CopyPlan()
+  {
+    if (!_handles.empty()) {
+      wait();
+    }
+  }
+
+  /**
+   * Executes the copy operation, blocks until all elements have been
+   * copied.
+   *
+   * \returns  The end of the output range.
+   */
+  OutputIt execute()
+  {
+    start();
+    wait();
+    return _out_last;
+  }
+
+  /**
+   * Starts the copy operation.
+   *
+   * Transfers of remote segments are in progress when the returned future
+   * is ready, the plan must not be executed again, moved or destroyed
+   * before.
+   *
+   * \returns  Future of the end of the output range.
+   */
+  dash::Future<OutputIt> execute_async()
+  {
+    start();
+    if (_handles.empty()) {
+      return dash::Future<OutputIt>(_out_last);
+    }
+    return dash::Future<OutputIt>(
+      // get
+      [this]() {
+        wait();
+        return _out_last;
+      },
+      // test
+      [this](OutputIt * out) {
+        if (!test()) {
+          return false;
+        }
+        *out = _out_last;
+        return true;
+      });
+  }
+
+  /// Number of one-sided transfers issued per execution.
+  size_type num_transfers() const noexcept
+  {
+    return _remote_chunks.size();
+  }
+
+  /// Number of segments in local memory copied per execution.
+  size_type num_local_copies() const noexcept
+  {
+    return _local_chunks.size();
+  }
+
+private:
+  void add_local(
+    const value_type * src,
+    value_type       * dst,
+    size_type          count)
+  {
+    if (!_local_chunks.empty()) {
+      auto & prev = _local_chunks.back();
+      if (prev.src + prev.count == src && prev.dst + prev.count == dst) {
+        prev.count += count;
+        return;
+      }
+    }
+    _local_chunks.push_back(local_chunk { src, dst, count });
+  }
+
+  void add_remote(
+    dart_gptr_t        gptr,
+    value_type       * buf,
+    size_type          count,
+    team_unit_t        unit,
+    size_type          lindex)
+  {
+    if (!_remote_chunks.empty()) {
+      auto & prev = _remote_chunks.back();
+      if (prev.unit == unit && prev.lindex + prev.count == lindex &&
+          prev.buf + prev.count == buf) {
+        prev.count += count;
+        return;
+      }
+    }
+    _remote_chunks.push_back(
+      remote_chunk { gptr, buf, count, unit, lindex });
+  }
+
+  void start()
+  {
+    DASH_ASSERT_MSG(_handles.empty(),
+                    "CopyPlan: previous execution still in progress");
+    _handles.reserve(_remote_chunks.size());
+    // Issue remote transfers first so they overlap with local copies:
+    for (const auto & chunk : _remote_chunks) {
+      dart_handle_t handle;
+      if (_put) {
+        dash::internal::put_handle(chunk.gptr, chunk.buf, chunk.count,
+                                   &handle);
+      } else {
+        dash::internal::get_handle(chunk.gptr, chunk.buf, chunk.count,
+                                   &handle);
+      }
+      if (handle != DART_HANDLE_NULL) {
+        _handles.push_back(handle);
+      }
+    }
+    for (const auto & chunk : _local_chunks) {
+      std::copy(chunk.src, chunk.src + chunk.count, chunk.dst);
+    }
+  }
+
+  void wait()
+  {
+    if (_handles.empty()) {
+      return;
+    }
+    DASH_LOG_TRACE("CopyPlan.wait()", "handles:", _handles.size());
+    // Written elements must be visible at their owners when the copy
+    // to the global range has completed:
+    DASH_ASSERT_RETURNS(
+      _put ? dart_waitall(_handles.data(), _handles.size())
+           : dart_waitall_local(_handles.data(), _handles.size()),
+      DART_OK);
+    _handles.clear();
+  }
+
+  bool test()
+  {
+    if (_handles.empty()) {
+      return true;
+    }
+    int32_t flag;
+    DASH_ASSERT_RETURNS(
+      _put ? dart_testall(_handles.data(), _handles.size(), &flag)
+           : dart_testall_local(_handles.data(), _handles.size(), &flag),
+      DART_OK);
+    if (flag) {
+      _handles.clear();
+    }
+    return (flag != 0);
+  }
+
+private:
+  bool                          _put;
+  OutputIt                      _out_last;
+  std::vector<local_chunk>      _local_chunks;
+  std::vector<remote_chunk>     _remote_chunks;
+  std::vector<dart_handle_t>    _handles;
+};
+
+/**
+ * Creates a plan for repeated copies of the elements in the global range
+ * <tt>[in_first, in_last)</tt> to the local range starting at
+ * \c out_first.
+ *
+ * \see  dash::CopyPlan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    GlobInputIt >
+CopyPlan<ValueType, ValueType *> copy_plan(
+  GlobInputIt   in_first,
+  GlobInputIt   in_last,
+  ValueType   * out_first)
+{
+  return CopyPlan<ValueType, ValueType *>(in_first, in_last, out_first);
+}
+
+/**
+ * Creates a plan for repeated copies of the elements in the local range
+ * <tt>[in_first, in_last)</tt> to the global range starting at
+ * \c out_first.
+ *
+ * \see  dash::CopyPlan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    GlobOutputIt >
+CopyPlan<ValueType, GlobOutputIt> copy_plan(
+  ValueType    * in_first,
+  ValueType    * in_last,
+  GlobOutputIt   out_first)
+{
+  return CopyPlan<ValueType, GlobOutputIt>(in_first, in_last, out_first);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__COPY_PLAN_H__INCLUDED
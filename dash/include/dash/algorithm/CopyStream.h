@@ -0,0 +1,163 @@
+#ifndef DASH__ALGORITHM__COPY_STREAM_H__INCLUDED
+#define DASH__ALGORITHM__COPY_STREAM_H__INCLUDED
+
+#include <dash/Onesided.h>
+#include <dash/Exception.h>
+
+#include <dash/iterator/GlobSegment.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <deque>
+
+
+namespace dash {
+
+namespace internal {
+
+/// Default size of a chunk in \c dash::copy_stream, in bytes.
+constexpr size_t copy_stream_chunk_bytes  = 256 * 1024;
+/// Default maximum number of pending transfers in \c dash::copy_stream.
+constexpr size_t copy_stream_max_pending  = 8;
+
+} // namespace internal
+
+/**
+ * Copies the elements in the global range <tt>[in_first, in_last)</tt> to
+ * the local range starting at \c out_first in chunks and invokes a function
+ * on every chunk as soon as it has been copied.
+ *
+ * Chunks consist of at most \c chunk_size elements that are contiguous in
+ * the local memory of a unit. At most \c max_pending transfers of remote
+ * chunks are in progress at any time, so processing of copied chunks
+ * overlaps with the transfer of the following chunks and the resources
+ * used for outstanding transfers are bounded for arbitrarily large ranges.
+ *
+ * Chunks of remote elements are passed to the function in the order in
+ * which they have been requested. Chunks in the calling unit's local
+ * memory are passed to the function once they have been copied and may
+ * precede chunks of remote elements that are still in transfer.
+ *
+ * \code
+ *   double sum = 0;
+ *   dash::copy_stream(
+ *     array.begin(), array.end(), buffer,
+ *     [&](const double * first, const double * last) {
+ *       sum = std::accumulate(first, last, sum);
+ *     });
+ * \endcode
+ *
+ * \returns  The end of the output range.
+ *
+ * \tparam  ChunkFunction  Function object invoked with pointers to the
+ *                         first and past the last element of a chunk in
+ *                         the output range.
+ *
+ * \see  dash::copy
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class    GlobInputIt,
+  class    ChunkFunction >
+ValueType * copy_stream(
+  /// Iterator to the first element in the global input range
+  GlobInputIt     in_first,
+  /// Iterator past the last element in the global input range
+  GlobInputIt     in_last,
+  /// Pointer to the first element in the local output range
+  ValueType     * out_first,
+  /// Function to invoke on every copied chunk
+  ChunkFunction   chunk_func,
+  /// Maximum number of elements in a chunk
+  size_t          chunk_size  = std::max<size_t>(
+                                  1,
+                                  internal::copy_stream_chunk_bytes /
+                                    sizeof(ValueType)),
+  /// Maximum number of transfers in progress
+  size_t          max_pending = internal::copy_stream_max_pending)
+{
+  typedef typename GlobInputIt::index_type    index_type;
+  typedef typename GlobInputIt::local_pointer local_pointer;
+
+  struct pending_chunk {
+    dart_handle_t   handle;
+    ValueType     * first;
+    ValueType     * last;
+  };
+
+  DASH_LOG_TRACE("dash::copy_stream()",
+                 "chunk size:",  chunk_size,
+                 "max pending:", max_pending);
+  chunk_size  = std::max<size_t>(chunk_size, 1);
+  max_pending = std::max<size_t>(max_pending, 1);
+
+  std::deque<pending_chunk> pending;
+  // Passes the oldest pending chunk to the chunk function if its transfer
+  // has completed, waits for completion if requested:
+  auto complete_front = [&](bool wait) {
+    auto & chunk = pending.front();
+    if (wait) {
+      DASH_ASSERT_RETURNS(dart_wait_local(&chunk.handle), DART_OK);
+    } else {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(dart_test_local(&chunk.handle, &flag), DART_OK);
+      if (!flag) {
+        return false;
+      }
+    }
+    chunk_func(chunk.first, chunk.last);
+    pending.pop_front();
+    return true;
+  };
+
+  dash::for_each_segment(
+    in_first, in_last,
+    [&](const GlobSegment<index_type, local_pointer> & segment) {
+      for (index_type offset = 0; offset < segment.size; ) {
+        index_type  nelem = std::min<index_type>(
+                              chunk_size, segment.size - offset);
+        ValueType * first = out_first + segment.offset + offset;
+        ValueType * last  = first + nelem;
+        if (segment.lbegin != nullptr) {
+          std::copy(segment.lbegin + offset,
+                    segment.lbegin + offset + nelem,
+                    first);
+          chunk_func(first, last);
+        } else {
+          if (pending.size() >= max_pending) {
+            complete_front(true);
+          }
+          dart_gptr_t   gptr = segment.gptr;
+          dart_gptr_incaddr(&gptr, offset * sizeof(ValueType));
+          dart_handle_t handle;
+          dash::internal::get_handle(gptr, first, nelem, &handle);
+          if (handle == DART_HANDLE_NULL && pending.empty()) {
+            chunk_func(first, last);
+          } else {
+            // Completed chunks are queued behind older pending chunks to
+            // preserve the request order:
+            pending.push_back(pending_chunk { handle, first, last });
+          }
+        }
+        offset += nelem;
+        // Hand over chunks that arrived in the meantime:
+        while (!pending.empty() && complete_front(false)) { }
+      }
+    });
+
+  while (!pending.empty()) {
+    complete_front(true);
+  }
+  DASH_LOG_TRACE("dash::copy_stream >");
+  return out_first + (in_last - in_first);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__COPY_STREAM_H__INCLUDED
@@ -4,6 +4,7 @@
 #include <dash/internal/Config.h>
 
 #include <dash/iterator/GlobIter.h>
+#include <dash/iterator/GlobSegment.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
@@ -12,6 +13,8 @@
 
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+
 #ifdef DASH_ENABLE_OPENMP
 #include <omp.h>
 #endif
@@ -24,10 +27,13 @@ namespace dash {
  *
  * Being a collaborative operation, each unit will assign the value to
  * its local elements only.
+ * Local elements in ranges of views and in partial ranges of
+ * multi-dimensional patterns are resolved in contiguous segments.
  *
  * \tparam      ElementType  Type of the elements in the sequence
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ *              pattern and \c nl local elements within the global range,
+ *              O(s) + O(nl) for \c s segments in ranges of views
  *
  * \ingroup     DashAlgorithms
  */
@@ -43,6 +49,18 @@ void fill(
   typedef typename GlobIterType::index_type index_t;
   typedef typename GlobIterType::value_type value_t;
 
+  if (!dash::internal::is_local_range_contiguous(first, last)) {
+    typedef typename GlobIterType::local_pointer local_pointer;
+    dash::for_each_segment(
+      first, last,
+      [&](const GlobSegment<index_t, local_pointer> & segment) {
+        if (segment.lbegin != nullptr) {
+          std::fill(segment.lbegin, segment.lbegin + segment.size, value);
+        }
+      });
+    return;
+  }
+
   // Global iterators to local range:
   auto      index_range = dash::local_range(first, last);
   value_t * lfirst      = index_range.begin;
@@ -2,6 +2,7 @@
 #define DASH__ALGORITHM__FOR_EACH_H__
 
 #include <dash/iterator/GlobIter.h>
+#include <dash/iterator/GlobSegment.h>
 #include <dash/algorithm/LocalRange.h>
 
 #include <algorithm>
@@ -41,11 +42,25 @@ void for_each(
   static_assert(
       iterator_traits::is_global_iterator::value,
       "must be a global iterator");
+  auto & team = first.pattern().team();
+  if (!dash::internal::is_local_range_contiguous(first, last)) {
+    typedef typename GlobInputIt::index_type    index_t;
+    typedef typename GlobInputIt::local_pointer local_pointer;
+    dash::for_each_segment(
+      first, last,
+      [&](const GlobSegment<index_t, local_pointer> & segment) {
+        if (segment.lbegin != nullptr) {
+          std::for_each(segment.lbegin, segment.lbegin + segment.size,
+                        func);
+        }
+      });
+    team.barrier();
+    return;
+  }
   /// Global iterators to local index range:
   auto index_range  = dash::local_index_range(first, last);
   auto lbegin_index = index_range.begin;
   auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
   if (lbegin_index != lend_index) {
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
@@ -72,7 +87,9 @@ void for_each(
  *                                     to \c std::for_each.
  *
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ *              pattern and \c nl local elements within the global range,
+ *              O(s) + O(nl) with \c s contiguous segments in the range if
+ *              its local part is not contiguous
  *
  * \ingroup     DashAlgorithms
  */
@@ -90,11 +107,27 @@ void for_each_with_index(
       iterator_traits::is_global_iterator::value,
       "must be a global iterator");
 
+  auto & team = first.pattern().team();
+  if (!dash::internal::is_local_range_contiguous(first, last)) {
+    typedef typename GlobInputIt::index_type    index_t;
+    typedef typename GlobInputIt::local_pointer local_pointer;
+    // Global indices of local elements are consecutive in segments:
+    dash::for_each_segment(
+      first, last,
+      [&](const GlobSegment<index_t, local_pointer> & segment) {
+        if (segment.lbegin != nullptr) {
+          for (index_t i = 0; i < segment.size; ++i) {
+            func(segment.lbegin[i], segment.gindex + i);
+          }
+        }
+      });
+    team.barrier();
+    return;
+  }
   /// Global iterators to local index range:
   auto index_range  = dash::local_index_range(first, last);
   auto lbegin_index = index_range.begin;
   auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
   if (lbegin_index != lend_index) {
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
@@ -371,6 +371,29 @@ local_range(
            lbegin + lend_index };
 }
 
+namespace internal {
+
+/**
+ * Whether the local elements in the global range [first, last) are
+ * contiguous in local memory, so their local index range can be resolved
+ * from the range's bounds.
+ * This is the case for ranges of global iterators in one-dimensional
+ * patterns and for the full index range of a pattern.
+ */
+template <typename GlobIterType>
+bool is_local_range_contiguous(
+  const GlobIterType & first,
+  const GlobIterType & last)
+{
+  return !GlobIterType::has_view::value &&
+         ( GlobIterType::pattern_type::ndim() == 1 ||
+           ( first.pos() == 0 &&
+             last.pos()  == static_cast<typename GlobIterType::index_type>(
+                              first.pattern().size()) ) );
+}
+
+} // namespace internal
+
 } // namespace dash
 
 #include <dash/algorithm/LocalRanges.h>
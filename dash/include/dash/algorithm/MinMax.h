@@ -10,6 +10,7 @@
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
 #include <dash/util/UnitLocality.h>
+#include <dash/util/ScratchArena.h>
 
 #include <dash/iterator/GlobIter.h>
 #include <dash/internal/Logging.h>
@@ -69,23 +70,18 @@ const ElementType * min_element(
     typedef struct min_pos_t { value_t val; size_t idx; } min_pos;
 
     DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
+    // Thread-local minimum values are transient, allocate from the
+    // unit's scratch arena instead of the heap:
+    auto &    arena            = dash::util::ScratchArena::local();
+    dash::util::ScratchArena::Scope arena_scope(arena);
     int       align_bytes      = uloc.cache_line_size(0);
-    size_t    min_vals_t_size  = n_threads + 1 +
-                                 (align_bytes / sizeof(min_pos));
-    size_t    min_vals_t_bytes = min_vals_t_size * sizeof(min_pos);
-    min_pos * min_vals_t_raw   = new min_pos[min_vals_t_size];
-    void    * min_vals_t_alg   = min_vals_t_raw;
-    min_pos * min_vals_t       = static_cast<min_pos *>(
-                                   dash::align(
-                                     align_bytes,
-                                     sizeof(min_pos),
-                                     min_vals_t_alg,
-                                     min_vals_t_bytes));
-    DASH_LOG_TRACE("dash::min_element", "min * alloc:",   min_vals_t_raw);
+    min_pos * min_vals_t       = arena.allocate<min_pos>(
+                                   n_threads,
+                                   std::max<size_t>(align_bytes,
+                                                    alignof(min_pos)));
+    std::uninitialized_fill_n(min_vals_t, n_threads,
+                              min_pos { min_val_l, 0 });
     DASH_LOG_TRACE("dash::min_element", "min * aligned:", min_vals_t);
-    DASH_LOG_TRACE("dash::min_element", "min * size:",    min_vals_t_bytes);
-    DASH_ASSERT_GE(min_vals_t_bytes, n_threads * sizeof(min_pos),
-                   "Aligned buffer of min_pos has insufficient size");
     DASH_ASSERT_MSG(nullptr != min_vals_t,
                     "Aligned allocation of min_pos returned nullptr");
 
@@ -124,7 +120,6 @@ const ElementType * min_element(
         min_pos_l = mpt;
       }
     }
-    delete[] min_vals_t_raw;
     return (l_range_begin + min_pos_l.idx);
   }
 #endif // DASH_ENABLE_OPENMP
@@ -224,7 +219,14 @@ GlobInputIt min_element(
     index_t  g_index;
   } local_min_t;
 
-  std::vector<local_min_t> local_min_values(team.size());
+  // Gathered local minimum values are transient, allocate from the unit's
+  // scratch arena instead of the heap:
+  auto & arena = dash::util::ScratchArena::local();
+  dash::util::ScratchArena::Scope arena_scope(arena);
+  local_min_t * local_min_values_begin = arena.allocate<local_min_t>(
+                                           team.size());
+  local_min_t * local_min_values_end   = local_min_values_begin
+                                         + team.size();
 
   // Set global index of local minimum to -1 if no local minimum has been
   // found:
@@ -245,7 +247,7 @@ GlobInputIt min_element(
   DASH_ASSERT_RETURNS(
     dart_allgather(
       &local_min,
-      local_min_values.data(),
+      local_min_values_begin,
       sizeof(local_min_t),
       DART_TYPE_BYTE,
       team.dart_id()),
@@ -253,8 +255,8 @@ GlobInputIt min_element(
   trace.exit_state("allgather");
 
 #ifdef DASH_ENABLE_LOGGING
-  for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
-    auto lmin_entry = local_min_values[lmin_u];
+  for (int lmin_u = 0; lmin_u < team.size(); lmin_u++) {
+    auto lmin_entry = local_min_values_begin[lmin_u];
     DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
                    "unit:",    lmin_u,
                    "value:",   lmin_entry.value,
@@ -263,8 +265,8 @@ GlobInputIt min_element(
 #endif
 
   auto gmin_elem_it  = ::std::min_element(
-                           local_min_values.begin(),
-                           local_min_values.end(),
+                           local_min_values_begin,
+                           local_min_values_end,
                            [&](const local_min_t & a,
                                const local_min_t & b) {
                              // Ignore elements with global index -1 (no
@@ -274,7 +276,7 @@ GlobInputIt min_element(
                                       compare(a.value, b.value)));
                            });
 
-  if (gmin_elem_it == local_min_values.end()) {
+  if (gmin_elem_it == local_min_values_end) {
     DASH_LOG_DEBUG_VAR("dash::min_element >", last);
     return last;
   }
@@ -283,7 +285,7 @@ GlobInputIt min_element(
 
   DASH_LOG_TRACE("dash::min_element",
                  "min. value:", gmin_elem_it->value,
-                 "at unit:",    (gmin_elem_it - local_min_values.begin()),
+                 "at unit:",    (gmin_elem_it - local_min_values_begin),
                  "global idx:", gi_minimum);
 
   DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
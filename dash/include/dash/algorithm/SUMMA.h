@@ -7,6 +7,7 @@
 #include <dash/Future.h>
 #include <dash/algorithm/Copy.h>
 #include <dash/util/Trace.h>
+#include <dash/util/ScratchArena.h>
 
 #include <utility>
 
@@ -297,21 +298,20 @@ void summa(
                  "A:", block_a_size,
                  "B:", block_b_size);
 
-#ifdef DASH_ENABLE_MKL
-  value_type * buf_block_a_get    = (value_type *)(mkl_malloc(
-                                      sizeof(value_type) * block_a_size, 64));
-  value_type * buf_block_b_get    = (value_type *)(mkl_malloc(
-                                      sizeof(value_type) * block_b_size, 64));
-  value_type * buf_block_a_comp   = (value_type *)(mkl_malloc(
-                                      sizeof(value_type) * block_a_size, 64));
-  value_type * buf_block_b_comp   = (value_type *)(mkl_malloc(
-                                      sizeof(value_type) * block_b_size, 64));
-#else
-  value_type * buf_block_a_get    = new value_type[block_a_size];
-  value_type * buf_block_b_get    = new value_type[block_b_size];
-  value_type * buf_block_a_comp   = new value_type[block_a_size];
-  value_type * buf_block_b_comp   = new value_type[block_b_size];
-#endif
+  // Temporary blocks are released when returning from summa, allocate
+  // from the unit's scratch arena with alignment as required by MKL.
+  // Blocks of the arena are freed when returning as block buffers are
+  // large and would otherwise remain allocated:
+  auto & arena = dash::util::ScratchArena::local();
+  dash::util::ScratchArena::Scope arena_scope(arena, true);
+  value_type * buf_block_a_get    = arena.allocate<value_type>(
+                                      block_a_size, 64);
+  value_type * buf_block_b_get    = arena.allocate<value_type>(
+                                      block_b_size, 64);
+  value_type * buf_block_a_comp   = arena.allocate<value_type>(
+                                      block_a_size, 64);
+  value_type * buf_block_b_comp   = arena.allocate<value_type>(
+                                      block_b_size, 64);
   // Copy of buffer pointers for swapping, delete[] on swapped pointers tends
   // to crash:
   value_type * local_block_a_get      = buf_block_a_get;
@@ -569,17 +569,6 @@ void summa(
   } // for lb
 
   DASH_LOG_TRACE("dash::summa", "locally completed");
-#ifdef DASH_ENABLE_MKL
-  mkl_free(buf_block_a_get);
-  mkl_free(buf_block_b_get);
-  mkl_free(buf_block_a_comp);
-  mkl_free(buf_block_b_comp);
-#else
-  delete[] buf_block_a_get;
-  delete[] buf_block_b_get;
-  delete[] buf_block_a_comp;
-  delete[] buf_block_b_comp;
-#endif
 
   DASH_LOG_TRACE("dash::summa", "waiting for other units");
   trace.enter_state("barrier");
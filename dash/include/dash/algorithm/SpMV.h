@@ -0,0 +1,138 @@
+#ifndef DASH__ALGORITHM__SPMV_H__INCLUDED
+#define DASH__ALGORITHM__SPMV_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+#include <dash/Types.h>
+
+#include <dash/internal/Logging.h>
+
+#include <vector>
+
+
+namespace dash {
+
+template<typename ElementType, typename IndexType>
+class SparseMatrix;
+
+namespace internal {
+
+/**
+ * Multiplies the given local rows of a sparse matrix in CSR format with a
+ * vector.
+ * Column indices refer to local entries of the vector.
+ */
+template<typename ValueType, typename IndexType>
+void spmv_local_rows(
+  const std::vector<IndexType> & rows,
+  const IndexType              * row_ptr,
+  const IndexType              * col_idx,
+  const ValueType              * values,
+  const ValueType              * x,
+  ValueType                    * y)
+{
+  for (auto row : rows) {
+    ValueType sum = 0;
+    // Contiguous inner loop without branches, vectorized as a gather by
+    // the compiler:
+    const auto begin = row_ptr[row];
+    const auto end   = row_ptr[row + 1];
+    for (auto k = begin; k < end; ++k) {
+      sum += values[k] * x[col_idx[k]];
+    }
+    y[row] = sum;
+  }
+}
+
+} // namespace internal
+
+/**
+ * Multiplies a sparse matrix with a distributed vector, <tt>y = A x</tt>.
+ *
+ * Only the entries of \c x referenced by column indices of the calling
+ * unit's rows are transferred, using the communication plan of the matrix
+ * that is created in the first multiplication with a vector of the same
+ * distribution.
+ * Remote entries are read in one non-blocking get per range of entries
+ * that is contiguous at the owning unit into a buffer kept in the plan,
+ * rows referencing local entries only are computed on the local entries
+ * of \c x while the transfers are in progress.
+ *
+ * Collective operation. Local entries of \c x must not be modified by any
+ * unit until the team is synchronized after the multiplication.
+ *
+ * \param  A  Matrix to multiply, rows distributed like the elements of
+ *            \c y.
+ * \param  x  Vector to multiply, \c A.ncols() elements.
+ * \param  y  Vector to contain the result, \c A.nrows() elements.
+ *
+ * \complexity  O(nnz) local operations for \c nnz local non-zeros of
+ *              \c A, O(r) one-sided transfers for \c r ranges of remote
+ *              entries of \c x.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  typename IndexType,
+  typename VectorTypeX,
+  typename VectorTypeY>
+void spmv(
+  const SparseMatrix<ElementType, IndexType> & A,
+  VectorTypeX                                & x,
+  VectorTypeY                                & y)
+{
+  typedef ElementType value_type;
+
+  DASH_LOG_DEBUG("dash::spmv()");
+  DASH_ASSERT_EQ(static_cast<size_t>(x.size()), A.ncols(),
+                 "dash::spmv: size of x does not match columns of A");
+  DASH_ASSERT_EQ(static_cast<size_t>(y.size()), A.nrows(),
+                 "dash::spmv: size of y does not match rows of A");
+  DASH_ASSERT_EQ(static_cast<size_t>(y.lsize()), A.local_rows(),
+                 "dash::spmv: local rows of y and A differ");
+
+  auto & plan = A.spmv_plan(x.pattern());
+  // Entries of x must be written before they are read by other units:
+  x.barrier();
+
+  // Local entries of x referenced by boundary rows followed by ghost
+  // entries, allocated once in the plan:
+  value_type * x_buf  = plan.buffer();
+  const auto & ranges = plan.ghost_ranges();
+  std::vector<dart_handle_t> handles(ranges.size(), DART_HANDLE_NULL);
+  for (size_t r = 0; r < ranges.size(); ++r) {
+    const auto & range = ranges[r];
+    dash::internal::get_handle(
+      (x.begin() + range.global_index).dart_gptr(),
+      x_buf + range.buffer_offset,
+      range.count,
+      &handles[r]);
+  }
+
+  const auto * row_ptr = A.local_row_ptr().data();
+  const auto * col_idx = plan.local_col_indices().data();
+  const auto * values  = A.local_values();
+  const auto * x_local = x.lbegin();
+  value_type * y_local = y.lbegin();
+
+  // Interior rows read the local entries of x in place:
+  dash::internal::spmv_local_rows(
+    plan.interior_rows(), row_ptr, col_idx, values, x_local, y_local);
+
+  const auto & boundary_x = plan.boundary_x_offsets();
+  for (size_t i = 0; i < boundary_x.size(); ++i) {
+    x_buf[i] = x_local[boundary_x[i]];
+  }
+  DASH_ASSERT_RETURNS(
+    dart_waitall(handles.data(), handles.size()),
+    DART_OK);
+
+  dash::internal::spmv_local_rows(
+    plan.boundary_rows(), row_ptr, col_idx, values, x_buf, y_local);
+  DASH_LOG_DEBUG("dash::spmv >");
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SPMV_H__INCLUDED
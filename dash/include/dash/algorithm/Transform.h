@@ -7,14 +7,18 @@
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/iterator/GlobSegment.h>
 
 #include <dash/Iterator.h>
 
 #include <dash/internal/Config.h>
 #include <dash/util/Trace.h>
+#include <dash/util/ScratchArena.h>
 
 #include <dash/dart/if/dart_communication.h>
 
+#include <type_traits>
+
 #ifdef DASH_ENABLE_OPENMP
 #include <omp.h>
 #endif
@@ -166,6 +170,28 @@ dart_ret_t transform_impl(
   return result;
 }
 
+/**
+ * Accumulates the given local values into the global range starting at
+ * \c out_first, in one blocking accumulate operation per contiguous
+ * segment of the global range.
+ */
+template< typename ValueType, class GlobOutputIt >
+void transform_segments_blocking(
+  ValueType        * values,
+  size_t             nvalues,
+  GlobOutputIt       out_first,
+  dart_operation_t   op)
+{
+  typedef typename GlobOutputIt::index_type    index_t;
+  typedef typename GlobOutputIt::local_pointer local_pointer;
+  dash::for_each_segment(
+    out_first, out_first + static_cast<index_t>(nvalues),
+    [&](const GlobSegment<index_t, local_pointer> & segment) {
+      transform_blocking_impl(
+        segment.gptr, values + segment.offset, segment.size, op);
+    });
+}
+
 struct transform_impl_local_input_it{};
 struct transform_impl_glob_input_it{};
 
@@ -330,33 +356,28 @@ GlobOutputIt transform(
   DASH_ASSERT_MSG(
     team_in_a == pattern_out.team(),
     "dash::transform: Different teams in input- and output ranges");
-  // Resolve local range from global range:
-  auto l_index_range_in_a       = local_index_range(in_a_first, in_a_last);
-  DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.end);
-  // Local range to global offset:
-  auto global_offset            = pattern_in_a.global(
-                                    l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", global_offset);
-  // Number of elements in local range:
-  size_t num_local_elements     = l_index_range_in_a.end -
-                                  l_index_range_in_a.begin;
-  DASH_LOG_TRACE_VAR("dash::transform", num_local_elements);
-  // Global iterator to dart_gptr_t:
-  dart_gptr_t dest_gptr         = (out_first + global_offset).dart_gptr();
-  // Native pointer to local sub-range:
-  auto l_values          = (in_a_first + global_offset).local();
-  // Send accumulate message:
+  // Accumulate local elements of input range a in the output range, one
+  // operation per contiguous segment of local input and of output:
+  typedef typename InputIt::index_type    index_t;
+  typedef typename InputIt::local_pointer local_pointer;
+  index_t out_offset_last = 0;
   trace.enter_state("transform_blocking");
-  dash::internal::transform_blocking_impl(
-      dest_gptr,
-      l_values,
-      num_local_elements,
-      binary_op.dart_operation());
+  dash::for_each_segment(
+    in_a_first, in_a_last,
+    [&](const GlobSegment<index_t, local_pointer> & segment) {
+      if (segment.lbegin == nullptr) {
+        return;
+      }
+      dash::internal::transform_segments_blocking(
+        segment.lbegin,
+        segment.size,
+        out_first + segment.offset,
+        binary_op.dart_operation());
+      out_offset_last = segment.offset + segment.size;
+    });
   trace.exit_state("transform_blocking");
 
-  return out_first + global_offset + num_local_elements;
-
+  return out_first + out_offset_last;
 }
 
 template <
@@ -383,20 +404,28 @@ GlobOutputIt transform(
   auto in_last  = in_a_last;
 
   using value_type = typename dash::iterator_traits<InputIt>::value_type;
-  std::vector<value_type> in_range;
+  // Elements are written to uninitialized memory of the scratch arena:
+  static_assert(std::is_trivially_copyable<value_type>::value,
+                "dash::transform requires trivially copyable elements");
+  // Temporary input range is released after the blocking transform,
+  // allocate from the unit's scratch arena:
+  auto & arena = dash::util::ScratchArena::local();
+  dash::util::ScratchArena::Scope arena_scope(arena);
   if (in_b_first == out_first) {
     // Output range is rhs input range: C += A
     // Input is (in_a_first, in_a_last).
   } else {
     // Output range different from rhs input range: C = A+B
     // Input is (in_a_first, in_a_last) + (in_b_first, in_b_last):
+    auto         num_elem = std::distance(in_a_first, in_a_last);
+    value_type * in_range = arena.allocate<value_type>(num_elem);
     std::transform(
       in_a_first, in_a_last,
       in_b_first,
-      std::back_inserter(in_range),
+      in_range,
       binary_op);
-    in_first = in_range.data();
-    in_last  = in_first + in_range.size();
+    in_first = in_range;
+    in_last  = in_first + num_elem;
   }
 
   dash::util::Trace trace("transform");
@@ -404,14 +433,12 @@ GlobOutputIt transform(
   // Resolve local range from global range:
   // Number of elements in local range:
   size_t num_local_elements     = std::distance(in_first, in_last);
-  // Global iterator to dart_gptr_t:
-  dart_gptr_t dest_gptr         = out_first.dart_gptr();
-  // Send accumulate message:
+  // Send accumulate message per segment of the output range:
   trace.enter_state("transform_blocking");
-  dash::internal::transform_blocking_impl(
-      dest_gptr,
+  dash::internal::transform_segments_blocking(
       in_first,
       num_local_elements,
+      out_first,
       binary_op.dart_operation());
   trace.exit_state("transform_blocking");
   // The position past the last element transformed in global element space
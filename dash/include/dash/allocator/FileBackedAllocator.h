@@ -0,0 +1,97 @@
+#ifndef DASH__ALLOCATOR__FILE_BACKED_ALLOCATOR_H__INCLUDED
+#define DASH__ALLOCATOR__FILE_BACKED_ALLOCATOR_H__INCLUDED
+
+#include <dash/allocator/SymmetricAllocator.h>
+
+#include <dash/Team.h>
+#include <dash/util/Config.h>
+
+#include <string>
+
+
+namespace dash {
+namespace allocator {
+
+/**
+ * Symmetric allocator of global memory regions backed by memory-mapped
+ * files, e.g. on a local NVMe device, a tmpfs or a DAX-mounted persistent
+ * memory file system.
+ *
+ * Residency of allocated memory is managed by the operating system's page
+ * cache so global memory may exceed the size of physical memory.
+ * Backing files are created in the directory specified at construction,
+ * in the directory set in configuration key \c DASH_MEMORY_FILE_PATH or in
+ * \c /tmp, and removed when the allocation is freed.
+ *
+ * Containers using \c dash::allocator::SymmetricAllocator such as
+ * \c dash::Array and \c dash::Matrix allocate from memory-mapped files if
+ * the configuration key \c DASH_MEMORY_FILE_PATH is set.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::GlobStaticMem<
+ *     double, dash::allocator::FileBackedAllocator<double> >
+ *     globmem(nlocal);
+ * \endcode
+ *
+ * \concept{DashAllocatorConcept}
+ */
+template<typename ElementType>
+class FileBackedAllocator
+: public SymmetricAllocator<ElementType>
+{
+private:
+  typedef FileBackedAllocator<ElementType> self_t;
+  typedef SymmetricAllocator<ElementType>  base_t;
+
+public:
+  template<class U>
+  struct rebind {
+    typedef FileBackedAllocator<U> other;
+  };
+
+public:
+  /**
+   * Constructor.
+   * Creates a new instance of \c dash::FileBackedAllocator for a given team
+   * using the directory in configuration key \c DASH_MEMORY_FILE_PATH, or
+   * \c /tmp if it is not set.
+   */
+  explicit FileBackedAllocator(
+    Team & team = dash::Team::All()) noexcept
+  : base_t(default_path(), team)
+  { }
+
+  /**
+   * Constructor.
+   * Creates a new instance of \c dash::FileBackedAllocator for a given team
+   * that creates backing files in the specified directory.
+   */
+  explicit FileBackedAllocator(
+    const std::string & path,
+    Team              & team = dash::Team::All()) noexcept
+  : base_t(path, team)
+  { }
+
+  FileBackedAllocator(self_t && other)                  = default;
+  FileBackedAllocator(const self_t & other)             = default;
+  self_t & operator=(self_t && other)                   = default;
+  self_t & operator=(const self_t & other)              = delete;
+
+private:
+  static std::string default_path()
+  {
+    std::string path;
+    if (dash::util::Config::is_set("DASH_MEMORY_FILE_PATH")) {
+      path = dash::util::Config::get<std::string>("DASH_MEMORY_FILE_PATH");
+    }
+    return path.empty() ? "/tmp" : path;
+  }
+
+}; // class FileBackedAllocator
+
+} // namespace allocator
+} // namespace dash
+
+#endif // DASH__ALLOCATOR__FILE_BACKED_ALLOCATOR_H__INCLUDED
@@ -7,10 +7,13 @@
 #include <dash/Team.h>
 #include <dash/GlobPtr.h>
 
+#include <dash/util/Config.h>
+
 #include <dash/internal/Logging.h>
 #include <dash/internal/StreamConversion.h>
 
 #include <vector>
+#include <string>
 #include <algorithm>
 #include <utility>
 #include <cassert>
@@ -19,6 +22,33 @@
 namespace dash {
 namespace allocator {
 
+namespace internal {
+
+/**
+ * Directory in which allocations of \c nbytes local bytes are backed by
+ * memory-mapped files, or an empty string if the allocation should be
+ * backed by anonymous memory.
+ *
+ * File-backed allocation is enabled by setting the configuration key
+ * \c DASH_MEMORY_FILE_PATH to a non-empty value. Only allocations with
+ * at least \c DASH_MEMORY_FILE_THRESHOLD_SIZE local bytes are file-backed
+ * if this key is set.
+ */
+inline std::string file_backed_memory_path(size_t nbytes)
+{
+  using dash::util::Config;
+  if (!Config::is_set("DASH_MEMORY_FILE_PATH")) {
+    return std::string();
+  }
+  if (Config::is_set("DASH_MEMORY_FILE_THRESHOLD_SIZE_BYTES") &&
+      nbytes < Config::get<size_t>("DASH_MEMORY_FILE_THRESHOLD_SIZE_BYTES")) {
+    return std::string();
+  }
+  return Config::get<std::string>("DASH_MEMORY_FILE_PATH");
+}
+
+} // namespace internal
+
 /**
  * Encapsulates a memory allocation and deallocation strategy of global
  * memory regions distributed across local memory of units in a specified
@@ -26,6 +56,10 @@ namespace allocator {
  * 
  * \note This allocator allocates a symmetric amount of memory on each node.
  *
+ * Allocations are backed by memory-mapped files instead of anonymous
+ * memory if configuration key \c DASH_MEMORY_FILE_PATH is set, see
+ * \c dash::allocator::FileBackedAllocator.
+ *
  * Satisfied STL concepts:
  *
  * - Allocator
@@ -66,6 +100,8 @@ public:
 private:
   dart_team_t          _team_id;
   std::vector<pointer> _allocated;
+  /// Directory of files backing allocations, uses configuration if empty.
+  std::string          _file_path;
 
 public:
   /**
@@ -77,13 +113,28 @@ public:
   : _team_id(team.dart_id())
   { }
 
+protected:
+  /**
+   * Constructor.
+   * Creates a new instance of \c dash::SymmetricAllocator for a given team
+   * that backs allocations by files in the given directory.
+   */
+  SymmetricAllocator(
+    const std::string & file_path,
+    Team              & team) noexcept
+  : _team_id(team.dart_id()),
+    _file_path(file_path)
+  { }
+
+public:
   /**
    * Move-constructor.
    * Takes ownership of the moved instance's allocation.
    */
   SymmetricAllocator(self_t && other) noexcept
   : _team_id(other._team_id),
-    _allocated(std::move(other._allocated))
+    _allocated(std::move(other._allocated)),
+    _file_path(std::move(other._file_path))
   {
     // clear origin without deallocating gptrs
     other._allocated.clear();
@@ -95,7 +146,8 @@ public:
    * \see DashAllocatorConcept
    */
   SymmetricAllocator(const self_t & other) noexcept
-  : _team_id(other._team_id)
+  : _team_id(other._team_id),
+    _file_path(other._file_path)
   { }
 
   /**
@@ -104,7 +156,8 @@ public:
    */
   template<class U>
   SymmetricAllocator(const SymmetricAllocator<U> & other) noexcept
-  : _team_id(other._team_id)
+  : _team_id(other._team_id),
+    _file_path(other._file_path)
   { }
 
   /**
@@ -132,7 +185,8 @@ public:
     if (this != &other) {
       clear();
       _allocated = std::move(other._allocated);
-      _team_id = other._team_id;
+      _team_id   = other._team_id;
+      _file_path = std::move(other._file_path);
       // clear origin without deallocating gptrs
       other._allocated.clear();
     }
@@ -190,8 +244,21 @@ public:
                    "number of local values:", num_local_elem);
     pointer gptr = DART_GPTR_NULL;
     dash::dart_storage<ElementType> ds(num_local_elem);
-    if (dart_team_memalloc_aligned(_team_id, ds.nelem, ds.dtype, &gptr)
-        == DART_OK) {
+    std::string file_path = _file_path.empty()
+                            ? internal::file_backed_memory_path(
+                                num_local_elem * sizeof(ElementType))
+                            : _file_path;
+    dart_ret_t  ret;
+    if (file_path.empty()) {
+      ret = dart_team_memalloc_aligned(
+              _team_id, ds.nelem, ds.dtype, &gptr);
+    } else {
+      DASH_LOG_DEBUG("SymmetricAllocator.allocate(nlocal)",
+                     "file-backed in", file_path);
+      ret = dart_team_memalloc_aligned_file(
+              _team_id, ds.nelem, ds.dtype, file_path.c_str(), &gptr);
+    }
+    if (ret == DART_OK) {
       _allocated.push_back(gptr);
     } else {
       gptr = DART_GPTR_NULL;
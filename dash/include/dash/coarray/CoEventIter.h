@@ -4,18 +4,18 @@
 #include <iterator>
 
 #include <dash/Team.h>
-#include <dash/Atomic.h>
 #include <dash/coarray/CoEventRef.h>
 
+#include <dash/dart/if/dart_synchronization.h>
+
 namespace dash {
 namespace coarray {
 
 class CoEventIter {
 private:
   using self_t = CoEventIter;
-  using gptr_t = GlobPtr<dash::Atomic<int>>;
 public:
-  using difference_type   = typename gptr_t::gptrdiff_t;
+  using difference_type   = int;
   using value_type        = CoEventRef;
   using pointer           = CoEventRef *;
   using reference         = CoEventRef &;
@@ -24,38 +24,41 @@ public:
 public:
 
   explicit CoEventIter(
-    const gptr_t & pos,
+    dart_event_t event,
+    int pos,
     Team & team = dash::Team::Null())
   : _team(team),
-    _gptr(pos) {}
+    _event(event),
+    _pos(pos) {}
 
   inline Team & team() {
     return _team;
   }
   inline value_type operator[] (int pos) const {
-    return value_type(_gptr + pos, _team);
+    return value_type(_event, _pos + pos, _team);
   }
 
   inline value_type operator* () const {
-    return value_type(_gptr, _team);
+    return value_type(_event, _pos, _team);
   }
   /*
    * Comparison operators
    */
   inline bool operator <(const self_t & other) const noexcept {
-    return _gptr < other._gptr;
+    return _pos < other._pos;
   }
   inline bool operator >(const self_t & other) const noexcept {
-    return _gptr > other._gptr;
+    return _pos > other._pos;
   }
   inline bool operator <=(const self_t & other) const noexcept {
-    return _gptr <= other._gptr;
+    return _pos <= other._pos;
   }
   inline bool operator >=(const self_t & other) const noexcept {
-    return _gptr >= other._gptr;
+    return _pos >= other._pos;
   }
   inline bool operator ==(const self_t & other) const noexcept {
-    return (_gptr == other._gptr) && (_team == other._team);
+    return (_event == other._event) && (_pos == other._pos) &&
+           (_team == other._team);
   }
   inline bool operator !=(const self_t & other) const noexcept {
     return !(*this == other);
@@ -64,39 +67,42 @@ public:
    * Arith. operators
    */
   inline self_t & operator +=(int i) noexcept {
-    _gptr += i;
+    _pos += i;
     return *this;
   }
   inline self_t & operator -=(int i) noexcept {
-    _gptr -= i;
+    _pos -= i;
     return *this;
   }
   inline self_t & operator ++() noexcept {
-    ++_gptr;
+    ++_pos;
     return *this;
   }
   inline self_t operator ++(int) noexcept {
-    auto oldptr = _gptr++;
-    return self_t(oldptr);
+    auto old = *this;
+    ++_pos;
+    return old;
   }
   inline self_t & operator --() noexcept{
-    --_gptr;
+    --_pos;
     return *this;
   }
   inline self_t operator --(int) noexcept {
-    auto oldptr = _gptr--;
-    return self_t(oldptr);
+    auto old = *this;
+    --_pos;
+    return old;
   }
   inline self_t operator +(int i) const noexcept {
-    return self_t(_gptr + i);
+    return self_t(_event, _pos + i, _team);
   }
   inline self_t operator -(int i) const noexcept {
-    return self_t(_gptr - i);
+    return self_t(_event, _pos - i, _team);
   }
 
 private:
-  Team   & _team = dash::Team::Null();
-  gptr_t   _gptr;
+  Team         & _team = dash::Team::Null();
+  dart_event_t   _event;
+  int            _pos;
 };
 
 } // namespace coarray
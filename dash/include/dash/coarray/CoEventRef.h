@@ -2,8 +2,9 @@
 #define DASH__COARRAY__COEVENTREF_H
 
 #include <dash/Team.h>
-#include <dash/GlobPtr.h>
-#include <dash/Atomic.h>
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart_synchronization.h>
 
 namespace dash {
 namespace coarray {
@@ -11,23 +12,26 @@ namespace coarray {
 class CoEventRef {
 private:
   using self_t      = CoEventRef;
-  using event_ctr_t = dash::Atomic<int>;
-  using gptr_t      = GlobPtr<event_ctr_t>;
 
 public:
   explicit CoEventRef(
-    const gptr_t & gptr,
+    dart_event_t event,
+    int unit,
     Team & team = dash::Team::Null())
   : _team(team),
-    _gptr(gptr) {}
+    _event(event),
+    _unit(unit) {}
 
   /**
-   * post an event to this unit. This function is thread-safe
+   * post a given number of events to this unit. Posting multiple events
+   * requires a single atomic update and notification of the unit.
+   * This function is thread-safe
    */
-  inline void post() const {
-    DASH_LOG_DEBUG("post event to gptr", _gptr);
-    GlobRef<event_ctr_t> gref(_gptr);
-    gref.add(1);
+  inline void post(int count = 1) const {
+    DASH_LOG_DEBUG("post events to unit", _unit, "count:", count);
+    DASH_ASSERT_RETURNS(
+      dart_event_post(_event, dart_team_unit_t{_unit}, count),
+      DART_OK);
     DASH_LOG_DEBUG("event posted");
   }
 
@@ -35,24 +39,29 @@ public:
    * returns the number of arrived events at this unit
    */
   inline int test() const {
-    DASH_LOG_DEBUG("test for events on", _gptr);
-    GlobRef<event_ctr_t> gref(_gptr);
-    return gref.load();
+    DASH_LOG_DEBUG("test for events on unit", _unit);
+    int32_t count;
+    DASH_ASSERT_RETURNS(
+      dart_event_test(_event, dart_team_unit_t{_unit}, &count),
+      DART_OK);
+    return count;
   }
 
   inline Team & team() {
     return _team;
   }
   inline bool operator ==(const self_t & other) const noexcept {
-    return (_gptr == other._gptr) && (_team == other._team);
+    return (_event == other._event) && (_unit == other._unit) &&
+           (_team == other._team);
   }
   inline bool operator !=(const self_t & other) const noexcept {
     return !(*this == other);
   }
 
 private:
-  Team   & _team = dash::Team::All();
-  gptr_t   _gptr;
+  Team         & _team = dash::Team::All();
+  dart_event_t   _event;
+  int            _unit;
 };
 
 } // namespace coarray
@@ -60,4 +69,3 @@ private:
 
 
 #endif /* DASH__COARRAY__COEVENTREF_H */
-
@@ -2,8 +2,16 @@
 #define DASH__COARRAY_UTILS_H__
 
 #include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/algorithm/Operation.h>
 
-#define DART_TAG_SYNC_IMAGES 10016;
+#include <dash/dart/if/dart_synchronization.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#define DART_TAG_CO_REDUCE   10017
 
 /**
  * \defgroup  DashCoarrayLib  Coarray Runtime Interface
@@ -62,10 +70,19 @@ inline void sync_all(){
  * not imply a flush. If a flush is required, use the \c sync_all() method of
  * the Coarray
  *
- * \note If possible use \c sync_all() or \c Coevent for performance reasons.
- *       \c sync_images() is implemented using two-sided operations based on
- *       a implementation of \c MPI_Barrier(). For dispatching the messages
- *       we use tag DART_TAG_SYNC_IMAGES
+ * Every image synchronizes pairwise with the selected images using
+ * one-sided notifications, so synchronizing with \c n images costs \c n
+ * atomic updates and waiting on local counters independent of the number
+ * of images. Images that are not selected are not involved.
+ * Images not contained in \c image_ids return immediately. The sets of
+ * different images do not have to be equal, every pair of images that
+ * contain each other is synchronized, e.g. in a halo exchange:
+ *
+ * \code
+ *   auto me = this_image();
+ *   std::array<int, 3> images {{ left_of(me), me, right_of(me) }};
+ *   sync_images(images);
+ * \endcode
  *
  * \sa dash::coarray::sync_all()
  *
@@ -85,78 +102,276 @@ inline void sync_images(const Container & image_ids){
     return;
   }
 
-  auto root          = global_unit_t{
-                        *(std::min(image_ids.begin(), image_ids.end()))};
-  auto tag           =  DART_TAG_SYNC_IMAGES;
-  // DART does not specify if nullptr is allowed as target
-  char buffer        = 0;
-
-  if(myid == root){
-    // I am root, recv messages from leaves
-    std::for_each(image_ids.begin(), image_ids.end(), [&](const element & el){
-      if(el != root){
-        dart_recv(&buffer, 1, dart_datatype<char>::value,
-                  tag,
-                  global_unit_t{el}
-        );
-      }
-    });
-  } else {
-    // I am a leave, send message to root
-    dart_send(&buffer, 1, DART_TYPE_BYTE,
-              tag,
-              global_unit_t{root});
+  std::vector<dart_global_unit_t> units;
+  units.reserve(image_ids.size());
+  for(const element & el : image_ids){
+    units.push_back(global_unit_t{static_cast<dart_unit_t>(el)});
   }
+  // every pair of images is synchronized once
+  std::sort(units.begin(), units.end(),
+            [](const dart_global_unit_t & a, const dart_global_unit_t & b) {
+              return a.id < b.id;
+            });
+  units.erase(
+    std::unique(units.begin(), units.end(),
+                [](const dart_global_unit_t & a, const dart_global_unit_t & b) {
+                  return a.id == b.id;
+                }),
+    units.end());
+  DASH_LOG_DEBUG("sync_images()", "images:", units.size());
+  DASH_ASSERT_RETURNS(
+    dart_sync_units(units.data(), units.size()),
+    DART_OK);
+}
+
+namespace detail {
+
+/**
+ * Whether \c BinaryOp is a reduce operation with an equivalent DART
+ * operation on values of type \c ValueType.
+ */
+template<typename ValueType, typename BinaryOp, typename = void>
+struct is_dart_reduce_op : std::false_type { };
 
-  // Second phase: recieve message from root
-  DASH_LOG_DEBUG("Begin second phase of sync_images");
-  if(myid == root){
-    std::for_each(image_ids.begin(), image_ids.end(), [&](const element & el)
-    {
-      if(el != root){
-        dart_send(&buffer, 1, dart_datatype<char>::value,
-                  tag,
-                  global_unit_t{el}
-        );
+template<typename ValueType, typename BinaryOp>
+struct is_dart_reduce_op<
+  ValueType, BinaryOp,
+  decltype((void)std::declval<const BinaryOp &>().dart_operation())>
+: std::integral_constant<
+    bool,
+    dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED> { };
+
+/**
+ * Reduces the local values of all units in \c team element-wise in a
+ * binomial tree of point-to-point messages. The result is stored in
+ * \c values at unit \c root.
+ */
+template<typename ValueType, typename BinaryOp>
+void co_reduce_tree(
+  ValueType        * values,
+  size_t             nvalues,
+  const BinaryOp   & op,
+  team_unit_t        root,
+  dash::Team       & team)
+{
+  const auto nunits = static_cast<int>(team.size());
+  const auto rel_id = (team.myid().id - root.id + nunits) % nunits;
+  const auto nbytes = nvalues * sizeof(ValueType);
+  const auto tag    = DART_TAG_CO_REDUCE;
+  std::vector<ValueType> recv_values(nvalues);
+
+  for (int mask = 1; mask < nunits; mask <<= 1) {
+    if (rel_id & mask) {
+      // send partial result to parent and leave:
+      auto parent = team_unit_t{(rel_id - mask + root.id) % nunits};
+      DASH_ASSERT_RETURNS(
+        dart_send(values, nbytes, DART_TYPE_BYTE, tag,
+                  team.global_id(parent)),
+        DART_OK);
+      break;
+    }
+    if (rel_id + mask < nunits) {
+      // combine partial result of child:
+      auto child = team_unit_t{(rel_id + mask + root.id) % nunits};
+      DASH_ASSERT_RETURNS(
+        dart_recv(recv_values.data(), nbytes, DART_TYPE_BYTE, tag,
+                  team.global_id(child)),
+        DART_OK);
+      for (size_t i = 0; i < nvalues; ++i) {
+        values[i] = op(values[i], recv_values[i]);
       }
-    });
+    }
+  }
+}
+
+template<typename ValueType, typename BinaryOp>
+inline void co_reduce_local(
+  ValueType        * values,
+  size_t             nvalues,
+  const BinaryOp   & op,
+  team_unit_t        result_image,
+  dash::Team       & team,
+  std::true_type     /* is DART operation */)
+{
+  if (result_image < 0) {
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(values, values, nvalues,
+                     dash::dart_datatype<ValueType>::value,
+                     op.dart_operation(),
+                     team.dart_id()),
+      DART_OK);
   } else {
-    dart_recv(&buffer, 1, dart_datatype<char>::value,
-              tag,
-              global_unit_t{root}
-    );
+    DASH_ASSERT_RETURNS(
+      dart_reduce(values, values, nvalues,
+                  dash::dart_datatype<ValueType>::value,
+                  op.dart_operation(),
+                  result_image,
+                  team.dart_id()),
+      DART_OK);
+  }
+}
+
+template<typename ValueType, typename BinaryOp>
+inline void co_reduce_local(
+  ValueType        * values,
+  size_t             nvalues,
+  const BinaryOp   & op,
+  team_unit_t        result_image,
+  dash::Team       & team,
+  std::false_type    /* is DART operation */)
+{
+  const bool broadcast_result = (result_image < 0);
+  const auto root = broadcast_result ? team_unit_t{0} : result_image;
+  co_reduce_tree(values, nvalues, op, root, team);
+  if (broadcast_result) {
+    const dash::dart_storage<ValueType> ds(nvalues);
+    DASH_ASSERT_RETURNS(
+      dart_bcast(values, ds.nelem, ds.dtype, root, team.dart_id()),
+      DART_OK);
   }
 }
 
+} // namespace detail
+
 /**
- * Broadcasts the value on master to all other members of this co_array
+ * Broadcasts the local values of \c source_image to all other images
+ * in place.
+ *
  * \note fortran defines this function only for scalar Coarray.
  *       This implementation allows you to broadcast arrays as well
  *
- * \param coarr  coarray which should be broadcasted
- * \param master the value of this unit will be broadcastet
+ * \param coarr         coarray which should be broadcasted
+ * \param source_image  the value of this unit will be broadcastet
  *
  * \ingroup DashCoarrayLib
  */
-template<typename T>
-void cobroadcast(Coarray<T> & coarr, const team_unit_t & master){
-  using value_type        = typename Coarray<T>::value_type;
+template<typename T, typename IndexType, MemArrange Arrangement>
+void co_broadcast(
+  Coarray<T, IndexType, Arrangement> & coarr,
+  const team_unit_t                  & source_image)
+{
+  using value_type = typename Coarray<T, IndexType, Arrangement>::value_type;
   const dash::dart_storage<value_type> ds(coarr.local_size());
   DASH_ASSERT_RETURNS(
     dart_bcast(coarr.lbegin(),
                ds.nelem,
                ds.dtype,
-               master,
+               source_image,
                coarr.team().dart_id()),
     DART_OK);
 }
 
+/**
+ * Reduces the local values of all images element-wise in place.
+ *
+ * Reduce operations with an equivalent DART operation such as
+ * \c dash::plus are mapped to a single DART collective, any other
+ * binary operation is applied in a binomial tree and must be associative
+ * and commutative.
+ *
+ * \param coarr         perform the reduction on this array
+ * \param op            binary operation, e.g. one of the
+ *                      \ref DashReduceOperations
+ * \param result_image  unit which receives the result. -1 to store the
+ *                      result at all units
+ *
+ * \code
+ *   dash::Coarray<double[3]> x;
+ *   dash::coarray::co_reduce(x, [](double a, double b) {
+ *                                 return std::hypot(a, b); });
+ * \endcode
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<
+  typename T, typename IndexType, MemArrange Arrangement, typename BinaryOp>
+void co_reduce(
+  Coarray<T, IndexType, Arrangement> & coarr,
+  const BinaryOp                     & op,
+  team_unit_t                          result_image = team_unit_t{-1})
+{
+  using value_type = typename Coarray<T, IndexType, Arrangement>::value_type;
+  detail::co_reduce_local(
+    coarr.lbegin(), coarr.local_size(), op, result_image, coarr.team(),
+    detail::is_dart_reduce_op<value_type, BinaryOp>());
+}
+
+/**
+ * Sums the local values of all images element-wise in place.
+ *
+ * \param coarr         perform the reduction on this array
+ * \param result_image  unit which receives the result. -1 to store the
+ *                      result at all units
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<typename T, typename IndexType, MemArrange Arrangement>
+void co_sum(
+  Coarray<T, IndexType, Arrangement> & coarr,
+  team_unit_t                          result_image = team_unit_t{-1})
+{
+  using value_type = typename Coarray<T, IndexType, Arrangement>::value_type;
+  co_reduce(coarr, dash::plus<value_type>(), result_image);
+}
+
+/**
+ * Computes the element-wise minimum of the local values of all images
+ * in place.
+ *
+ * \param coarr         perform the reduction on this array
+ * \param result_image  unit which receives the result. -1 to store the
+ *                      result at all units
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<typename T, typename IndexType, MemArrange Arrangement>
+void co_min(
+  Coarray<T, IndexType, Arrangement> & coarr,
+  team_unit_t                          result_image = team_unit_t{-1})
+{
+  using value_type = typename Coarray<T, IndexType, Arrangement>::value_type;
+  co_reduce(coarr, dash::min<value_type>(), result_image);
+}
+
+/**
+ * Computes the element-wise maximum of the local values of all images
+ * in place.
+ *
+ * \param coarr         perform the reduction on this array
+ * \param result_image  unit which receives the result. -1 to store the
+ *                      result at all units
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<typename T, typename IndexType, MemArrange Arrangement>
+void co_max(
+  Coarray<T, IndexType, Arrangement> & coarr,
+  team_unit_t                          result_image = team_unit_t{-1})
+{
+  using value_type = typename Coarray<T, IndexType, Arrangement>::value_type;
+  co_reduce(coarr, dash::max<value_type>(), result_image);
+}
+
+/**
+ * Broadcasts the value on master to all other members of this co_array
+ *
+ * \see dash::coarray::co_broadcast
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<typename T>
+void cobroadcast(Coarray<T> & coarr, const team_unit_t & master){
+  co_broadcast(coarr, master);
+}
+
 /**
  * Performes a broadside reduction of the Coarray images.
  * \param coarr   perform the reduction on this array
  * \param op      one of the \ref DashReduceOperations
  * \param master  unit which recieves the result. -1 to broadcast to all units
  *
+ * \see dash::coarray::co_reduce
+ *
  * \ingroup DashCoarrayLib
  */
 template<typename T, typename BinaryOp>
@@ -164,49 +379,7 @@ void coreduce(Coarray<T> & coarr,
               const BinaryOp &op,
               team_unit_t master = team_unit_t{-1})
 {
-  using value_type = typename Coarray<T>::value_type;
-  using index_type = typename Coarray<T>::index_type;
-
-  static_assert(dash::dart_datatype<value_type>::value != DART_TYPE_UNDEFINED,
-      "Cannot reduce unknown type!");
-
-  constexpr auto ndim     = Coarray<T>::ndim();
-  const auto team_dart_id = coarr.team().dart_id();
-  bool broadcast_result   = (master < 0);
-  if(master < 0){master = team_unit_t{0};}
-
-  // position of first element on master
-  const auto & global_coords = coarr.pattern().global(master,
-                                 std::array<index_type,ndim> {});
-  const auto & global_idx    = coarr.pattern().at(global_coords);
-
-  const auto dart_gptr       = (coarr.begin() + global_idx).dart_gptr();
-  const dash::dart_storage<value_type> ds(coarr.local_size());
-
-  // as source and destination location is equal, master must not contribute
-  // in accumulation as otherwise it's value is counted twice
-  if(coarr.team().myid() != master){
-    DASH_ASSERT_RETURNS(
-      dart_accumulate(
-        dart_gptr,
-        coarr.lbegin(),
-        ds.nelem,
-        ds.dtype,
-        op.dart_operation()
-      ),
-      DART_OK);
-  }
-  if(broadcast_result){
-    dart_flush(dart_gptr);
-    dart_barrier(team_dart_id);
-    DASH_ASSERT_RETURNS(
-      dart_bcast(coarr.lbegin(),
-               ds.nelem,
-               ds.dtype,
-               master,
-               team_dart_id),
-      DART_OK);
-  }
+  co_reduce(coarr, op, master);
 }
 
 } // namespace co_array
@@ -11,6 +11,8 @@
 #include <functional>
 #include <cmath>
 #include <numeric>
+#include <cstdint>
+#include <type_traits>
 
 namespace dash {
 namespace math {
@@ -32,6 +34,203 @@ inline T1 div_ceil(
   return (a / b) + static_cast<T1>(a % b > 0);
 }
 
+/**
+ * Division by a divisor that is fixed at runtime, replacing the division
+ * instruction by a multiplication with a precomputed reciprocal and shifts
+ * (Granlund and Montgomery, "Division by Invariant Integers using
+ * Multiplication", in the variant of libdivide).
+ * Divisions by powers of two are reduced to a single shift.
+ *
+ * Intended for index calculations in patterns that divide by the same
+ * block and team extents in every mapping of a global index.
+ *
+ * \code
+ *   dash::math::FastDivisor<size_t> div_blocksize(blocksize);
+ *   size_t block, phase;
+ *   div_blocksize.divmod(g_index, block, phase);
+ * \endcode
+ *
+ * \tparam  Integer  Type of the divisor and dividends, non-negative values
+ *                   of signed types are supported.
+ */
+template<typename Integer>
+class FastDivisor
+{
+private:
+  typedef typename std::make_unsigned<Integer>::type         uint_t;
+
+  static constexpr int NumBits = static_cast<int>(sizeof(uint_t) * 8);
+
+  static_assert(std::is_integral<Integer>::value,
+                "FastDivisor requires an integral type");
+  static_assert(sizeof(uint_t) <= 8,
+                "FastDivisor supports integers of up to 64 bits");
+
+public:
+  /**
+   * Creates a divisor of value 1.
+   */
+  constexpr FastDivisor() = default;
+
+  /**
+   * Precomputes the reciprocal of the given divisor.
+   * A divisor of 0 is accepted but must not be used for divisions.
+   */
+  explicit FastDivisor(Integer divisor)
+  : _divisor(static_cast<uint_t>(divisor))
+  {
+    if (_divisor == 0) {
+      return;
+    }
+    _shift = floor_log2(_divisor);
+    _pow2  = (_divisor & (_divisor - 1)) == 0;
+    if (_pow2) {
+      return;
+    }
+    // 2^(N + shift) / divisor, rounded up:
+    uint_t rem;
+    uint_t proposed = div_wide(uint_t(1) << _shift, _divisor, rem);
+    const uint_t e  = _divisor - rem;
+    if (e < (uint_t(1) << _shift)) {
+      // The rounding error is small enough for a magic number of N bits:
+      _add = false;
+    } else {
+      // Magic number requires N + 1 bits, the most significant bit is
+      // added in the division:
+      proposed += proposed;
+      const uint_t twice_rem = rem + rem;
+      if (twice_rem >= _divisor || twice_rem < rem) {
+        proposed += 1;
+      }
+      _add = true;
+    }
+    _magic = proposed + 1;
+  }
+
+  /**
+   * The divisor.
+   */
+  constexpr Integer divisor() const noexcept
+  {
+    return static_cast<Integer>(_divisor);
+  }
+
+  /**
+   * Quotient of the given dividend and the divisor.
+   */
+  inline Integer divide(Integer dividend) const noexcept
+  {
+    const uint_t n = static_cast<uint_t>(dividend);
+    if (_pow2) {
+      return static_cast<Integer>(n >> _shift);
+    }
+    const uint_t q = mulhi(_magic, n);
+    if (_add) {
+      return static_cast<Integer>((((n - q) >> 1) + q) >> _shift);
+    }
+    return static_cast<Integer>(q >> _shift);
+  }
+
+  /**
+   * Remainder of the division of the given dividend by the divisor.
+   */
+  inline Integer modulo(Integer dividend) const noexcept
+  {
+    if (_pow2) {
+      return static_cast<Integer>(
+               static_cast<uint_t>(dividend) & (_divisor - 1));
+    }
+    return dividend - divide(dividend) * static_cast<Integer>(_divisor);
+  }
+
+  /**
+   * Quotient and remainder of the division of the given dividend by the
+   * divisor.
+   */
+  template<typename ResultT>
+  inline void divmod(
+    Integer   dividend,
+    ResultT & quotient,
+    ResultT & remainder) const noexcept
+  {
+    const Integer q = divide(dividend);
+    quotient  = static_cast<ResultT>(q);
+    remainder = static_cast<ResultT>(
+                  dividend - q * static_cast<Integer>(_divisor));
+  }
+
+private:
+  static int floor_log2(uint_t x) noexcept
+  {
+    int l = -1;
+    while (x != 0) {
+      x >>= 1;
+      ++l;
+    }
+    return l;
+  }
+
+  /**
+   * High word of the double-width product of \c a and \c b.
+   */
+  template<typename T = uint_t>
+  static typename std::enable_if<(sizeof(T) < 8), uint_t>::type
+  mulhi(T a, T b) noexcept
+  {
+    return static_cast<uint_t>(
+             (static_cast<uint64_t>(a) * static_cast<uint64_t>(b))
+             >> NumBits);
+  }
+
+  template<typename T = uint_t>
+  static typename std::enable_if<(sizeof(T) == 8), uint_t>::type
+  mulhi(T a, T b) noexcept
+  {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<uint_t>(
+             (static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+    const uint64_t a_lo = a & 0xffffffffULL, a_hi = a >> 32;
+    const uint64_t b_lo = b & 0xffffffffULL, b_hi = b >> 32;
+    const uint64_t lo_lo = a_lo * b_lo;
+    const uint64_t hi_lo = a_hi * b_lo;
+    const uint64_t lo_hi = a_lo * b_hi;
+    const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffULL) + lo_hi;
+    return static_cast<uint_t>(
+             a_hi * b_hi + (hi_lo >> 32) + (cross >> 32));
+#endif
+  }
+
+  /**
+   * Quotient of the double-width value <tt>hi * 2^N</tt> and \c d for
+   * <tt>hi < d</tt>, computed by restoring binary long division.
+   * Only used once per divisor.
+   */
+  static uint_t div_wide(uint_t hi, uint_t d, uint_t & rem) noexcept
+  {
+    uint_t q = 0;
+    uint_t r = hi;
+    for (int bit = 0; bit < NumBits; ++bit) {
+      const bool carry = (r >> (NumBits - 1)) != 0;
+      r <<= 1;
+      q <<= 1;
+      if (carry || r >= d) {
+        r -= d;
+        q |= 1;
+      }
+    }
+    rem = r;
+    return q;
+  }
+
+private:
+  uint_t _divisor = 1;
+  uint_t _magic   = 0;
+  int    _shift   = 0;
+  bool   _pow2    = true;
+  bool   _add     = false;
+};
+
 template<typename Iter>
 inline void div_mean(Iter begin, Iter end)
 {
@@ -5,6 +5,8 @@
 #include <dash/GlobRef.h>
 #include <dash/GlobPtr.h>
 
+#include <dash/iterator/GlobSegment.h>
+
 #include <functional>
 #include <sstream>
 
@@ -478,6 +480,28 @@ public:
     return local_pos;
   }
 
+  /**
+   * Number of elements from the iterator's position that are stored
+   * contiguously in the local memory of the unit owning the referenced
+   * element, at most \c max_size.
+   *
+   * \see  dash::for_each_segment
+   */
+  index_type segment_size(index_type max_size) const
+  {
+    if (max_size <= 0) {
+      return 0;
+    }
+    if (_idx > _max_idx) {
+      // Position is not resolved in the pattern's index space, treat it as
+      // a single element:
+      return 1;
+    }
+    auto size = dash::internal::pattern_segment_size(
+                  *_pattern, _pattern->coords(_idx));
+    return std::max<index_type>(1, std::min<index_type>(size, max_size));
+  }
+
   /**
    * Map iterator to global index domain.
    */
@@ -0,0 +1,211 @@
+#ifndef DASH__ITERATOR__GLOB_SEGMENT_H__INCLUDED
+#define DASH__ITERATOR__GLOB_SEGMENT_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart_globmem.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <array>
+
+
+namespace dash {
+
+/**
+ * Contiguous segment of elements in a global range.
+ *
+ * The elements of a segment are stored at a single unit in consecutive
+ * local memory and are consecutive in the iterated range.
+ *
+ * \see  dash::for_each_segment
+ */
+template<
+  typename IndexType,
+  typename LocalPointer >
+struct GlobSegment {
+  /// Offset of the segment's first element in the iterated range
+  IndexType     offset;
+  /// Number of elements in the segment
+  IndexType     size;
+  /// Global index of the segment's first element
+  IndexType     gindex;
+  /// Unit owning the segment's elements
+  team_unit_t   unit;
+  /// Local offset of the segment's first element at the owning unit
+  IndexType     lindex;
+  /// Native pointer to the segment's first element if it is stored in
+  /// the calling unit's local memory, \c nullptr otherwise
+  LocalPointer  lbegin;
+  /// Global pointer to the segment's first element
+  dart_gptr_t   gptr;
+};
+
+namespace internal {
+
+/**
+ * Number of consecutive positions, starting at the given coordinates, in
+ * the linearization of a cartesian index space that are contained in a
+ * rectangular region of the space.
+ *
+ * The run extends over all following rows of the region as long as the
+ * region spans the full extents of the space in the faster dimensions.
+ */
+template<
+  MemArrange Arrangement,
+  typename   IndexType,
+  typename   OffsetType,
+  typename   ExtentType,
+  typename   SpaceExtentType,
+  size_t     NumDimensions >
+IndexType linear_run_length(
+  /// Coordinates of the first position, contained in the region
+  const std::array<IndexType, NumDimensions>       & coords,
+  /// Offsets of the region
+  const std::array<OffsetType, NumDimensions>      & offsets,
+  /// Extents of the region
+  const std::array<ExtentType, NumDimensions>      & extents,
+  /// Extents of the index space
+  const std::array<SpaceExtentType, NumDimensions> & space_extents)
+{
+  // Dimensions from fastest to slowest in the linearization:
+  auto dim = [](dim_t i) -> dim_t {
+               return (Arrangement == ROW_MAJOR)
+                      ? NumDimensions - 1 - i
+                      : i;
+             };
+  dim_t     d_fast = dim(0);
+  IndexType run    = static_cast<IndexType>(offsets[d_fast] +
+                                            extents[d_fast]) -
+                     coords[d_fast];
+  IndexType stride = 1;
+  for (dim_t i = 1; i < NumDimensions; ++i) {
+    dim_t d_prev = dim(i - 1);
+    dim_t d      = dim(i);
+    if (static_cast<IndexType>(extents[d_prev]) !=
+        static_cast<IndexType>(space_extents[d_prev])) {
+      break;
+    }
+    stride *= static_cast<IndexType>(space_extents[d_prev]);
+    run    += (static_cast<IndexType>(offsets[d] + extents[d]) -
+               coords[d] - 1) * stride;
+  }
+  return run;
+}
+
+/**
+ * Number of elements, starting at the given global coordinates, that are
+ * consecutive in the pattern's global index space and in the local memory
+ * of the unit owning the element at the coordinates.
+ *
+ * Elements are contiguous in local memory within rows of a block for
+ * patterns with linear local layout.
+ */
+template<class PatternType>
+typename PatternType::index_type pattern_segment_size(
+  const PatternType                                 & pattern,
+  const std::array<
+          typename PatternType::index_type,
+          PatternType::ndim() >                     & g_coords)
+{
+  typedef typename PatternType::index_type index_type;
+  constexpr dim_t NumDimensions = PatternType::ndim();
+
+  auto block    = pattern.block(pattern.block_at(g_coords));
+  auto extents  = pattern.extents();
+  std::array<index_type, NumDimensions> block_offsets;
+  std::array<index_type, NumDimensions> block_extents;
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    block_offsets[d] = block.offset(d);
+    // Blocks at the pattern's border may be underfilled:
+    block_extents[d] = std::min<index_type>(
+                         block.extent(d),
+                         static_cast<index_type>(extents[d]) -
+                           block_offsets[d]);
+  }
+  return linear_run_length<PatternType::memory_order()>(
+           g_coords, block_offsets, block_extents, extents);
+}
+
+} // namespace internal
+
+/**
+ * Invokes a function on the contiguous segments of elements in the
+ * global range <tt>[first, last)</tt> in iteration order.
+ *
+ * Every segment consists of consecutive elements of the range that are
+ * stored at a single unit in consecutive local memory, so a segment can be
+ * transferred in a single one-sided operation or traversed by a native
+ * pointer. Unit and local offset are resolved once per segment instead of
+ * once per element.
+ *
+ * \code
+ *   dash::for_each_segment(
+ *     array.begin() + 10, array.end(),
+ *     [&](const dash::GlobSegment<index_t, int *> & seg) {
+ *       if (seg.lbegin != nullptr) {
+ *         std::fill(seg.lbegin, seg.lbegin + seg.size, 0);
+ *       }
+ *     });
+ * \endcode
+ *
+ * \tparam  GlobIterType     Type of the global iterators, \c dash::GlobIter
+ *                           or \c dash::GlobViewIter.
+ * \tparam  SegmentFunction  Function object invoked with arguments of type
+ *                           \c dash::GlobSegment.
+ *
+ * \complexity  O(s), for \c s segments in the range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobIterType,
+  class SegmentFunction >
+void for_each_segment(
+  /// Iterator to the initial position in the global range
+  const GlobIterType & first,
+  /// Iterator past the final position in the global range
+  const GlobIterType & last,
+  /// Function to invoke on every segment
+  SegmentFunction      func)
+{
+  typedef typename GlobIterType::index_type     index_type;
+  typedef typename GlobIterType::local_pointer  local_pointer;
+  typedef GlobSegment<index_type, local_pointer> segment_t;
+
+  index_type num_elem = last - first;
+  DASH_LOG_TRACE("dash::for_each_segment()", "elements:", num_elem);
+  if (num_elem <= 0) {
+    return;
+  }
+  auto myid = first.pattern().team().myid();
+  for (index_type offset = 0; offset < num_elem; ) {
+    auto       it     = first + offset;
+    auto       lpos   = it.lpos();
+    index_type size   = it.segment_size(num_elem - offset);
+    auto       lbegin = it.globmem().lbegin();
+    DASH_ASSERT_GT(size, 0, "dash::for_each_segment: empty segment");
+    segment_t  segment {
+      offset,
+      size,
+      it.gpos(),
+      lpos.unit,
+      lpos.index,
+      (lpos.unit == myid && lbegin != nullptr)
+        ? lbegin + lpos.index
+        : nullptr,
+      it.globmem().at(lpos.unit, lpos.index).dart_gptr()
+    };
+    DASH_LOG_TRACE("dash::for_each_segment",
+                   "offset:", offset, "size:", size,
+                   "unit:", lpos.unit, "lindex:", lpos.index);
+    func(segment);
+    offset += size;
+  }
+}
+
+} // namespace dash
+
+#endif // DASH__ITERATOR__GLOB_SEGMENT_H__INCLUDED
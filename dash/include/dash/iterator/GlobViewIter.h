@@ -595,6 +595,44 @@ public:
     return (_lbegin + local_pos.index + offset);
   }
 
+  /**
+   * Number of elements from the iterator's position that are stored
+   * contiguously in the local memory of the unit owning the referenced
+   * element, at most \c max_size.
+   * Segments do not extend over rows of the iterator's view that are not
+   * consecutive in global index space.
+   *
+   * \see  dash::for_each_segment
+   */
+  index_type segment_size(index_type max_size) const
+  {
+    if (max_size <= 0) {
+      return 0;
+    }
+    if (_idx > _max_idx) {
+      // Position is not resolved in the pattern's index space, treat it as
+      // a single element:
+      return 1;
+    }
+    auto g_coords = coords(_idx);
+    auto size     = dash::internal::pattern_segment_size(
+                      *_pattern, g_coords);
+    if (_viewspec != nullptr) {
+      std::array<IndexType, NumDimensions> view_offsets;
+      std::array<IndexType, NumDimensions> view_extents;
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        view_offsets[d] = _viewspec->offset(d);
+        view_extents[d] = _viewspec->extent(d);
+      }
+      size = std::min<index_type>(
+               size,
+               dash::internal::linear_run_length<Arrangement>(
+                 g_coords, view_offsets, view_extents,
+                 _pattern->extents()));
+    }
+    return std::max<index_type>(1, std::min<index_type>(size, max_size));
+  }
+
   /**
    * Map iterator to global index domain by projecting the iterator's view.
    */
@@ -201,6 +201,55 @@ public:
     DASH_LOG_TRACE("LocalListRef.push_back >");
   }
 
+  /**
+   * Inserts the given elements at the end of the list.
+   * Increases the container size by \c num_values.
+   *
+   * If the local capacity is exceeded, local memory is acquired for all
+   * missing nodes at once, rounded up to a multiple of the list's local
+   * buffer size. Nodes that fit into the remaining capacity of the current
+   * bucket are stored there, the remaining nodes in a single new bucket.
+   */
+  void append(
+    const value_type * values,
+    size_type          num_values)
+  {
+    DASH_LOG_TRACE("LocalListRef.append()", "n:", num_values);
+    if (num_values == 0) {
+      return;
+    }
+    auto l_cap_old  = _list->_globmem->local_size();
+    auto l_size_old = _list->_local_sizes.local[0];
+    auto l_size_new = l_size_old + num_values;
+    if (l_size_new > l_cap_old) {
+      auto nlbuf = _list->_local_buffer_size;
+      auto ngrow = dash::math::div_ceil(l_size_new - l_cap_old, nlbuf)
+                   * nlbuf;
+      DASH_LOG_TRACE("LocalListRef.append", "globmem.grow(", ngrow, ")");
+      _list->_globmem->grow(ngrow);
+    }
+    ListNode_t * prev = nullptr;
+    if (l_size_old > 0) {
+      prev = static_cast<ListNode_t *>(
+               _list->_globmem->lbegin() + (l_size_old - 1));
+    }
+    auto node_it = _list->_globmem->lbegin() + l_size_old;
+    for (size_type i = 0; i < num_values; ++i, ++node_it) {
+      ListNode_t * node = static_cast<ListNode_t *>(node_it);
+      node->value = values[i];
+      node->lprev = prev;
+      node->lnext = nullptr;
+      node->gprev = _gprev;
+      node->gnext = _gnext;
+      if (prev != nullptr) {
+        prev->lnext = node;
+      }
+      prev = node;
+    }
+    _list->_local_sizes.local[0] = l_size_new;
+    DASH_LOG_TRACE("LocalListRef.append >", "local size:", l_size_new);
+  }
+
   /**
    * Removes and destroys the last element in the list, reducing the
    * container size by one.
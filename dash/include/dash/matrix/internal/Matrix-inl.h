@@ -643,6 +643,23 @@ Matrix<T, NumDim, IndexT, PatternT>
   return _pattern;
 }
 
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+constexpr const typename Matrix<T, NumDim, IndexT, PatternT>::GlobMem_t &
+Matrix<T, NumDim, IndexT, PatternT>
+::globmem() const noexcept
+{
+  return *_glob_mem;
+}
+
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+template <typename ... Args>
+ReadCache<Matrix<T, NumDim, IndexT, PatternT>>
+Matrix<T, NumDim, IndexT, PatternT>
+::cached(Args && ... args) const
+{
+  return ReadCache<self_t>(*this, std::forward<Args>(args)...);
+}
+
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
 constexpr bool Matrix<T, NumDim, IndexT, PatternT>
 ::is_local(
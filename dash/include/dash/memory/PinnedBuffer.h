@@ -0,0 +1,152 @@
+#ifndef DASH__MEMORY__PINNED_BUFFER_H__INCLUDED
+#define DASH__MEMORY__PINNED_BUFFER_H__INCLUDED
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+
+namespace dash {
+
+/**
+ * Contiguous local buffer of fixed size allocated in memory that is
+ * registered with the communication backend.
+ *
+ * Pinned buffers are intended as staging buffers that are repeatedly
+ * used as destination or source of one-sided transfers like
+ * \c dash::copy, e.g. for blocks fetched in every iteration of a stencil
+ * or matrix multiplication. The buffer memory is obtained from
+ * \c MPI_Alloc_mem, which most MPI implementations pre-register with the
+ * network, and its pages are locked in physical memory.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::pinned_buffer<double> block(block_size);
+ *   for (auto it = 0; it < niter; ++it) {
+ *     dash::copy(array.begin() + offset(it),
+ *                array.begin() + offset(it) + block_size,
+ *                block.begin());
+ *   }
+ * \endcode
+ *
+ * Arbitrary user buffers can be registered using
+ * \c dart_buffer_register.
+ */
+template <typename ValueType>
+class pinned_buffer
+{
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::pinned_buffer requires trivially copyable elements");
+
+private:
+  typedef pinned_buffer<ValueType> self_t;
+
+public:
+  typedef ValueType                value_type;
+  typedef size_t                   size_type;
+  typedef std::ptrdiff_t           difference_type;
+  typedef value_type             * iterator;
+  typedef const value_type       * const_iterator;
+  typedef value_type             & reference;
+  typedef const value_type       & const_reference;
+
+public:
+  /**
+   * Creates an empty buffer.
+   */
+  pinned_buffer() noexcept = default;
+
+  /**
+   * Allocates a buffer of \c nelem value-initialized elements.
+   */
+  explicit pinned_buffer(size_type nelem)
+  : _size(nelem)
+  {
+    void * addr = nullptr;
+    if (dart_buffer_alloc(nelem * sizeof(value_type), &addr) != DART_OK) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "pinned_buffer: failed to allocate buffer of " << nelem <<
+        " elements");
+    }
+    _data = static_cast<value_type *>(addr);
+    for (size_type i = 0; i < _size; ++i) {
+      new (_data + i) value_type();
+    }
+    DASH_LOG_DEBUG("pinned_buffer(nelem)", "allocated", nelem, "elements");
+  }
+
+  pinned_buffer(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  pinned_buffer(self_t && other) noexcept
+  : _data(other._data),
+    _size(other._size)
+  {
+    other._data = nullptr;
+    other._size = 0;
+  }
+
+  self_t & operator=(self_t && other) noexcept
+  {
+    if (this != &other) {
+      free();
+      _data       = other._data;
+      _size       = other._size;
+      other._data = nullptr;
+      other._size = 0;
+    }
+    return *this;
+  }
+
+  ~pinned_buffer()
+  {
+    free();
+  }
+
+  inline iterator begin() noexcept             { return _data; }
+  inline const_iterator begin() const noexcept { return _data; }
+  inline iterator end() noexcept               { return _data + _size; }
+  inline const_iterator end() const noexcept   { return _data + _size; }
+
+  inline value_type * data() noexcept             { return _data; }
+  inline const value_type * data() const noexcept { return _data; }
+
+  inline size_type size() const noexcept { return _size; }
+  inline bool empty() const noexcept     { return _size == 0; }
+
+  inline reference operator[](size_type idx)
+  {
+    return _data[idx];
+  }
+
+  inline const_reference operator[](size_type idx) const
+  {
+    return _data[idx];
+  }
+
+private:
+  void free() noexcept
+  {
+    if (_data != nullptr) {
+      dart_buffer_free(_data);
+      _data = nullptr;
+      _size = 0;
+    }
+  }
+
+private:
+  value_type * _data = nullptr;
+  size_type    _size = 0;
+
+}; // class pinned_buffer
+
+} // namespace dash
+
+#endif // DASH__MEMORY__PINNED_BUFFER_H__INCLUDED
@@ -131,6 +131,10 @@ private:
   std::array<IndexType, 2>    _lbegin_lend     = { };
   /// Corresponding global index past last local index of the active unit
   IndexType                   _lend            = -1;
+  /// Divisor of the block size
+  math::FastDivisor<IndexType> _blocksize_div;
+  /// Divisor of the number of units
+  math::FastDivisor<IndexType> _nunits_div;
 
 public:
   constexpr BlockPattern() = delete;
@@ -225,7 +229,9 @@ public:
         _blocksize,
         _local_size)),
     _local_capacity(initialize_local_capacity()),
-    _lbegin_lend(initialize_local_range(_local_size))
+    _lbegin_lend(initialize_local_range(_local_size)),
+    _blocksize_div(_blocksize),
+    _nunits_div(_nunits)
   { }
 
   /**
@@ -282,7 +288,9 @@ public:
         _blocksize,
         _local_size)),
     _local_capacity(initialize_local_capacity()),
-    _lbegin_lend(initialize_local_range(_local_size))
+    _lbegin_lend(initialize_local_range(_local_size)),
+    _blocksize_div(_blocksize),
+    _nunits_div(_nunits)
   { }
 
   /**
@@ -376,13 +384,12 @@ public:
    *
    * \see DashPatternConcept
    */
-  constexpr team_unit_t unit_at(
+  team_unit_t unit_at(
     /// Absolute coordinates of the point
     const std::array<IndexType, NumDimensions> & coords,
     /// View specification (offsets) to apply on \c coords
     const ViewSpec_t & viewspec) const {
-    return team_unit_t (((coords[0] + viewspec[0].offset) / _blocksize)
-                        % _nunits);
+    return unit_at(coords[0] + viewspec[0].offset);
   }
 
   /**
@@ -390,9 +397,9 @@ public:
    *
    * \see DashPatternConcept
    */
-  constexpr team_unit_t unit_at(
+  team_unit_t unit_at(
     const std::array<IndexType, NumDimensions> & coords) const {
-    return team_unit_t((coords[0] / _blocksize) % _nunits);
+    return unit_at(coords[0]);
   }
 
   /**
@@ -400,14 +407,13 @@ public:
    *
    * \see DashPatternConcept
    */
-  constexpr team_unit_t unit_at(
+  team_unit_t unit_at(
     /// Global linear element offset
     IndexType global_pos,
     /// View to apply global position
     const ViewSpec_t & viewspec
   ) const {
-    return team_unit_t(((global_pos + viewspec[0].offset) / _blocksize)
-                       % _nunits);
+    return unit_at(global_pos + viewspec[0].offset);
   }
 
   /**
@@ -415,11 +421,12 @@ public:
    *
    * \see DashPatternConcept
    */
-  constexpr team_unit_t unit_at(
+  team_unit_t unit_at(
     /// Global linear element offset
     IndexType global_pos
   ) const {
-    return team_unit_t((global_pos / _blocksize) % _nunits);
+    return team_unit_t(
+             _nunits_div.modulo(_blocksize_div.divide(global_pos)));
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -572,7 +579,7 @@ public:
    *
    * \see  DashPatternConcept
    */
-  constexpr local_coords_t local(
+  local_coords_t local(
     const std::array<IndexType, NumDimensions> & global_coords) const {
     return local_coords_t {
              unit_at(global_coords),      // .unit
@@ -583,13 +590,17 @@ public:
   /**
    * Converts global index to its associated unit and respective local index.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
-  constexpr local_index_t local(
+  local_index_t local(
     IndexType g_index) const {
-    return local_index(coords(g_index));
+    IndexType block, phase, l_block, unit;
+    _blocksize_div.divmod(g_index, block, phase);
+    _nunits_div.divmod(block, l_block, unit);
+    return local_index_t {
+             team_unit_t(unit),
+             static_cast<IndexType>(l_block * _blocksize + phase)
+           };
   }
 
   /**
@@ -598,14 +609,14 @@ public:
    *
    * \see  DashPatternConcept
    */
-  constexpr std::array<IndexType, NumDimensions> local_coords(
+  std::array<IndexType, NumDimensions> local_coords(
     const std::array<IndexType, NumDimensions> & global_coords
   ) const noexcept {
+    IndexType block, phase;
+    _blocksize_div.divmod(global_coords[0], block, phase);
     return std::array<IndexType, 1> {{
              static_cast<IndexType>(
-               (((global_coords[0] / _blocksize) / _nunits) * _blocksize)
-               + (global_coords[0] % _blocksize)
-             )
+               (_nunits_div.divide(block) * _blocksize) + phase)
            }};
   }
 
@@ -614,12 +625,9 @@ public:
    *
    * \see  DashPatternConcept
    */
-  constexpr local_index_t local_index(
+  local_index_t local_index(
     const std::array<IndexType, NumDimensions> & g_coords) const {
-    return local_index_t {
-             team_unit_t(unit_at(g_coords[0])),
-             at(g_coords)
-           };
+    return local(g_coords[0]);
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -700,7 +708,7 @@ public:
    *
    * \see  DashPatternConcept
    */
-  constexpr IndexType at(
+  IndexType at(
     const std::array<IndexType, NumDimensions> & g_coords) const {
     return local_coords(g_coords)[0];
   }
@@ -712,7 +720,7 @@ public:
    *
    * \see  DashPatternConcept
    */
-  constexpr IndexType at(
+  IndexType at(
     const std::array<IndexType, 1> & g_coords,
     const ViewSpec_t & viewspec) const {
     return local_coords(
@@ -730,7 +738,7 @@ public:
    * \see  DashPatternConcept
    */
   template<typename ... Values>
-  constexpr IndexType at(IndexType value, Values ... values) const {
+  IndexType at(IndexType value, Values ... values) const {
     static_assert(
       sizeof...(values) == NumDimensions-1,
       "Wrong parameter number");
@@ -768,7 +776,7 @@ public:
    *
    * \see  DashPatternConcept
    */
-  constexpr bool is_local(
+  bool is_local(
     IndexType index,
     team_unit_t unit) const {
     return unit_at(index) == unit;
@@ -780,7 +788,7 @@ public:
    *
    * \see  DashPatternConcept
    */
-  constexpr bool is_local(
+  bool is_local(
     IndexType index) const {
     return is_local(index, team().myid());
   }
@@ -1113,7 +1121,9 @@ private:
          _blocksize,
          _local_size)),
      _local_capacity(initialize_local_capacity()),
-     _lbegin_lend(initialize_local_range(_local_size))
+     _lbegin_lend(initialize_local_range(_local_size)),
+     _blocksize_div(_blocksize),
+     _nunits_div(_nunits)
   {}
 
   /**
@@ -0,0 +1,1493 @@
+#ifndef DASH__CURVE_TILE_PATTERN_H_
+#define DASH__CURVE_TILE_PATTERN_H_
+
+#include <functional>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <iostream>
+#include <sstream>
+
+#include <dash/Types.h>
+#include <dash/Distribution.h>
+#include <dash/Exception.h>
+#include <dash/Dimensional.h>
+#include <dash/Cartesian.h>
+#include <dash/Team.h>
+
+#include <dash/pattern/PatternProperties.h>
+#include <dash/pattern/internal/PatternArguments.h>
+#include <dash/pattern/internal/SpaceFillingCurve.h>
+
+#include <dash/internal/Math.h>
+#include <dash/internal/Logging.h>
+
+namespace dash {
+
+/**
+ * Space-filling curves along which \c dash::CurveTilePattern orders the
+ * tiles of its index space.
+ */
+typedef enum SpaceFillingCurve {
+  SFC_UNDEFINED = 0,
+  /// Morton curve (Z-order), bit interleaving of tile coordinates
+  SFC_MORTON,
+  /// Hilbert curve, consecutive tiles on the curve are adjacent
+  SFC_HILBERT
+} SpaceFillingCurve;
+
+/**
+ * Defines how a list of global indices is mapped to single units within
+ * a Team.
+ *
+ * Tiles are ordered along a space-filling curve through the cartesian
+ * arrangement of tiles, and every unit is assigned a contiguous segment
+ * of the curve. The tiles of a unit therefore form a compact region with
+ * a low surface-to-volume ratio, also for tile arrangements that are not
+ * square or whose extents are not powers of two.
+ * The number of tiles assigned to units differs by at most one.
+ *
+ * Local tiles are stored consecutively in the order of the curve, like
+ * in \c dash::SeqTilePattern.
+ * Expects \c extent[d] to be a multiple of \c blocksize[d].
+ *
+ * \tparam  NumDimensions  The number of dimensions of the pattern
+ * \tparam  Arrangement    The memory order of the pattern (ROW_MAJOR
+ *                         or COL_MAJOR), defaults to ROW_MAJOR.
+ *                         Memory order defines how elements in the
+ *                         pattern will be iterated predominantly
+ *                         \see MemArrange
+ * \tparam  Curve          The space-filling curve ordering the tiles,
+ *                         defaults to SFC_HILBERT.
+ *
+ * \concept{DashPatternConcept}
+ *
+ */
+template<
+  dim_t             NumDimensions,
+  MemArrange        Arrangement = ROW_MAJOR,
+  typename          IndexType   = dash::default_index_t,
+  SpaceFillingCurve Curve       = SFC_HILBERT>
+class CurveTilePattern
+{
+public:
+  static constexpr char const * PatternName = "CurveTilePattern";
+
+public:
+  /// Satisfiable properties in pattern property category Partitioning:
+  typedef pattern_partitioning_properties<
+              // Block extents are constant for every dimension.
+              pattern_partitioning_tag::rectangular,
+              // Identical number of elements in every block.
+              pattern_partitioning_tag::balanced
+          > partitioning_properties;
+  /// Satisfiable properties in pattern property category Mapping:
+  typedef pattern_mapping_properties<
+              // Number of blocks assigned to a unit may differ.
+              pattern_mapping_tag::unbalanced,
+              // Blocks of a unit are contiguous along a space-filling
+              // curve.
+              pattern_mapping_tag::compact
+          > mapping_properties;
+  /// Satisfiable properties in pattern property category Layout:
+  typedef pattern_layout_properties<
+              // Elements are contiguous in local memory within single
+              // block.
+              pattern_layout_tag::blocked,
+              // Local element order corresponds to a logical
+              // linearization within single blocks.
+              pattern_layout_tag::linear
+          > layout_properties;
+
+private:
+  /// Fully specified type definition of self type
+  typedef CurveTilePattern<NumDimensions, Arrangement, IndexType, Curve>
+    self_t;
+  /// Derive size type from given signed index / ptrdiff type
+  typedef typename std::make_unsigned<IndexType>::type
+    SizeType;
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, IndexType>
+    MemoryLayout_t;
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, IndexType>
+    LocalMemoryLayout_t;
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, SizeType>
+    BlockSpec_t;
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, SizeType>
+    BlockSizeSpec_t;
+  typedef DistributionSpec<NumDimensions>
+    DistributionSpec_t;
+  typedef TeamSpec<NumDimensions, IndexType>
+    TeamSpec_t;
+  typedef SizeSpec<NumDimensions, SizeType>
+    SizeSpec_t;
+  typedef ViewSpec<NumDimensions, IndexType>
+    ViewSpec_t;
+  typedef internal::PatternArguments<NumDimensions, IndexType>
+    PatternArguments_t;
+
+public:
+  typedef IndexType   index_type;
+  typedef SizeType    size_type;
+  typedef ViewSpec_t  viewspec_type;
+  typedef struct {
+    team_unit_t unit;
+    IndexType   index;
+  } local_index_t;
+  typedef struct {
+    team_unit_t unit;
+    std::array<index_type, NumDimensions> coords;
+  } local_coords_t;
+
+private:
+  /// Distribution type (BLOCKED, CYCLIC, BLOCKCYCLIC, TILE or NONE) of
+  /// all dimensions. Defaults to BLOCKED in first, and NONE in higher
+  /// dimensions
+  DistributionSpec_t          _distspec;
+  /// Team containing the units to which the patterns element are mapped
+  dash::Team                * _team            = nullptr;
+  /// The active unit's id.
+  team_unit_t                 _myid;
+  /// Cartesian arrangement of units within the team
+  TeamSpec_t                  _teamspec;
+  /// The global layout of the pattern's elements in memory respective to
+  /// memory order. Also specifies the extents of the pattern space.
+  MemoryLayout_t              _memory_layout;
+  /// Total amount of units to which this pattern's elements are mapped
+  SizeType                    _nunits          = dash::Team::All().size();
+  /// Maximum extents of a block in this pattern
+  BlockSizeSpec_t             _blocksize_spec;
+  /// Arrangement of blocks in all dimensions
+  BlockSpec_t                 _blockspec;
+  /// Global block indices in the order of the space-filling curve
+  std::vector<IndexType>      _curve_blocks;
+  /// Unit owning the block, by global block index
+  std::vector<team_unit_t>    _block_units;
+  /// Local block index of the block at its unit, by global block index
+  std::vector<IndexType>      _block_lindex;
+  /// Arrangement of local blocks in all dimensions
+  BlockSpec_t                 _local_blockspec;
+  /// A projected view of the global memory layout representing the
+  /// local memory layout of this unit's elements respective to memory
+  /// order.
+  LocalMemoryLayout_t         _local_memory_layout;
+  /// Maximum number of elements assigned to a single unit
+  SizeType                    _local_capacity;
+  /// Corresponding global index to first local index of the active unit
+  IndexType                   _lbegin;
+  /// Corresponding global index past last local index of the active unit
+  IndexType                   _lend;
+
+public:
+  /**
+   * Constructor, initializes a pattern from an argument list consisting
+   * of the pattern size (extent, number of elements) in every dimension
+   * followed by optional distribution types.
+   *
+   * Examples:
+   *
+   * \code
+   *   // 8x8 tiles of 4x4 elements ordered along a Hilbert curve:
+   *   CurveTilePattern<2> p1(32, 32, TILE(4), TILE(4));
+   * \endcode
+   */
+  template<typename ... Args>
+  CurveTilePattern(
+    /// Argument list consisting of the pattern size (extent, number of
+    /// elements) in every dimension followed by optional distribution
+    /// types.
+    SizeType arg,
+    /// Argument list consisting of the pattern size (extent, number of
+    /// elements) in every dimension followed by optional distribution
+    /// types.
+    Args && ... args)
+  : CurveTilePattern(PatternArguments_t(arg, args...))
+  {
+    DASH_LOG_TRACE("CurveTilePattern()", "Constructor with Argument list");
+    initialize_local_range();
+  }
+
+  /**
+   * Constructor, initializes a pattern from explicit instances of
+   * \c SizeSpec, \c DistributionSpec, \c TeamSpec and a \c Team.
+   *
+   * The team spec only specifies the number of units, tiles are assigned
+   * to units along the curve regardless of the units' arrangement.
+   *
+   * Examples:
+   *
+   * \code
+   *   CurveTilePattern<2> p1(SizeSpec<2>(32, 32),
+   *                          DistributionSpec<2>(TILE(4), TILE(4)),
+   *                          TeamSpec<2>(dash::Team::All()),
+   *                          dash::Team::All());
+   * \endcode
+   */
+  CurveTilePattern(
+    /// CurveTilePattern size (extent, number of elements) in every
+    /// dimension
+    const SizeSpec_t         & sizespec,
+    /// Distribution type (BLOCKED, CYCLIC, BLOCKCYCLIC, TILE or NONE) of
+    /// all dimensions. Defaults to BLOCKED in first, and NONE in higher
+    /// dimensions
+    const DistributionSpec_t & dist,
+    /// Cartesian arrangement of units within the team
+    const TeamSpec_t         & teamspec,
+    /// Team containing units to which this pattern maps its elements
+    dash::Team               & team     = dash::Team::All())
+  : _distspec(dist),
+    _team(&team),
+    _myid(_team->myid()),
+    _teamspec(
+      teamspec,
+      _distspec,
+      *_team),
+    _memory_layout(sizespec.extents()),
+    _nunits(_teamspec.size()),
+    _blocksize_spec(initialize_blocksizespec(
+        sizespec,
+        _distspec,
+        _teamspec)),
+    _blockspec(initialize_blockspec(
+        sizespec,
+        _blocksize_spec)) {
+    DASH_LOG_TRACE("CurveTilePattern()", "(sizespec, dist, teamspec, team)");
+    initialize_curve();
+    initialize_local_range();
+  }
+
+  /**
+   * Constructor, initializes a pattern from explicit instances of
+   * \c SizeSpec, \c DistributionSpec and a \c Team.
+   *
+   * Examples:
+   *
+   * \code
+   *   CurveTilePattern<2> p1(SizeSpec<2>(32, 32),
+   *                          DistributionSpec<2>(TILE(4), TILE(4)));
+   * \endcode
+   */
+  CurveTilePattern(
+    /// CurveTilePattern size (extent, number of elements) in every
+    /// dimension
+    const SizeSpec_t         & sizespec,
+    /// Distribution type (BLOCKED, CYCLIC, BLOCKCYCLIC, TILE or NONE) of
+    /// all dimensions. Defaults to BLOCKED in first, and NONE in higher
+    /// dimensions
+    const DistributionSpec_t & dist = DistributionSpec_t(),
+    /// Team containing units to which this pattern maps its elements
+    Team                     & team = dash::Team::All())
+  : _distspec(dist),
+    _team(&team),
+    _myid(_team->myid()),
+    _teamspec(_distspec, *_team),
+    _memory_layout(sizespec.extents()),
+    _nunits(_teamspec.size()),
+    _blocksize_spec(initialize_blocksizespec(
+        sizespec,
+        _distspec,
+        _teamspec)),
+    _blockspec(initialize_blockspec(
+        sizespec,
+        _blocksize_spec)) {
+    DASH_LOG_TRACE("CurveTilePattern()", "(sizespec, dist, team)");
+    initialize_curve();
+    initialize_local_range();
+  }
+
+  /**
+   * Copy constructor.
+   */
+  CurveTilePattern(const self_t & other)
+  : _distspec(other._distspec),
+    _team(other._team),
+    _myid(_team->myid()),
+    _teamspec(other._teamspec),
+    _memory_layout(other._memory_layout),
+    _nunits(other._nunits),
+    _blocksize_spec(other._blocksize_spec),
+    _blockspec(other._blockspec),
+    _curve_blocks(other._curve_blocks),
+    _block_units(other._block_units),
+    _block_lindex(other._block_lindex),
+    _local_blockspec(other._local_blockspec),
+    _local_memory_layout(other._local_memory_layout),
+    _local_capacity(other._local_capacity),
+    _lbegin(other._lbegin),
+    _lend(other._lend) {
+  }
+
+  /**
+   * Copy constructor using non-const lvalue reference parameter.
+   *
+   * Introduced so variadic constructor is not a better match for
+   * copy-construction.
+   */
+  CurveTilePattern(self_t & other)
+  : CurveTilePattern(static_cast<const self_t &>(other))
+  { }
+
+  /**
+   * Equality comparison operator.
+   */
+  bool operator==(
+    /// CurveTilePattern instance to compare for equality
+    const self_t & other) const
+  {
+    if (this == &other) {
+      return true;
+    }
+    // no need to compare all members as most are derived from
+    // constructor arguments.
+    return(
+      _distspec       == other._distspec &&
+      _teamspec       == other._teamspec &&
+      _memory_layout  == other._memory_layout &&
+      _blockspec      == other._blockspec &&
+      _blocksize_spec == other._blocksize_spec &&
+      _nunits         == other._nunits
+    );
+  }
+
+  /**
+   * Inquality comparison operator.
+   */
+  bool operator!=(
+    /// CurveTilePattern instance to compare for inequality
+    const self_t & other
+  ) const {
+    return !(*this == other);
+  }
+
+  /**
+   * Assignment operator.
+   */
+  CurveTilePattern & operator=(const CurveTilePattern & other) {
+    if (this != &other) {
+      _distspec            = other._distspec;
+      _team                = other._team;
+      _teamspec            = other._teamspec;
+      _memory_layout       = other._memory_layout;
+      _local_memory_layout = other._local_memory_layout;
+      _blocksize_spec      = other._blocksize_spec;
+      _blockspec           = other._blockspec;
+      _curve_blocks        = other._curve_blocks;
+      _block_units         = other._block_units;
+      _block_lindex        = other._block_lindex;
+      _local_blockspec     = other._local_blockspec;
+      _local_capacity      = other._local_capacity;
+      _nunits              = other._nunits;
+      _lbegin              = other._lbegin;
+      _lend                = other._lend;
+    }
+    return *this;
+  }
+
+  /**
+   * Resolves the global index of the first local element in the pattern.
+   *
+   * \see DashPatternConcept
+   */
+  IndexType lbegin() const {
+    return _lbegin;
+  }
+
+  /**
+   * Resolves the global index past the last local element in the pattern.
+   *
+   * \see DashPatternConcept
+   */
+  IndexType lend() const {
+    return _lend;
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// unit_at
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Convert given point in pattern to its assigned unit id.
+   *
+   * \see DashPatternConcept
+   */
+  team_unit_t unit_at(
+    /// Absolute coordinates of the point relative to the given view.
+    const std::array<IndexType, NumDimensions> & coords,
+    /// View specification (offsets) of the coordinates.
+    const ViewSpec_t & viewspec) const
+  {
+    std::array<IndexType, NumDimensions> vs_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      vs_coords[d] = coords[d] + viewspec.offset(d);
+    }
+    return unit_at(vs_coords);
+  }
+
+  /**
+   * Convert given coordinate in pattern to its assigned unit id.
+   *
+   * \see DashPatternConcept
+   */
+  team_unit_t unit_at(
+    const std::array<IndexType, NumDimensions> & coords) const
+  {
+    auto unit_id = _block_units[block_at(coords)];
+    DASH_LOG_TRACE("CurveTilePattern.unit_at()",
+                   "coords:", coords, "> unit:", unit_id);
+    return unit_id;
+  }
+
+  /**
+   * Convert given global linear index to its assigned unit id.
+   *
+   * \see DashPatternConcept
+   */
+  team_unit_t unit_at(
+    /// Global linear element offset
+    IndexType global_pos,
+    /// View to apply global position
+    const ViewSpec_t & viewspec) const
+  {
+    auto global_coords = _memory_layout.coords(global_pos);
+    return unit_at(global_coords, viewspec);
+  }
+
+  /**
+   * Convert given global linear index to its assigned unit id.
+   *
+   * \see DashPatternConcept
+   */
+  team_unit_t unit_at(
+    /// Global linear element offset
+    IndexType global_pos) const
+  {
+    auto global_coords = _memory_layout.coords(global_pos);
+    return unit_at(global_coords);
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// extent
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * The number of elements in this pattern in the given dimension.
+   *
+   * \see  blocksize()
+   * \see  local_size()
+   * \see  local_extent()
+   *
+   * \see  DashPatternConcept
+   */
+  SizeType extent(dim_t dim) const {
+    if (dim >= NumDimensions || dim < 0) {
+      DASH_THROW(
+        dash::exception::OutOfRange,
+        "Wrong dimension for CurveTilePattern::extent. "
+        << "Expected dimension between 0 and " << NumDimensions-1 << ", "
+        << "got " << dim);
+    }
+    return _memory_layout.extent(dim);
+  }
+
+  /**
+   * The actual number of elements in this pattern that are local to the
+   * calling unit in the given dimension.
+   *
+   * \see  local_extents()
+   * \see  blocksize()
+   * \see  local_size()
+   * \see  extent()
+   *
+   * \see  DashPatternConcept
+   */
+  SizeType local_extent(dim_t dim) const
+  {
+    if (dim >= NumDimensions || dim < 0) {
+      DASH_THROW(
+        dash::exception::OutOfRange,
+        "Wrong dimension for CurveTilePattern::local_extent. "
+        << "Expected dimension between 0 and " << NumDimensions-1 << ", "
+        << "got " << dim);
+    }
+    return _local_memory_layout.extent(dim);
+  }
+
+  /**
+   * The actual number of elements in this pattern that are local to the
+   * given unit, by dimension.
+   *
+   * \see  local_extent()
+   * \see  blocksize()
+   * \see  local_size()
+   * \see  extent()
+   *
+   * \see  DashPatternConcept
+   */
+  std::array<SizeType, NumDimensions> local_extents(
+      team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const
+  {
+    if (unit == UNDEFINED_TEAM_UNIT_ID) {
+      unit = _myid;
+    }
+    if (unit == _myid) {
+      return _local_memory_layout.extents();
+    }
+    return initialize_local_extents(unit);
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// local
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Convert given local coordinates and viewspec to linear local offset
+   * (index).
+   *
+   * \see DashPatternConcept
+   */
+  IndexType local_at(
+    /// Point in local memory
+    const std::array<IndexType, NumDimensions> & local_coords,
+    /// View specification (local offsets) to apply on \c local_coords
+    const ViewSpec_t & viewspec) const
+  {
+    std::array<IndexType, NumDimensions> vs_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      vs_coords[d] = local_coords[d] + viewspec.offset(d);
+    }
+    return local_at(vs_coords);
+  }
+
+  /**
+   * Convert given local coordinates to linear local offset (index).
+   *
+   * \see DashPatternConcept
+   */
+  IndexType local_at(
+    /// Point in local memory
+    const std::array<IndexType, NumDimensions> & local_coords) const
+  {
+    // Phase coordinates of element:
+    std::array<IndexType, NumDimensions> phase_coords;
+    // Coordinates of the local block containing the element:
+    std::array<IndexType, NumDimensions> block_coords_l;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      auto block_size_d = _blocksize_spec.extent(d);
+      phase_coords[d]   = local_coords[d] % block_size_d;
+      block_coords_l[d] = local_coords[d] / block_size_d;
+    }
+    // Number of blocks preceeding the coordinates' block:
+    auto block_offset_l = _local_blockspec.at(block_coords_l);
+    auto local_index    =
+           block_offset_l * _blocksize_spec.size() + // preceeding blocks
+           _blocksize_spec.at(phase_coords);         // element phase
+    DASH_LOG_TRACE("CurveTilePattern.local_at()",
+                   "local coords:",       local_coords,
+                   "local block coords:", block_coords_l,
+                   "phase coords:",       phase_coords,
+                   "> local index:",      local_index);
+    return local_index;
+  }
+
+  /**
+   * Converts global coordinates to their associated unit and its
+   * respective local coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  local_coords_t local(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    local_coords_t l_coords;
+    auto g_block_index = block_at(global_coords);
+    l_coords.unit      = _block_units[g_block_index];
+    l_coords.coords    = local_coords(global_coords);
+    return l_coords;
+  }
+
+  /**
+   * Converts global index to its associated unit and respective local
+   * index.
+   *
+   * \see  DashPatternConcept
+   */
+  local_index_t local(
+    IndexType g_index) const
+  {
+    DASH_LOG_TRACE_VAR("CurveTilePattern.local()", g_index);
+    return local_index(coords(g_index));
+  }
+
+  /**
+   * Converts global coordinates to their associated unit's respective
+   * local coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> local_coords(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    // Blocks in local memory are arranged in a one-dimensional sequence.
+    auto l_block_index = _block_lindex[block_at(global_coords)];
+    std::array<IndexType, NumDimensions> local_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      local_coords[d] = global_coords[d] % _blocksize_spec.extent(d);
+    }
+    local_coords[0] += l_block_index * _blocksize_spec.extent(0);
+    return local_coords;
+  }
+
+  /**
+   * Resolves the unit and the local index from global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  local_index_t local_index(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    // Phase coordinates of element:
+    std::array<IndexType, NumDimensions> phase_coords;
+    // Coordinates of the block containing the element:
+    std::array<IndexType, NumDimensions> block_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      auto blocksize_d  = _blocksize_spec.extent(d);
+      phase_coords[d]   = global_coords[d] % blocksize_d;
+      block_coords[d]   = global_coords[d] / blocksize_d;
+    }
+    auto g_block_index = _blockspec.at(block_coords);
+    auto unit          = _block_units[g_block_index];
+    auto l_block_index = _block_lindex[g_block_index];
+    index_type l_index = l_block_index * _blocksize_spec.size() + // blocks
+                         _blocksize_spec.at(phase_coords);        // phase
+    DASH_LOG_TRACE("CurveTilePattern.local_index()",
+                   "gcoords:",        global_coords,
+                   "g_block_index:",  g_block_index,
+                   "l_block_index:",  l_block_index,
+                   "> unit:",         unit,
+                   "> l_index:",      l_index);
+    return local_index_t { unit, l_index };
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// global
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Converts local coordinates of a given unit to global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> global(
+    team_unit_t unit,
+    const std::array<IndexType, NumDimensions> & local_coords) const
+  {
+    // Blocks in local memory are arranged in a one-dimensional sequence.
+    // Local blockspec has extents { n_local_blocks, 1, 1, ... }.
+    auto l_block_index  = local_coords[0] / _blocksize_spec.extent(0);
+    auto g_block_coords = _blockspec.coords(
+                            global_block_index(unit, l_block_index));
+    // Global coordinate of local element:
+    std::array<IndexType, NumDimensions> global_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      auto blocksize_d = _blocksize_spec.extent(d);
+      auto phase       = local_coords[d] % blocksize_d;
+      global_coords[d] = (g_block_coords[d] * blocksize_d) + phase;
+    }
+    DASH_LOG_TRACE("CurveTilePattern.global()",
+                   "unit:",           unit,
+                   "lcoords:",        local_coords,
+                   "l_block_index:",  l_block_index,
+                   "> gcoords:",      global_coords);
+    return global_coords;
+  }
+
+  /**
+   * Converts local coordinates of a active unit to global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> global(
+    const std::array<IndexType, NumDimensions> & local_coords) const {
+    return global(_myid, local_coords);
+  }
+
+  /**
+   * Resolve an element's linear global index from the calling unit's local
+   * index of that element.
+   *
+   * \see  at  Inverse of global()
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType global(
+    IndexType local_index) const
+  {
+    auto block_size    = _blocksize_spec.size();
+    auto phase         = local_index % block_size;
+    auto l_block_index = local_index / block_size;
+    // Coordinate of element in block:
+    auto phase_coord   = _blocksize_spec.coords(phase);
+    auto g_block_coord = _blockspec.coords(
+                           global_block_index(_myid, l_block_index));
+    std::array<IndexType, NumDimensions> g_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      g_coords[d] = g_block_coord[d] * _blocksize_spec.extent(d) +
+                    phase_coord[d];
+    }
+    auto offset = _memory_layout.at(g_coords);
+    DASH_LOG_TRACE("CurveTilePattern.global()",
+                   "local_index:", local_index,
+                   "> offset:",    offset);
+    return offset;
+  }
+
+  /**
+   * Resolve an element's linear global index from a given unit's local
+   * coordinates of that element.
+   *
+   * \see  at
+   * \see  global_at
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType global_index(
+    team_unit_t unit,
+    const std::array<IndexType, NumDimensions> & local_coords) const
+  {
+    return _memory_layout.at(global(unit, local_coords));
+  }
+
+  /**
+   * Global coordinates and viewspec to global position in the pattern's
+   * block-wise iteration order.
+   *
+   * \see  at
+   * \see  local_at
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType global_at(
+    const std::array<IndexType, NumDimensions> & global_coords,
+    const ViewSpec_t                           & viewspec) const
+  {
+    std::array<IndexType, NumDimensions> vs_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      vs_coords[d] = global_coords[d] + viewspec.offset(d);
+    }
+    return global_at(vs_coords);
+  }
+
+  /**
+   * Global coordinates to global position in the pattern's block-wise
+   * iteration order.
+   *
+   * \see  at
+   * \see  local_at
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType global_at(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    // Phase coordinates of element:
+    std::array<IndexType, NumDimensions> phase_coords;
+    // Coordinates of the block containing the element:
+    std::array<IndexType, NumDimensions> block_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      auto blocksize_d = _blocksize_spec.extent(d);
+      phase_coords[d]  = global_coords[d] % blocksize_d;
+      block_coords[d]  = global_coords[d] / blocksize_d;
+    }
+    // Number of blocks preceeding the coordinates' block, equivalent
+    // to linear global block offset:
+    auto block_index = _blockspec.at(block_coords);
+    auto offset = block_index * _blocksize_spec.size() + // preceed. blocks
+                  _blocksize_spec.at(phase_coords);      // element phase
+    DASH_LOG_TRACE("CurveTilePattern.global_at()",
+                   "gcoords:",  global_coords,
+                   "> offset:", offset);
+    return offset;
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// at
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Global coordinates and viewspec to local index.
+   *
+   * \see  global_at
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType at(
+    const std::array<IndexType, NumDimensions> & global_coords,
+    const ViewSpec_t                           & viewspec) const
+  {
+    std::array<IndexType, NumDimensions> vs_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      vs_coords[d] = global_coords[d] + viewspec.offset(d);
+    }
+    return local_index(vs_coords).index;
+  }
+
+  /**
+   * Global coordinates to local index.
+   *
+   * Convert given global coordinates in pattern to their respective
+   * linear local index.
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType at(
+    std::array<IndexType, NumDimensions> global_coords) const
+  {
+    return local_index(global_coords).index;
+  }
+
+  /**
+   * Global coordinates to local index.
+   *
+   * Convert given coordinate in pattern to its linear local index.
+   *
+   * \see  DashPatternConcept
+   */
+  template<typename ... Values>
+  IndexType at(Values ... values) const
+  {
+    static_assert(
+      sizeof...(values) == NumDimensions,
+      "Wrong parameter number");
+    std::array<IndexType, NumDimensions> inputindex = {
+      (IndexType)values...
+    };
+    return at(inputindex);
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// is_local
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Whether there are local elements in a dimension at a given offset,
+   * e.g. in a specific row or column.
+   *
+   * \see  DashPatternConcept
+   */
+  bool has_local_elements(
+    /// Dimension to check
+    dim_t dim,
+    /// Offset in dimension
+    IndexType dim_offset,
+    /// DART id of the unit
+    team_unit_t unit,
+    /// Viewspec to apply
+    const ViewSpec_t & viewspec) const
+  {
+    // Apply viewspec offset in dimension to given position
+    dim_offset += viewspec[dim].offset;
+    // Offset to block offset
+    IndexType block_coord_d = dim_offset / _blocksize_spec.extent(dim);
+    // Test blocks of the unit, they are not aligned to hyperplanes:
+    auto n_local_blocks = initialize_local_blockspec(unit).size();
+    for (index_type lb = 0;
+         lb < static_cast<index_type>(n_local_blocks); ++lb) {
+      auto g_block_coords = _blockspec.coords(global_block_index(unit, lb));
+      if (static_cast<IndexType>(g_block_coords[dim]) == block_coord_d) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Whether the given global index is local to the specified unit.
+   *
+   * \see  DashPatternConcept
+   */
+  bool is_local(
+    IndexType    index,
+    team_unit_t unit) const
+  {
+    return unit_at(coords(index)) == unit;
+  }
+
+  /**
+   * Whether the given global index is local to the unit that created
+   * this pattern instance.
+   *
+   * \see  DashPatternConcept
+   */
+  bool is_local(
+    IndexType index) const
+  {
+    return is_local(index, _myid);
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// block
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Index of block at given global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  index_type block_at(
+    /// Global coordinates of element
+    const std::array<index_type, NumDimensions> & g_coords) const
+  {
+    std::array<index_type, NumDimensions> block_coords;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      block_coords[d] = g_coords[d] / _blocksize_spec.extent(d);
+    }
+    return _blockspec.at(block_coords);
+  }
+
+  /**
+   * View spec (offset and extents) of block at global linear block index
+   * in global cartesian element space.
+   *
+   * \see  DashPatternConcept
+   */
+  ViewSpec_t block(
+    index_type global_block_index) const
+  {
+    auto g_block_coords = _blockspec.coords(global_block_index);
+    std::array<index_type, NumDimensions> offsets;
+    std::array<size_type, NumDimensions>  extents;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      auto blocksize_d = _blocksize_spec.extent(d);
+      extents[d] = blocksize_d;
+      offsets[d] = g_block_coords[d] * blocksize_d;
+    }
+    auto block_vs = ViewSpec_t(offsets, extents);
+    DASH_LOG_TRACE_VAR("CurveTilePattern.block >", block_vs);
+    return block_vs;
+  }
+
+  /**
+   * View spec (offset and extents) of block at local linear block index in
+   * global cartesian element space.
+   *
+   * \see  DashPatternConcept
+   */
+  ViewSpec_t local_block(
+    index_type local_block_index) const
+  {
+    return local_block(_myid, local_block_index);
+  }
+
+  /**
+   * View spec (offset and extents) of block at local linear block index in
+   * global cartesian element space.
+   *
+   * \see  DashPatternConcept
+   */
+  ViewSpec_t local_block(
+    team_unit_t unit,
+    index_type  local_block_index) const
+  {
+    return block(global_block_index(unit, local_block_index));
+  }
+
+  /**
+   * View spec (offset and extents) of block at local linear block index in
+   * local cartesian element space.
+   *
+   * \see  DashPatternConcept
+   */
+  ViewSpec_t local_block_local(
+    index_type local_block_index) const
+  {
+    // Initialize viewspec result with block extents:
+    std::array<index_type, NumDimensions> offsets;
+    std::array<size_type, NumDimensions>  extents =
+      _blocksize_spec.extents();
+    // Local block index to local block coords:
+    auto l_block_coords = _local_blockspec.coords(local_block_index);
+    // Local block coords to local element offset:
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      offsets[d] = l_block_coords[d] * extents[d];
+    }
+    ViewSpec_t block_vs(offsets, extents);
+    DASH_LOG_TRACE_VAR("CurveTilePattern.local_block_local >", block_vs);
+    return block_vs;
+  }
+
+  /**
+   * Global index of the block at the given position on the space-filling
+   * curve.
+   */
+  index_type curve_block(
+    index_type curve_pos) const
+  {
+    return _curve_blocks[curve_pos];
+  }
+
+  /**
+   * Cartesian arrangement of pattern blocks.
+   */
+  const BlockSpec_t & blockspec() const
+  {
+    return _blockspec;
+  }
+
+  /**
+   * Cartesian arrangement of pattern blocks.
+   */
+  const BlockSpec_t & local_blockspec() const
+  {
+    return _local_blockspec;
+  }
+
+  /**
+   * Cartesian arrangement of pattern blocks.
+   */
+  BlockSpec_t local_blockspec(team_unit_t unit) const
+  {
+    if (unit == _myid) {
+      return local_blockspec();
+    }
+    return initialize_local_blockspec(unit);
+  }
+
+  /**
+   * Maximum number of elements in a single block in the given dimension.
+   *
+   * \return  The blocksize in the given dimension
+   *
+   * \see     DashPatternConcept
+   */
+  SizeType blocksize(
+    /// The dimension in the pattern
+    dim_t dimension) const
+  {
+    return _blocksize_spec.extent(dimension);
+  }
+
+  /**
+   * Maximum number of elements in a single block in all dimensions.
+   *
+   * \return  The maximum number of elements in a single block assigned to
+   *          a unit.
+   *
+   * \see     DashPatternConcept
+   */
+  SizeType max_blocksize() const {
+    return _blocksize_spec.size();
+  }
+
+  /**
+   * Maximum number of elements assigned to a single unit in total,
+   * equivalent to the local capacity of every unit in this pattern.
+   *
+   * \see  DashPatternConcept
+   */
+  SizeType local_capacity() const {
+    return _local_capacity;
+  }
+
+  /**
+   * The actual number of elements in this pattern that are local to the
+   * calling unit in total.
+   *
+   * \see  blocksize()
+   * \see  local_extent()
+   * \see  local_capacity()
+   *
+   * \see  DashPatternConcept
+   */
+  SizeType local_size(team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const {
+    if (unit == UNDEFINED_TEAM_UNIT_ID || unit == _myid) {
+      return _local_memory_layout.size();
+    }
+    // Non-local query, requires to construct local memory layout of
+    // remote unit:
+    return LocalMemoryLayout_t(initialize_local_extents(unit)).size();
+  }
+
+  /**
+   * The number of units to which this pattern's elements are mapped.
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType num_units() const {
+    return _nunits;
+  }
+
+  /**
+   * The maximum number of elements arranged in this pattern.
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType capacity() const {
+    return _memory_layout.size();
+  }
+
+  /**
+   * The number of elements arranged in this pattern.
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType size() const {
+    return _memory_layout.size();
+  }
+
+  /**
+   * The Team containing the units to which this pattern's elements are
+   * mapped.
+   */
+  dash::Team & team() const {
+    return *_team;
+  }
+
+  /**
+   * Distribution specification of this pattern.
+   */
+  const DistributionSpec_t & distspec() const {
+    return _distspec;
+  }
+
+  /**
+   * Size specification of the index space mapped by this pattern.
+   *
+   * \see DashPatternConcept
+   */
+  SizeSpec_t sizespec() const {
+    return SizeSpec_t(_memory_layout.extents());
+  }
+
+  /**
+   * Size specification of the index space mapped by this pattern.
+   *
+   * \see DashPatternConcept
+   */
+  const std::array<SizeType, NumDimensions> & extents() const {
+    return _memory_layout.extents();
+  }
+
+  /**
+   * Cartesian index space representing the underlying memory model of the
+   * pattern.
+   *
+   * \see DashPatternConcept
+   */
+  const MemoryLayout_t & memory_layout() const {
+    return _memory_layout;
+  }
+
+  /**
+   * Cartesian index space representing the underlying local memory model
+   * of this pattern for the calling unit.
+   * Not part of DASH Pattern concept.
+   */
+  const LocalMemoryLayout_t & local_memory_layout() const {
+    return _local_memory_layout;
+  }
+
+  /**
+   * Cartesian arrangement of the Team containing the units to which this
+   * pattern's elements are mapped.
+   *
+   * \see DashPatternConcept
+   */
+  const TeamSpec_t & teamspec() const {
+    return _teamspec;
+  }
+
+  /**
+   * Convert given global linear offset (index) to global cartesian
+   * coordinates.
+   *
+   * \see DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> coords(
+    IndexType index) const {
+    return _memory_layout.coords(index);
+  }
+
+  /**
+   * Memory order followed by the pattern.
+   */
+  constexpr static MemArrange memory_order() {
+    return Arrangement;
+  }
+
+  /**
+   * Number of dimensions of the cartesian space partitioned by the
+   * pattern.
+   */
+  constexpr static dim_t ndim() {
+    return NumDimensions;
+  }
+
+  /**
+   * Space-filling curve ordering the blocks of the pattern.
+   */
+  constexpr static SpaceFillingCurve curve() {
+    return Curve;
+  }
+
+private:
+
+  CurveTilePattern(const PatternArguments_t & arguments)
+  : _distspec(arguments.distspec()),
+    _team(&arguments.team()),
+    _myid(_team->myid()),
+    _teamspec(arguments.teamspec()),
+    _memory_layout(arguments.sizespec().extents()),
+    _nunits(_teamspec.size()),
+    _blocksize_spec(initialize_blocksizespec(
+        arguments.sizespec(),
+        _distspec,
+        _teamspec)),
+    _blockspec(initialize_blockspec(
+        arguments.sizespec(),
+        _blocksize_spec))
+  {
+    initialize_curve();
+  }
+
+  /**
+   * Global index of the block at the given local block index of a unit.
+   */
+  index_type global_block_index(
+    team_unit_t unit,
+    index_type  l_block_index) const
+  {
+    return _curve_blocks[first_curve_block(unit) + l_block_index];
+  }
+
+  /**
+   * Position of the first block of a unit on the curve.
+   * The first <tt>nblocks % nunits</tt> units are assigned one additional
+   * block.
+   */
+  index_type first_curve_block(team_unit_t unit) const
+  {
+    index_type num_blocks  = _blockspec.size();
+    index_type min_blocks  = num_blocks / _nunits;
+    index_type num_overfl  = num_blocks % _nunits;
+    return unit.id * min_blocks + std::min<index_type>(unit.id, num_overfl);
+  }
+
+  /**
+   * Initialize block size specs from memory layout, team spec and
+   * distribution spec.
+   */
+  BlockSizeSpec_t initialize_blocksizespec(
+    const SizeSpec_t         & sizespec,
+    const DistributionSpec_t & distspec,
+    const TeamSpec_t         & teamspec) const {
+    // Extents of a single block:
+    std::array<SizeType, NumDimensions> s_blocks;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      const Distribution & dist = distspec[d];
+      SizeType max_blocksize_d  = dist.max_blocksize_in_range(
+          sizespec.extent(d),  // size of range (extent)
+          teamspec.extent(d)); // number of blocks (units)
+      if (max_blocksize_d == 0 ||
+          sizespec.extent(d) % max_blocksize_d != 0) {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "CurveTilePattern: extent " << sizespec.extent(d) << " " <<
+          "in dimension " << d << " is not a multiple of the block " <<
+          "extent " << max_blocksize_d);
+      }
+      s_blocks[d] = max_blocksize_d;
+    }
+    DASH_LOG_TRACE_VAR("CurveTilePattern.init_blocksizespec >", s_blocks);
+    return BlockSizeSpec_t(s_blocks);
+  }
+
+  /**
+   * Initialize block spec from memory layout and block size spec.
+   */
+  BlockSpec_t initialize_blockspec(
+    const SizeSpec_t         & sizespec,
+    const BlockSizeSpec_t    & blocksizespec) const
+  {
+    // Number of blocks in all dimensions:
+    std::array<SizeType, NumDimensions> n_blocks;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      n_blocks[d] = sizespec.extent(d) / blocksizespec.extent(d);
+    }
+    DASH_LOG_TRACE_VAR("CurveTilePattern.init_blockspec >", n_blocks);
+    return BlockSpec_t(n_blocks);
+  }
+
+  /**
+   * Orders the blocks along the space-filling curve and assigns them to
+   * units, initializes the local memory layout of the active unit.
+   *
+   * The curve passes through the smallest cube of extent \c 2^bits
+   * enclosing the block arrangement, blocks are ranked by their position
+   * on the curve so the sequence of blocks contains no gaps.
+   */
+  void initialize_curve()
+  {
+    const index_type num_blocks = _blockspec.size();
+    // Number of bits per dimension of curve positions:
+    int      bits         = 0;
+    SizeType max_nblocks  = 1;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      max_nblocks = std::max(max_nblocks, _blockspec.extent(d));
+    }
+    while ((SizeType(1) << bits) < max_nblocks) {
+      ++bits;
+    }
+    if (bits * NumDimensions > 64) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "CurveTilePattern: " << max_nblocks << " blocks in " <<
+        NumDimensions << " dimensions exceed the range of curve positions");
+    }
+    std::vector<uint64_t> curve_pos(num_blocks);
+    for (index_type b = 0; b < num_blocks; ++b) {
+      auto b_coords = _blockspec.coords(b);
+      std::array<uint64_t, NumDimensions> c_coords;
+      std::copy(b_coords.begin(), b_coords.end(), c_coords.begin());
+      curve_pos[b] = (Curve == SFC_MORTON)
+                     ? internal::morton_encode<NumDimensions>(c_coords, bits)
+                     : internal::hilbert_encode<NumDimensions>(c_coords,
+                                                               bits);
+    }
+    _curve_blocks.resize(num_blocks);
+    std::iota(_curve_blocks.begin(), _curve_blocks.end(), 0);
+    std::sort(_curve_blocks.begin(), _curve_blocks.end(),
+              [&](index_type a, index_type b) {
+                return curve_pos[a] < curve_pos[b];
+              });
+    // Assign contiguous segments of the curve to units:
+    _block_units.resize(num_blocks);
+    _block_lindex.resize(num_blocks);
+    for (index_type u = 0; u < static_cast<index_type>(_nunits); ++u) {
+      team_unit_t unit(u);
+      auto first = first_curve_block(unit);
+      auto last  = first_curve_block(team_unit_t(u + 1));
+      for (auto pos = first; pos < last; ++pos) {
+        _block_units[_curve_blocks[pos]]  = unit;
+        _block_lindex[_curve_blocks[pos]] = pos - first;
+      }
+    }
+    _local_blockspec     = initialize_local_blockspec(_myid);
+    _local_memory_layout = LocalMemoryLayout_t(
+                             initialize_local_extents(_myid));
+    _local_capacity      = initialize_local_capacity();
+    DASH_LOG_TRACE("CurveTilePattern.init_curve >",
+                   "bits:",          bits,
+                   "blocks:",        num_blocks,
+                   "local blocks:",  _local_blockspec.extents());
+  }
+
+  /**
+   * Initialize local block spec of the given unit, blocks in local memory
+   * are arranged in a one-dimensional sequence.
+   */
+  BlockSpec_t initialize_local_blockspec(
+    team_unit_t unit_id) const
+  {
+    std::array<SizeType, NumDimensions> l_blocks;
+    l_blocks.fill(1);
+    l_blocks[0] = first_curve_block(team_unit_t(unit_id.id + 1)) -
+                  first_curve_block(unit_id);
+    return BlockSpec_t(l_blocks);
+  }
+
+  /**
+   * Max. elements per unit (local capacity), the number of elements in
+   * the local blocks of the first unit.
+   */
+  SizeType initialize_local_capacity() const
+  {
+    auto l_capacity = LocalMemoryLayout_t(
+                        initialize_local_extents(team_unit_t(0))).size();
+    DASH_LOG_TRACE_VAR("CurveTilePattern.init_local_capacity >",
+                       l_capacity);
+    return l_capacity;
+  }
+
+  /**
+   * Initialize pointer to begin and end of local index range.
+   */
+  void initialize_local_range()
+  {
+    auto local_size = _local_memory_layout.size();
+    if (local_size == 0) {
+      _lbegin = 0;
+      _lend   = 0;
+    } else {
+      // First local index transformed to global index
+      _lbegin = global(0);
+      // Index past last local index transformed to global index
+      _lend   = global(local_size - 1) + 1;
+    }
+    DASH_LOG_DEBUG_VAR("CurveTilePattern.init_local_range >", _lbegin);
+    DASH_LOG_DEBUG_VAR("CurveTilePattern.init_local_range >", _lend);
+  }
+
+  /**
+   * Resolve extents of local memory layout for a specified unit.
+   */
+  std::array<SizeType, NumDimensions> initialize_local_extents(
+      team_unit_t unit) const
+  {
+    auto l_blockspec = initialize_local_blockspec(unit);
+    std::array<SizeType, NumDimensions> l_extents;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      l_extents[d] = _blocksize_spec.extent(d) * l_blockspec.extent(d);
+    }
+    DASH_LOG_DEBUG_VAR("CurveTilePattern.init_local_extents >", l_extents);
+    return l_extents;
+  }
+};
+
+template<
+  dim_t             ND,
+  MemArrange        Ar,
+  typename          Index,
+  SpaceFillingCurve Curve>
+std::ostream & operator<<(
+  std::ostream                                  & os,
+  const CurveTilePattern<ND, Ar, Index, Curve>  & pattern)
+{
+  typedef Index index_t;
+
+  dim_t ndim = pattern.ndim();
+
+  std::string storage_order = pattern.memory_order() == ROW_MAJOR
+                              ? "ROW_MAJOR"
+                              : "COL_MAJOR";
+  std::string curve         = pattern.curve() == SFC_MORTON
+                              ? "SFC_MORTON"
+                              : "SFC_HILBERT";
+
+  std::array<index_t, ND> blocksize;
+  for (dim_t d = 0; d < ND; ++d) {
+    blocksize[d] = pattern.blocksize(d);
+  }
+
+  std::ostringstream ss;
+  ss << "dash::"
+     << CurveTilePattern<ND, Ar, Index, Curve>::PatternName
+     << "<"
+     << ndim << ","
+     << storage_order << ","
+     << typeid(index_t).name() << ","
+     << curve
+     << ">"
+     << "("
+     << "SizeSpec:"  << pattern.sizespec().extents()  << ", "
+     << "TeamSpec:"  << pattern.teamspec().extents()  << ", "
+     << "BlockSpec:" << pattern.blockspec().extents() << ", "
+     << "BlockSize:" << blocksize
+     << ")";
+
+  return operator<<(os, ss.str());
+}
+
+} // namespace dash
+
+#endif // DASH__CURVE_TILE_PATTERN_H_
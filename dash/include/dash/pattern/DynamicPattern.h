@@ -3,6 +3,8 @@
 
 #include <functional>
 #include <array>
+#include <algorithm>
+#include <vector>
 #include <type_traits>
 
 #include <dash/Types.h>
@@ -11,11 +13,11 @@
 #include <dash/Dimensional.h>
 #include <dash/Cartesian.h>
 #include <dash/Team.h>
-#include <dash/PatternProperties.h>
+#include <dash/pattern/PatternProperties.h>
+#include <dash/pattern/internal/PatternArguments.h>
 
 #include <dash/internal/Math.h>
 #include <dash/internal/Logging.h>
-#include <dash/internal/PatternArguments.h>
 
 namespace dash {
 
@@ -466,26 +468,49 @@ public:
 
   /**
    * Update the number of local elements of the specified unit.
+   *
+   * Changes the size of the pattern and the global indices mapped to
+   * subsequent units. Local sizes must be updated identically at all
+   * units to obtain a consistent mapping.
    */
   inline void local_resize(team_unit_t unit, size_type local_size)
   {
     _local_sizes[unit] = local_size;
+    update_local_sizes();
   }
 
   /**
    * Update the number of local elements of the active unit.
+   *
+   * \see  local_resize(team_unit_t, size_type)
    */
   inline void local_resize(size_type local_size)
   {
-    _local_sizes[_myid] = local_size;
+    local_resize(_myid, local_size);
   }
 
   /**
    * Balance the number of local elements across all units in the pattern's
    * associated team.
+   *
+   * The pattern size does not change, the first \c size % nunits units
+   * are assigned one element more than the remaining units.
+   * Elements of a container are moved to the balanced distribution by
+   * \c dash::Array::rebalance_async.
    */
   inline void balance()
   {
+    DASH_LOG_TRACE_VAR("DynamicPattern.balance()", _local_sizes);
+    if (_nunits == 0) {
+      return;
+    }
+    auto balanced_lsize = _size / _nunits;
+    auto remainder      = _size % _nunits;
+    for (size_type u = 0; u < _nunits; ++u) {
+      _local_sizes[u] = balanced_lsize + (u < remainder ? 1 : 0);
+    }
+    update_local_sizes();
+    DASH_LOG_TRACE_VAR("DynamicPattern.balance >", _local_sizes);
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -1296,6 +1321,22 @@ private:
     _local_capacity(initialize_local_capacity())
   {}
 
+  /**
+   * Update all properties derived from the local sizes after local sizes
+   * have been modified.
+   */
+  void update_local_sizes()
+  {
+    _size                = initialize_size(_local_sizes);
+    _block_offsets       = initialize_block_offsets(_local_sizes);
+    _memory_layout       = MemoryLayout_t(std::array<SizeType, 1> {{ _size }});
+    _local_size          = initialize_local_extent(_myid);
+    _local_memory_layout = LocalMemoryLayout_t(
+                             std::array<SizeType, 1> {{ _local_size }});
+    _local_capacity      = initialize_local_capacity();
+    initialize_local_range();
+  }
+
   /**
    * Initialize the size (number of mapped elements) of the Pattern.
    */
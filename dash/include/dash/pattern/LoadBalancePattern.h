@@ -3,6 +3,10 @@
 
 #include <functional>
 #include <array>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
 #include <type_traits>
 
 #include <dash/Types.h>
@@ -21,6 +25,8 @@
 #include <dash/internal/Math.h>
 #include <dash/internal/Logging.h>
 
+#include <dash/dart/if/dart_communication.h>
+
 
 namespace dash {
 
@@ -306,7 +312,7 @@ public:
     _local_sizes(
       initialize_local_sizes(
         sizespec.size(),
-        team_loc)),
+        team_loc.team().size())),
     _block_offsets(
       initialize_block_offsets(
         _local_sizes)),
@@ -1104,6 +1110,79 @@ public:
     return _unit_load_weights;
   }
 
+  /**
+   * Replaces the load balance weights of all units by weights derived
+   * from the measured time every unit needed to process its local
+   * elements, and recomputes the local sizes from the new weights.
+   *
+   * Weights derived from hardware properties do not account for effects
+   * like OS noise or contention for shared resources. The new weight of
+   * a unit is proportional to its measured throughput, i.e. its local
+   * size divided by its elapsed time, so units are expected to need
+   * identical time for their local elements in the next iteration.
+   * Units without local elements or without positive elapsed time keep
+   * their previous weight.
+   *
+   * Use \c dash::Array::rebalance to move the elements of an array to
+   * the updated distribution.
+   *
+   * Collective operation.
+   *
+   * \code
+   *   dash::util::Timer<dash::util::TimeMeasure::Clock> timer;
+   *   kernel(array.lbegin(), array.lend());
+   *   auto pattern = array.pattern();
+   *   pattern.update_load_weights(timer.Elapsed());
+   *   array.rebalance(pattern);
+   * \endcode
+   */
+  void update_load_weights(
+    /// Time the calling unit needed to process its local elements, in
+    /// the same unit of time at all units.
+    double local_elapsed)
+  {
+    DASH_LOG_TRACE_VAR("LoadBalancePattern.update_load_weights()",
+                       local_elapsed);
+    std::vector<double> unit_elapsed(_nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&local_elapsed, unit_elapsed.data(), 1,
+                     DART_TYPE_DOUBLE,
+                     _team->dart_id()),
+      DART_OK);
+    std::vector<double> unit_throughput(_nunits, 0.0);
+    double total_throughput = 0;
+    size_type n_measured    = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      if (_local_sizes[u] > 0 && unit_elapsed[u] > 0) {
+        unit_throughput[u] = _local_sizes[u] / unit_elapsed[u];
+        total_throughput  += unit_throughput[u] / _unit_load_weights[u];
+        ++n_measured;
+      }
+    }
+    if (n_measured == 0) {
+      return;
+    }
+    // Throughput per weight of the measured units, used to express the
+    // previous weight of unmeasured units as throughput:
+    double throughput_per_weight = total_throughput / n_measured;
+    for (size_type u = 0; u < _nunits; ++u) {
+      if (unit_throughput[u] <= 0) {
+        unit_throughput[u] = _unit_load_weights[u] * throughput_per_weight;
+      }
+    }
+    dash::math::div_mean(unit_throughput.begin(), unit_throughput.end());
+    _unit_load_weights   = std::move(unit_throughput);
+    _local_sizes         = initialize_local_sizes(_size, _nunits);
+    _block_offsets       = initialize_block_offsets(_local_sizes);
+    _local_size          = initialize_local_extent(_myid, _local_sizes);
+    _local_memory_layout = LocalMemoryLayout_t(
+                             std::array<SizeType, 1> {{ _local_size }});
+    _local_capacity      = initialize_local_capacity(_local_sizes);
+    initialize_local_range();
+    DASH_LOG_TRACE_VAR("LoadBalancePattern.update_load_weights >",
+                       _local_sizes);
+  }
+
 private:
 
   std::vector<double> initialize_load_weights(
@@ -1132,16 +1211,15 @@ private:
   }
 
   /**
-   * Initialize local sizes from pattern size, team and team locality
-   * hierarchy.
+   * Initialize local sizes from pattern size and load balance weights of
+   * the units in the team.
    */
   std::vector<size_type> initialize_local_sizes(
     size_type              total_size,
-    const TeamLocality_t & locality) const
+    size_type              nunits) const
   {
     DASH_LOG_TRACE_VAR("LoadBalancePattern.init_local_sizes()", total_size);
     std::vector<size_type> l_sizes;
-    auto nunits = locality.team().size();
     DASH_LOG_TRACE_VAR("LoadBalancePattern.init_local_sizes()", nunits);
     if (nunits == 1) {
       l_sizes.push_back(total_size);
@@ -1155,27 +1233,29 @@ private:
 
     double balanced_lsize = static_cast<double>(total_size) / nunits;
 
-    size_t      assigned_capacity = 0;
-    // Unit with maximum CPU capacity in team:
-    team_unit_t max_cpu_cap_unit{0};
-
-    // Maximum CPU capacity found:
-    size_t      unit_max_cpu_cap  = 0;
-    for (team_unit_t u{0}; u < nunits; u++) {
-      double weight         = _unit_load_weights[u];
-      size_t unit_capacity  = weight > 1
-                              ? std::ceil(weight * balanced_lsize)
-                              : std::floor(weight * balanced_lsize);
-      if (unit_capacity > unit_max_cpu_cap) {
-        max_cpu_cap_unit = u;
-        unit_max_cpu_cap = unit_capacity;
-      }
+    size_type           assigned_capacity = 0;
+    std::vector<double> unit_remainders;
+    for (size_type u = 0; u < nunits; u++) {
+      double exact_capacity = _unit_load_weights[u] * balanced_lsize;
+      size_type unit_capacity = std::min<size_type>(
+                                  std::floor(exact_capacity),
+                                  total_size - assigned_capacity);
       assigned_capacity += unit_capacity;
       l_sizes.push_back(unit_capacity);
+      unit_remainders.push_back(exact_capacity - unit_capacity);
     }
     // Some elements might be unassigned due to rounding.
-    // Assign them to the unit with highest CPU capacity:
-    l_sizes[max_cpu_cap_unit] += (total_size - assigned_capacity);
+    // Assign them to the units with the largest rounding remainders:
+    std::vector<size_type> units_by_remainder(nunits);
+    std::iota(units_by_remainder.begin(), units_by_remainder.end(), 0);
+    std::stable_sort(units_by_remainder.begin(), units_by_remainder.end(),
+                     [&](size_type a, size_type b) {
+                       return unit_remainders[a] > unit_remainders[b];
+                     });
+    for (size_type r = 0; assigned_capacity < total_size; ++r) {
+      ++l_sizes[units_by_remainder[r % nunits]];
+      ++assigned_capacity;
+    }
 
     DASH_LOG_TRACE_VAR("LoadBalancePattern.init_local_sizes >", l_sizes);
     return l_sizes;
@@ -7,6 +7,7 @@
 #include <dash/pattern/BlockPattern.h>
 #include <dash/pattern/TilePattern.h>
 #include <dash/pattern/ShiftTilePattern.h>
+#include <dash/pattern/CurveTilePattern.h>
 
 #include <dash/util/UnitLocality.h>
 #include <dash/util/TeamLocality.h>
@@ -173,6 +174,10 @@ make_team_spec(
 }
 
 /**
+ * If the configuration flag \c DASH_TEAMSPEC_MAP_NODES is set and the
+ * team spans multiple nodes, units located at the same node are arranged
+ * in compact sub-grids of the team spec, see \c TeamSpec::map_to_nodes.
+ *
  * \ingroup{DashPatternConcept}
  */
 template<
@@ -212,16 +217,25 @@ make_team_spec(
     if (0 >= n_cores) { n_cores = 1; }
   }
 
-  return make_team_spec<
-           PartitioningTags,
-           MappingTags,
-           LayoutTags,
-           SizeSpecType>(
-             sizespec,
-             team.size(),
-             n_nodes,
-             n_numa_dom,
-             n_cores);
+  auto teamspec = make_team_spec<
+                    PartitioningTags,
+                    MappingTags,
+                    LayoutTags,
+                    SizeSpecType>(
+                      sizespec,
+                      team.size(),
+                      n_nodes,
+                      n_numa_dom,
+                      n_cores);
+  // Assign units at the same node to adjacent positions in the team grid
+  // so that most neighboring blocks are located at the same node:
+  if (n_nodes > 1 &&
+      dash::util::Config::get<bool>("DASH_TEAMSPEC_MAP_NODES")) {
+    teamspec.map_to_nodes(team);
+  }
+  DASH_LOG_TRACE("dash::make_team_spec >",
+                 "node mapping:", teamspec.is_node_mapped());
+  return teamspec;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -362,6 +376,7 @@ template<
 >
 typename std::enable_if<
   !MappingTags::diagonal &&
+  !MappingTags::compact &&
   PartitioningTags::rectangular &&
   PartitioningTags::balanced &&
   !PartitioningTags::unbalanced &&
@@ -469,6 +484,68 @@ make_pattern(
   return pattern;
 }
 
+/**
+ * Generic Abstract Factory for models of the Pattern concept.
+ *
+ * Creates an instance of a Pattern model that satisfies the compact
+ * mapping property from given pattern traits.
+ *
+ * \ingroup{DashPatternConcept}
+ *
+ * \returns  An instance of \c dash::CurveTilePattern if the following
+ *           constraints are specified:
+ *           (Mapping:      compact)
+ *           and
+ *           (Layout:       blocked)
+ */
+template<
+  typename PartitioningTags = dash::pattern_partitioning_default_properties,
+  typename MappingTags      = dash::pattern_mapping_default_properties,
+  typename LayoutTags       = dash::pattern_layout_default_properties,
+  class    SizeSpecType,
+  class    TeamSpecType
+>
+typename std::enable_if<
+  MappingTags::compact &&
+  !MappingTags::diagonal &&
+  LayoutTags::blocked,
+  CurveTilePattern<SizeSpecType::ndim::value,
+                   dash::ROW_MAJOR,
+                   typename SizeSpecType::index_type>
+>::type
+make_pattern(
+  /// Size spec of cartesian space to be distributed by the pattern.
+  const SizeSpecType & sizespec,
+  /// Team spec containing layout of units mapped by the pattern.
+  const TeamSpecType & teamspec)
+{
+  // Deduce number of dimensions from size spec:
+  const dim_t ndim = SizeSpecType::ndim::value;
+  // Deduce index type from size spec:
+  typedef typename SizeSpecType::index_type                      index_t;
+  typedef dash::CurveTilePattern<ndim, dash::ROW_MAJOR, index_t> pattern_t;
+  DASH_LOG_TRACE("dash::make_pattern", PartitioningTags());
+  DASH_LOG_TRACE("dash::make_pattern", MappingTags());
+  DASH_LOG_TRACE("dash::make_pattern", LayoutTags());
+  DASH_LOG_TRACE_VAR("dash::make_pattern", sizespec.extents());
+  DASH_LOG_TRACE_VAR("dash::make_pattern", teamspec.extents());
+  // Make distribution spec from template- and run time parameters:
+  auto distspec =
+    make_distribution_spec<
+      PartitioningTags,
+      MappingTags,
+      LayoutTags,
+      SizeSpecType,
+      TeamSpecType
+    >(sizespec,
+      teamspec);
+  // Make pattern from template- and run time parameters:
+  pattern_t pattern(sizespec,
+                    distspec,
+                    teamspec);
+  return pattern;
+}
+
 /**
  * Generic Abstract Factory for models of the Pattern concept.
  *
@@ -273,7 +273,11 @@ struct pattern_mapping_tag
 
     /// Blocks are assigned to processes like dealt from a deck of
     /// cards in every hyperplane, starting from first unit.
-    cyclic
+    cyclic,
+
+    /// Blocks assigned to a unit are consecutive along a space-filling
+    /// curve and thus form a compact region.
+    compact
 
   } type;
 };
@@ -333,6 +337,10 @@ struct pattern_mapping_properties
   /// Blocks are assigned to processes like dealt from a deck of
   /// cards in every hyperplane, starting from first unit.
   static const bool cyclic     = false;
+
+  /// Blocks assigned to a unit are consecutive along a space-filling
+  /// curve and thus form a compact region.
+  static const bool compact    = false;
 };
 
 #ifndef DOXYGEN
@@ -494,6 +502,29 @@ pattern_mapping_properties<
   pattern_mapping_tag::type::cyclic, Tags ...
 >::cyclic = true;
 
+/**
+ * Specialization of \c dash::pattern_mapping_properties to process tag
+ * \c dash::pattern_mapping_tag::type::compact in template parameter list.
+ *
+ * \ingroup{DashPatternMappingProperties}
+ *
+ */
+template<pattern_mapping_tag::type ... Tags>
+struct pattern_mapping_properties<
+         pattern_mapping_tag::type::compact, Tags ...>
+: public pattern_mapping_properties<Tags ...>
+{
+  /// Blocks assigned to a unit are consecutive along a space-filling
+  /// curve and thus form a compact region.
+  static const bool compact;
+};
+
+template<pattern_mapping_tag::type ... Tags>
+const bool
+pattern_mapping_properties<
+  pattern_mapping_tag::type::compact, Tags ...
+>::compact = true;
+
 #endif // DOXYGEN
 
 //////////////////////////////////////////////////////////////////////////////
@@ -866,6 +897,9 @@ bool check_pattern_constraints(
   static_assert(!MappingConstraints::cyclic ||
                 mapping_traits::cyclic,
                 "Pattern does not implement cyclic mapping");
+  static_assert(!MappingConstraints::compact ||
+                mapping_traits::compact,
+                "Pattern does not implement compact mapping");
   // Layout properties:
   //
   static_assert(!LayoutConstraints::blocked ||
@@ -947,6 +981,9 @@ struct pattern_constraints
             ( !MappingConstraints::cyclic ||
               mapping_traits::cyclic )
             &&
+            ( !MappingConstraints::compact ||
+              mapping_traits::compact )
+            &&
             //
             // Layout properties:
             //
@@ -1034,6 +1071,9 @@ std::ostream & operator<<(
   if (traits.cyclic) {
     ss << "cyclic ";
   }
+  if (traits.compact) {
+    ss << "compact ";
+  }
   ss << ">";
   return operator<<(os, ss.str());
 }
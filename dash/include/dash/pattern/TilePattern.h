@@ -144,6 +144,17 @@ private:
   IndexType                   _lbegin;
   /// Corresponding global index past last local index of the active unit
   IndexType                   _lend;
+  /// Divisors of the block extents in all dimensions
+  std::array<math::FastDivisor<IndexType>, NumDimensions> _blocksize_div;
+  /// Divisors of the number of units in all dimensions
+  std::array<math::FastDivisor<IndexType>, NumDimensions> _nunits_div;
+  /// Divisors of the strides of the global memory layout in all
+  /// dimensions
+  std::array<math::FastDivisor<IndexType>, NumDimensions> _stride_div;
+  /// Minimum number of blocks assigned to a unit in all dimensions
+  std::array<IndexType, NumDimensions> _min_local_blocks;
+  /// Number of units assigned an additional block in all dimensions
+  std::array<IndexType, NumDimensions> _num_odd_blocks;
 
 public:
   /**
@@ -194,6 +205,7 @@ public:
   {
     DASH_LOG_TRACE("TilePattern()", "Constructor with Argument list");
     initialize_local_range();
+    initialize_divisors();
   }
 
   /**
@@ -267,6 +279,7 @@ public:
   {
     DASH_LOG_TRACE("TilePattern()", "(sizespec, dist, teamspec, team)");
     initialize_local_range();
+    initialize_divisors();
   }
 
   /**
@@ -336,6 +349,7 @@ public:
   {
     DASH_LOG_TRACE("TilePattern()", "(sizespec, dist, team)");
     initialize_local_range();
+    initialize_divisors();
   }
 
   /**
@@ -431,8 +445,8 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord      = coords[d] + viewspec.offset(d);
       // Global block coordinate:
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
-      unit_ts_coords[d] = block_coords[d] % _teamspec.extent(d);
+      block_coords[d]   = _blocksize_div[d].divide(vs_coord);
+      unit_ts_coords[d] = _nunits_div[d].modulo(block_coords[d]);
     }
     team_unit_t unit_id(_teamspec.at(unit_ts_coords));
     DASH_LOG_TRACE_VAR("TilePattern.unit_at", block_coords);
@@ -457,8 +471,8 @@ public:
     // e.g (x + y + z) % nunits
     for (auto d = 0; d < NumDimensions; ++d) {
       // Global block coordinate:
-      block_coords[d]   = coords[d] / _blocksize_spec.extent(d);
-      unit_ts_coords[d] = block_coords[d] % _teamspec.extent(d);
+      block_coords[d]   = _blocksize_div[d].divide(coords[d]);
+      unit_ts_coords[d] = _nunits_div[d].modulo(block_coords[d]);
     }
     team_unit_t unit_id(_teamspec.at(unit_ts_coords));
     DASH_LOG_TRACE_VAR("TilePattern.unit_at", block_coords);
@@ -478,7 +492,7 @@ public:
     /// View to apply global position
     const ViewSpec_t & viewspec) const
   {
-    auto global_coords = _memory_layout.coords(global_pos);
+    auto global_coords = coords_fast(global_pos);
     return unit_at(global_coords, viewspec);
   }
 
@@ -491,7 +505,7 @@ public:
     /// Global linear element offset
     IndexType global_pos) const
   {
-    auto global_coords = _memory_layout.coords(global_pos);
+    auto global_coords = coords_fast(global_pos);
     return unit_at(global_coords);
   }
 
@@ -664,13 +678,12 @@ public:
     std::array<IndexType, NumDimensions> local_coords;
     std::array<IndexType, NumDimensions> unit_ts_coords;
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d        = _teamspec.extent(d);
-      auto blocksize_d     = _blocksize_spec.extent(d);
-      auto block_coord_d   = global_coords[d] / blocksize_d;
-      auto phase_d         = global_coords[d] % blocksize_d;
-      auto l_block_coord_d = block_coord_d / nunits_d;
-      unit_ts_coords[d]    = block_coord_d % nunits_d;
-      local_coords[d]      = (l_block_coord_d * blocksize_d) + phase_d;
+      IndexType block_coord_d, phase_d, l_block_coord_d;
+      _blocksize_div[d].divmod(global_coords[d], block_coord_d, phase_d);
+      _nunits_div[d].divmod(block_coord_d, l_block_coord_d,
+                            unit_ts_coords[d]);
+      local_coords[d]      = (l_block_coord_d *
+                              _blocksize_spec.extent(d)) + phase_d;
     }
     l_coords.unit   = _teamspec.at(unit_ts_coords);
     l_coords.coords = local_coords;
@@ -681,16 +694,12 @@ public:
    * Converts global index to its associated unit and respective local
    * index.
    *
-   * TODO: Unoptimized
-   *
    * \see  DashPatternConcept
    */
-  constexpr local_index_t local(
+  local_index_t local(
     IndexType g_index) const
   {
-    // TODO: Implement dedicated method for this, conversion to/from
-    //       global coordinates is expensive.
-    return local_index(coords(g_index));
+    return local_index(coords_fast(g_index));
   }
 
   /**
@@ -704,12 +713,11 @@ public:
   {
     std::array<IndexType, NumDimensions> local_coords;
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d        = _teamspec.extent(d);
-      auto blocksize_d     = _blocksize_spec.extent(d);
-      auto block_coord_d   = global_coords[d] / blocksize_d;
-      auto phase_d         = global_coords[d] % blocksize_d;
-      auto l_block_coord_d = block_coord_d / nunits_d;
-      local_coords[d]      = (l_block_coord_d * blocksize_d) + phase_d;
+      IndexType block_coord_d, phase_d;
+      _blocksize_div[d].divmod(global_coords[d], block_coord_d, phase_d);
+      auto l_block_coord_d = _nunits_div[d].divide(block_coord_d);
+      local_coords[d]      = (l_block_coord_d *
+                              _blocksize_spec.extent(d)) + phase_d;
     }
     return local_coords;
   }
@@ -723,47 +731,32 @@ public:
     const std::array<IndexType, NumDimensions> & global_coords) const
   {
     DASH_LOG_TRACE_VAR("TilePattern.local_index()", global_coords);
-    // Global coordinates to unit and local offset:
-    auto       l_pos_coords  = local(global_coords);
-    auto       l_coords      = l_pos_coords.coords;
-    auto       unit          = l_pos_coords.unit;
-    index_type l_index       = -1;
-    DASH_LOG_TRACE_VAR("TilePattern.local_index", l_coords);
-    DASH_LOG_TRACE_VAR("TilePattern.local_index", unit);
-
-    if (unit == _myid) {
-      // Local coords to local offset:
-      l_index = local_at(l_coords);
-    } else {
-      // Global coordinates point to remote location, requires to construct
-      // _local_blockspec of remote unit:
-      auto remote_l_blockspec = initialize_local_blockspec(
-                                  _blockspec, _blocksize_spec, _teamspec,
-                                  unit);
-
-      // Phase coordinates of element:
-      std::array<IndexType, NumDimensions> phase_coords;
-      // Coordinates of the local block containing the element:
-      std::array<IndexType, NumDimensions> block_coords_l;
-      for (auto d = 0; d < NumDimensions; ++d) {
-        auto gcoord_d     = l_coords[d];
-        auto block_size_d = _blocksize_spec.extent(d);
-        phase_coords[d]   = gcoord_d % block_size_d;
-        block_coords_l[d] = gcoord_d / block_size_d;
-      }
-      DASH_LOG_TRACE("TilePattern.local_index",
-                     "local_coords:",       l_coords,
-                     "local blocks:",       remote_l_blockspec.extents(),
-                     "local block coords:", block_coords_l,
-                     "block size:",         _blocksize_spec.extents(),
-                     "phase coords:",       phase_coords);
-      // Number of blocks preceeding the coordinates' block:
-      auto block_offset_l = remote_l_blockspec.at(block_coords_l);
-      l_index = block_offset_l * _blocksize_spec.size() + // prec. blocks
-                _blocksize_spec.at(phase_coords);         // elem. phase
+    std::array<IndexType, NumDimensions> unit_ts_coords;
+    // Offset of the element's block in the unit's local blocks and of the
+    // element in its block, accumulated in memory order.
+    // The number of local blocks of the unit is derived from its team
+    // coordinates, so remote units do not require their local block
+    // spec:
+    IndexType block_offset_l = 0;
+    IndexType phase_offset   = 0;
+    for (dim_t i = 0; i < NumDimensions; ++i) {
+      const dim_t d = (Arrangement == ROW_MAJOR)
+                      ? i
+                      : NumDimensions - 1 - i;
+      IndexType block_coord_d, phase_d, l_block_coord_d;
+      _blocksize_div[d].divmod(global_coords[d], block_coord_d, phase_d);
+      _nunits_div[d].divmod(block_coord_d, l_block_coord_d,
+                            unit_ts_coords[d]);
+      auto num_l_blocks_d = _min_local_blocks[d] +
+                            (unit_ts_coords[d] < _num_odd_blocks[d] ? 1 : 0);
+      block_offset_l = block_offset_l * num_l_blocks_d + l_block_coord_d;
+      phase_offset   = phase_offset * _blocksize_spec.extent(d) + phase_d;
     }
-    DASH_LOG_TRACE_VAR("TilePattern.local_index >", l_index);
-
+    team_unit_t unit(_teamspec.at(unit_ts_coords));
+    index_type  l_index = block_offset_l * _blocksize_spec.size() +
+                          phase_offset;
+    DASH_LOG_TRACE("TilePattern.local_index >",
+                   "unit:", unit, "l_index:", l_index);
     return local_index_t { unit, l_index };
   }
 
@@ -1471,9 +1464,9 @@ public:
    *
    * \see DashPatternConcept
    */
-  constexpr std::array<IndexType, NumDimensions> coords(
+  std::array<IndexType, NumDimensions> coords(
     IndexType index) const {
-    return _memory_layout.coords(index);
+    return coords_fast(index);
   }
 
   /**
@@ -1518,6 +1511,49 @@ private:
         initialize_local_capacity(_local_memory_layout))
   {}
 
+  /**
+   * Global coordinates of the given global index, using the precomputed
+   * divisors of the memory layout's strides.
+   */
+  std::array<IndexType, NumDimensions> coords_fast(
+    IndexType index) const
+  {
+    std::array<IndexType, NumDimensions> pos;
+    IndexType rem = index;
+    for (dim_t i = 0; i < NumDimensions; ++i) {
+      const dim_t d = (Arrangement == ROW_MAJOR)
+                      ? i
+                      : NumDimensions - 1 - i;
+      _stride_div[d].divmod(rem, pos[d], rem);
+    }
+    return pos;
+  }
+
+  /**
+   * Precompute divisors of the block extents, team extents and memory
+   * layout strides used in the mapping of global indices.
+   */
+  void initialize_divisors()
+  {
+    IndexType stride = 1;
+    for (dim_t i = 0; i < NumDimensions; ++i) {
+      const dim_t d = (Arrangement == ROW_MAJOR)
+                      ? NumDimensions - 1 - i
+                      : i;
+      _stride_div[d] = math::FastDivisor<IndexType>(stride);
+      stride        *= _memory_layout.extent(d);
+    }
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      IndexType nunits_d  = _teamspec.extent(d);
+      IndexType nblocks_d = _blockspec.extent(d);
+      _blocksize_div[d] = math::FastDivisor<IndexType>(
+                            _blocksize_spec.extent(d));
+      _nunits_div[d]    = math::FastDivisor<IndexType>(nunits_d);
+      _min_local_blocks[d] = nunits_d > 0 ? nblocks_d / nunits_d : 0;
+      _num_odd_blocks[d]   = nunits_d > 0 ? nblocks_d % nunits_d : 0;
+    }
+  }
+
   /**
    * Initialize block size specs from memory layout, team spec and
    * distribution spec.
@@ -0,0 +1,180 @@
+#ifndef DASH__INTERNAL__SPACE_FILLING_CURVE_H_
+#define DASH__INTERNAL__SPACE_FILLING_CURVE_H_
+
+#include <dash/Types.h>
+
+#include <array>
+#include <cstdint>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace dash {
+namespace internal {
+
+/**
+ * Mask of the bits of dimension \c d in a Morton code of \c NumDimensions
+ * dimensions.
+ *
+ * Bits of all dimensions are interleaved in groups of \c NumDimensions
+ * bits, with dimension 0 in the most significant position of every group.
+ */
+template<dim_t NumDimensions>
+constexpr uint64_t morton_mask(dim_t d)
+{
+  uint64_t mask = 0;
+  for (int bit = 0; bit < 64 / NumDimensions; ++bit) {
+    mask |= uint64_t(1) << (bit * NumDimensions + (NumDimensions - 1 - d));
+  }
+  return mask;
+}
+
+/**
+ * Position of the given coordinates on the Morton (Z-order) curve through
+ * a cartesian space with extent \c 2^bits in every dimension.
+ *
+ * Uses a single \c pdep instruction per dimension if BMI2 is available.
+ */
+template<dim_t NumDimensions>
+inline uint64_t morton_encode(
+  const std::array<uint64_t, NumDimensions> & coords,
+  int                                         bits)
+{
+  uint64_t code = 0;
+#if defined(__BMI2__)
+  (void)(bits);
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    code |= _pdep_u64(coords[d], morton_mask<NumDimensions>(d));
+  }
+#else
+  for (int bit = 0; bit < bits; ++bit) {
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      code |= ((coords[d] >> bit) & 1) <<
+              (bit * NumDimensions + (NumDimensions - 1 - d));
+    }
+  }
+#endif
+  return code;
+}
+
+/**
+ * Coordinates at the given position on the Morton (Z-order) curve through
+ * a cartesian space with extent \c 2^bits in every dimension.
+ *
+ * Uses a single \c pext instruction per dimension if BMI2 is available.
+ */
+template<dim_t NumDimensions>
+inline std::array<uint64_t, NumDimensions> morton_decode(
+  uint64_t code,
+  int      bits)
+{
+  std::array<uint64_t, NumDimensions> coords;
+#if defined(__BMI2__)
+  (void)(bits);
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    coords[d] = _pext_u64(code, morton_mask<NumDimensions>(d));
+  }
+#else
+  coords.fill(0);
+  for (int bit = 0; bit < bits; ++bit) {
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      coords[d] |= ((code >> (bit * NumDimensions +
+                              (NumDimensions - 1 - d))) & 1) << bit;
+    }
+  }
+#endif
+  return coords;
+}
+
+/**
+ * Position of the given coordinates on the Hilbert curve through a
+ * cartesian space with extent \c 2^bits in every dimension.
+ *
+ * Coordinates are transformed to the transposed Hilbert index in
+ * \c O(bits * NumDimensions) bitwise operations as described by
+ * J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004),
+ * the transposed index is then interleaved like a Morton code.
+ */
+template<dim_t NumDimensions>
+inline uint64_t hilbert_encode(
+  std::array<uint64_t, NumDimensions> coords,
+  int                                 bits)
+{
+  if (bits <= 0) {
+    return 0;
+  }
+  const uint64_t m = uint64_t(1) << (bits - 1);
+  // Inverse undo:
+  for (uint64_t q = m; q > 1; q >>= 1) {
+    const uint64_t p = q - 1;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      if (coords[d] & q) {
+        // Invert:
+        coords[0] ^= p;
+      } else {
+        // Exchange:
+        const uint64_t t = (coords[0] ^ coords[d]) & p;
+        coords[0] ^= t;
+        coords[d] ^= t;
+      }
+    }
+  }
+  // Gray encode:
+  for (dim_t d = 1; d < NumDimensions; ++d) {
+    coords[d] ^= coords[d - 1];
+  }
+  uint64_t t = 0;
+  for (uint64_t q = m; q > 1; q >>= 1) {
+    if (coords[NumDimensions - 1] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    coords[d] ^= t;
+  }
+  return morton_encode<NumDimensions>(coords, bits);
+}
+
+/**
+ * Coordinates at the given position on the Hilbert curve through a
+ * cartesian space with extent \c 2^bits in every dimension.
+ *
+ * Inverse of \c hilbert_encode.
+ */
+template<dim_t NumDimensions>
+inline std::array<uint64_t, NumDimensions> hilbert_decode(
+  uint64_t code,
+  int      bits)
+{
+  auto coords = morton_decode<NumDimensions>(code, bits);
+  if (bits <= 0) {
+    return coords;
+  }
+  const uint64_t n = uint64_t(2) << (bits - 1);
+  // Gray decode:
+  uint64_t t = coords[NumDimensions - 1] >> 1;
+  for (dim_t d = NumDimensions - 1; d > 0; --d) {
+    coords[d] ^= coords[d - 1];
+  }
+  coords[0] ^= t;
+  // Undo excess work:
+  for (uint64_t q = 2; q != n; q <<= 1) {
+    const uint64_t p = q - 1;
+    for (dim_t d = NumDimensions - 1; d >= 0; --d) {
+      if (coords[d] & q) {
+        coords[0] ^= p;
+      } else {
+        t = (coords[0] ^ coords[d]) & p;
+        coords[0] ^= t;
+        coords[d] ^= t;
+      }
+    }
+  }
+  return coords;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__INTERNAL__SPACE_FILLING_CURVE_H_
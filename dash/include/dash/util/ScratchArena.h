@@ -0,0 +1,280 @@
+#ifndef DASH__UTIL__SCRATCH_ARENA_H__
+#define DASH__UTIL__SCRATCH_ARENA_H__
+
+#include <dash/internal/Config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <limits>
+
+
+namespace dash {
+namespace util {
+
+/**
+ * Bump allocator for short-lived local buffers, such as temporary result
+ * arrays and handle lists in algorithms.
+ *
+ * Every thread of a unit owns a separate arena instance which is obtained
+ * from \c ScratchArena::local().
+ * Memory is requested from the arena's current block by advancing an
+ * offset and released in LIFO order by resetting the arena to a marker,
+ * typically using \c ScratchArena::Scope.
+ * Blocks are retained after reset so repeated calls of an algorithm do
+ * not allocate from the heap once the arena has grown to its working set.
+ *
+ * Example:
+ *
+ * \code
+ *   auto & arena = dash::util::ScratchArena::local();
+ *   dash::util::ScratchArena::Scope scope(arena);
+ *   double * buf = arena.allocate<double>(nelem);
+ *   // ...
+ *   // buffer is released at end of scope
+ * \endcode
+ *
+ * Memory obtained from the arena must not outlive the scope in which it
+ * has been allocated, in particular it must not be referenced by
+ * asynchronous operations that complete after the scope has been left.
+ */
+class ScratchArena
+{
+private:
+  typedef ScratchArena self_t;
+
+  struct block_t {
+    std::unique_ptr<char[]> data;
+    size_t                  size;
+  };
+
+public:
+  /**
+   * Position in the arena's allocation sequence, used to release all
+   * allocations that have been requested after the marker was obtained.
+   */
+  struct marker_t {
+    size_t block;
+    size_t offset;
+  };
+
+  /**
+   * Resets the arena to the marker obtained at construction when going
+   * out of scope.
+   * If \c shrink is set, blocks added to the arena within the scope are
+   * freed, for scopes with large allocations that should not be retained.
+   */
+  class Scope
+  {
+  public:
+    explicit Scope(ScratchArena & arena, bool shrink = false)
+    : _arena(arena),
+      _marker(arena.marker()),
+      _nblocks(arena.num_blocks()),
+      _shrink(shrink)
+    { }
+
+    Scope() = delete;
+    Scope(const Scope & other) = delete;
+    Scope & operator=(const Scope & other) = delete;
+
+    ~Scope()
+    {
+      _arena.reset(_marker);
+      if (_shrink) {
+        _arena.shrink(_nblocks);
+      }
+    }
+
+  private:
+    ScratchArena & _arena;
+    marker_t       _marker;
+    size_t         _nblocks;
+    bool           _shrink;
+  };
+
+public:
+  /**
+   * Size of arena blocks in bytes if not specified at construction.
+   */
+  static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+  /**
+   * Alignment of allocations if not specified explicitly.
+   */
+  static constexpr size_t DefaultAlignment = alignof(std::max_align_t);
+
+public:
+  /**
+   * Arena instance of the calling thread.
+   */
+  static self_t & local();
+
+public:
+  explicit ScratchArena(size_t block_size = DefaultBlockSize)
+  : _block_size(block_size)
+  { }
+
+  ScratchArena(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Allocates \c nbytes of uninitialized memory with the given alignment.
+   * Alignment must be a power of two.
+   *
+   * \complexity  O(1), amortized
+   */
+  void * allocate(
+    size_t nbytes,
+    size_t alignment = DefaultAlignment);
+
+  /**
+   * Allocates uninitialized memory for \c nelem elements of type
+   * \c ValueType.
+   */
+  template <typename ValueType>
+  inline ValueType * allocate(
+    size_t nelem,
+    size_t alignment = alignof(ValueType))
+  {
+    return static_cast<ValueType *>(
+             allocate(nelem * sizeof(ValueType), alignment));
+  }
+
+  /**
+   * Current position in the arena's allocation sequence.
+   */
+  inline marker_t marker() const noexcept
+  {
+    return marker_t { _cur_block, _cur_offset };
+  }
+
+  /**
+   * Releases all allocations requested after the given marker has been
+   * obtained. Blocks are retained for subsequent allocations.
+   */
+  inline void reset(const marker_t & m) noexcept
+  {
+    _cur_block  = m.block;
+    _cur_offset = m.offset;
+  }
+
+  /**
+   * Releases all allocations. Blocks are retained for subsequent
+   * allocations.
+   */
+  inline void reset() noexcept
+  {
+    reset(marker_t { 0, 0 });
+  }
+
+  /**
+   * Frees all blocks that do not contain allocations, except for the
+   * first \c nblocks blocks. Allocations are not released.
+   */
+  void shrink(size_t nblocks = 0) noexcept;
+
+  /**
+   * Releases all allocations and frees all blocks owned by the arena.
+   */
+  void release() noexcept;
+
+  /**
+   * Number of blocks owned by the arena.
+   */
+  inline size_t num_blocks() const noexcept
+  {
+    return _blocks.size();
+  }
+
+  /**
+   * Number of bytes in all blocks owned by the arena.
+   */
+  size_t capacity() const noexcept;
+
+  /**
+   * Number of bytes allocated from the arena since the last reset,
+   * including padding for alignment.
+   */
+  size_t size() const noexcept;
+
+private:
+  size_t               _block_size;
+  /// Blocks owned by the arena, blocks at index > _cur_block are unused.
+  std::vector<block_t> _blocks;
+  /// Index of the block allocations are currently served from.
+  size_t               _cur_block  = 0;
+  /// Offset of the next allocation in the current block.
+  size_t               _cur_offset = 0;
+
+}; // class ScratchArena
+
+/**
+ * Allocator concept adapter of \c dash::util::ScratchArena for use with
+ * standard containers like
+ * \c std::vector<T, dash::util::ScratchAllocator<T>>.
+ *
+ * Deallocation is a no-op, memory is released when the arena is reset.
+ */
+template <typename ValueType>
+class ScratchAllocator
+{
+  template <typename U>
+  friend class ScratchAllocator;
+
+public:
+  typedef ValueType        value_type;
+  typedef value_type     * pointer;
+  typedef const ValueType* const_pointer;
+  typedef size_t           size_type;
+  typedef std::ptrdiff_t   difference_type;
+
+  template <typename U>
+  struct rebind {
+    typedef ScratchAllocator<U> other;
+  };
+
+public:
+  ScratchAllocator() noexcept
+  : _arena(&ScratchArena::local())
+  { }
+
+  explicit ScratchAllocator(ScratchArena & arena) noexcept
+  : _arena(&arena)
+  { }
+
+  template <typename U>
+  ScratchAllocator(const ScratchAllocator<U> & other) noexcept
+  : _arena(other._arena)
+  { }
+
+  inline pointer allocate(size_type n)
+  {
+    return _arena->allocate<value_type>(n);
+  }
+
+  inline void deallocate(pointer, size_type) noexcept
+  { }
+
+  template <typename U>
+  inline bool operator==(const ScratchAllocator<U> & rhs) const noexcept
+  {
+    return _arena == rhs._arena;
+  }
+
+  template <typename U>
+  inline bool operator!=(const ScratchAllocator<U> & rhs) const noexcept
+  {
+    return !(*this == rhs);
+  }
+
+private:
+  ScratchArena * _arena;
+
+}; // class ScratchAllocator
+
+} // namespace util
+} // namespace dash
+
+#endif // DASH__UTIL__SCRATCH_ARENA_H__
@@ -0,0 +1,211 @@
+#ifndef DASH__VIEW__CACHED_H__INCLUDED
+#define DASH__VIEW__CACHED_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Range.h>
+
+#include <dash/view/IndexSet.h>
+#include <dash/view/Local.h>
+#include <dash/view/Origin.h>
+#include <dash/view/ViewTraits.h>
+#include <dash/view/ViewIterator.h>
+
+#include <type_traits>
+
+
+namespace dash {
+
+#ifndef DOXYGEN
+
+namespace detail {
+
+/**
+ * Whether indices of a view refer to local elements of a global origin,
+ * like in \c local(sub(array)).
+ */
+template <class ViewType>
+struct cached_view_local_image
+: public std::integral_constant<bool,
+    ( dash::view_traits<ViewType>::is_local::value &&
+     !dash::view_traits<
+        typename dash::view_traits<ViewType>::domain_type
+      >::is_local::value ) >
+{ };
+
+template <class ViewType>
+constexpr auto
+cached_view_origin(const ViewType & view, std::false_type)
+  -> decltype(dash::origin(view)) {
+  return dash::origin(view);
+}
+
+template <class ViewType>
+constexpr auto
+cached_view_origin(const ViewType & view, std::true_type)
+  -> decltype(dash::local(dash::origin(view))) {
+  return dash::local(dash::origin(view));
+}
+
+} // namespace detail
+
+/**
+ * View on the elements of another view with the view's index set
+ * evaluated once in flat canonical form.
+ *
+ * Iterators of composed views like \c sub(local(sub(...))) resolve the
+ * index of every element through all layers of the view. Iterators of a
+ * cached view resolve indices in the cached index set instead.
+ * The cached view remains valid as long as the view's origin is not
+ * reallocated or redistributed.
+ *
+ * Caching is opt-in: views returned by \c dash::sub, \c dash::local and
+ * other view modifiers are not cached, and algorithms do not evaluate
+ * their index sets in advance.
+ *
+ * \see  dash::IndexSetCached
+ *
+ * \concept{DashViewConcept}
+ */
+template <class ViewType>
+class CachedView
+{
+  typedef CachedView<ViewType>                                      self_t;
+
+  typedef detail::cached_view_local_image<ViewType>            image_tag_t;
+
+ public:
+  typedef ViewType                                             domain_type;
+  typedef typename std::decay<
+            decltype(detail::cached_view_origin(
+                       std::declval<const ViewType &>(),
+                       image_tag_t()))
+          >::type                                              origin_type;
+
+  typedef typename view_traits<ViewType>::index_type            index_type;
+  typedef typename view_traits<ViewType>::size_type              size_type;
+
+  typedef IndexSetCached<
+            typename std::decay<
+              decltype(dash::index(std::declval<const ViewType &>()))
+            >::type >                                       index_set_type;
+
+  typedef decltype(
+            dash::begin(
+              std::declval<
+                typename std::add_lvalue_reference<origin_type>::type
+              >() ))
+    origin_iterator;
+
+  typedef decltype(
+            dash::begin(
+              std::declval<
+                typename std::add_lvalue_reference<const origin_type>::type
+              >() ))
+    const_origin_iterator;
+
+  typedef ViewIterator<origin_iterator, index_set_type>           iterator;
+  typedef ViewIterator<const_origin_iterator, index_set_type>
+    const_iterator;
+
+  typedef typename std::iterator_traits<iterator>::reference     reference;
+  typedef typename std::iterator_traits<const_iterator>::reference
+    const_reference;
+
+  typedef typename view_traits<ViewType>::rank                        rank;
+
+ private:
+  domain_type    _domain;
+  index_set_type _index_set;
+
+ public:
+  CachedView()                         = delete;
+  CachedView(self_t &&)                = default;
+  CachedView(const self_t &)           = default;
+  ~CachedView()                        = default;
+  self_t & operator=(self_t &&)        = default;
+  self_t & operator=(const self_t &)   = default;
+
+  /**
+   * Creates a cached view on the given view, evaluates the view's index
+   * set.
+   */
+  explicit CachedView(const domain_type & domain)
+  : _domain(domain)
+  , _index_set(dash::index(_domain))
+  { }
+
+  constexpr const domain_type & domain() const {
+    return _domain;
+  }
+
+  constexpr const origin_type & origin() const {
+    return detail::cached_view_origin(_domain, image_tag_t());
+  }
+
+  constexpr size_type size() const {
+    return _index_set.size();
+  }
+
+  constexpr const_iterator begin() const {
+    return const_iterator(dash::begin(origin()), _index_set, 0);
+  }
+
+  iterator begin() {
+    return iterator(
+             dash::begin(const_cast<origin_type &>(origin())),
+             _index_set, 0);
+  }
+
+  constexpr const_iterator end() const {
+    return const_iterator(dash::begin(origin()), _index_set, size());
+  }
+
+  iterator end() {
+    return iterator(
+             dash::begin(const_cast<origin_type &>(origin())),
+             _index_set, size());
+  }
+
+  constexpr const_reference operator[](index_type offset) const {
+    return *(begin() + offset);
+  }
+
+  reference operator[](index_type offset) {
+    return *(begin() + offset);
+  }
+
+  /**
+   * The cached index set, provides the contiguous index ranges of the
+   * view for algorithms operating on ranges instead of single elements.
+   */
+  constexpr const index_set_type & index_set() const {
+    return _index_set;
+  }
+};
+
+/**
+ * Evaluates the index set of the given view once and returns a view on
+ * the same elements that resolves element indices in the evaluated index
+ * set.
+ *
+ * \code
+ *   auto view = dash::cached(
+ *                 dash::sub(1, n - 1,
+ *                   dash::local(
+ *                     dash::sub(b, e, array))));
+ *   for (auto & value : view) { ... }
+ * \endcode
+ *
+ * \concept{DashViewConcept}
+ */
+template <class ViewType>
+CachedView<ViewType>
+cached(const ViewType & view) {
+  return CachedView<ViewType>(view);
+}
+
+#endif // DOXYGEN
+
+} // namespace dash
+
+#endif // DASH__VIEW__CACHED_H__INCLUDED
@@ -19,7 +19,9 @@
 
 #include <dash/iterator/internal/IteratorBase.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 
 #ifndef DOXYGEN
@@ -1440,6 +1442,158 @@ class IndexSetBlock
 }; // class IndexSetBlock
 #endif
 
+// -----------------------------------------------------------------------
+// IndexSetCached
+// -----------------------------------------------------------------------
+
+/**
+ * Index set containing the indices of another index set in flat canonical
+ * form, evaluated once on construction.
+ *
+ * Composed index sets like \c dash::index(sub(local(sub(...)))) resolve
+ * every index through all layers of their domain. A cached index set
+ * stores the indices as a sequence of contiguous index ranges and, if all
+ * ranges have identical size and their offsets identical distance, as an
+ * affine descriptor so indices are resolved in O(1).
+ * Otherwise, indices are resolved by binary search in the ranges.
+ *
+ * Copies of a cached index set share the evaluated ranges.
+ *
+ * Cached index sets are only used by views created with
+ * \c dash::cached. Other views, their iterators and algorithms operating
+ * on them still resolve indices through the composed index sets.
+ *
+ * \concept{DashRangeConcept}
+ */
+template <class IndexSetType>
+class IndexSetCached
+{
+  typedef IndexSetCached<IndexSetType> self_t;
+
+ public:
+  typedef typename IndexSetType::index_type               index_type;
+  typedef typename IndexSetType::size_type                 size_type;
+  typedef index_type                                      value_type;
+  typedef detail::IndexSetIterator<self_t>                  iterator;
+  typedef detail::IndexSetIterator<self_t>            const_iterator;
+
+  /// Contiguous range of indices, \c begin is the position of the first
+  /// index of the range in the index set.
+  typedef struct {
+    index_type first;
+    index_type size;
+    index_type begin;
+  } index_range_t;
+
+ private:
+  struct cache_t {
+    std::vector<index_range_t> ranges;
+    size_type                  size         = 0;
+    /// Size of all ranges if the index set is affine, 0 otherwise.
+    index_type                 affine_size  = 0;
+    /// Distance of first indices of subsequent ranges if the index set
+    /// is affine.
+    index_type                 affine_step  = 0;
+  };
+
+  std::shared_ptr<const cache_t> _cache;
+
+ public:
+  constexpr IndexSetCached()               = delete;
+  constexpr IndexSetCached(self_t &&)      = default;
+  constexpr IndexSetCached(const self_t &) = default;
+  ~IndexSetCached()                        = default;
+  self_t & operator=(self_t &&)            = default;
+  self_t & operator=(const self_t &)       = default;
+
+  /**
+   * Creates a cached index set from the indices of the given index set.
+   */
+  explicit IndexSetCached(const IndexSetType & index_set)
+  : _cache(evaluate(index_set))
+  { }
+
+  constexpr size_type size() const noexcept {
+    return _cache->size;
+  }
+
+  /**
+   * Contiguous index ranges in the index set.
+   */
+  constexpr const std::vector<index_range_t> & ranges() const noexcept {
+    return _cache->ranges;
+  }
+
+  constexpr bool is_affine() const noexcept {
+    return _cache->affine_size > 0;
+  }
+
+  index_type operator[](index_type image_index) const {
+    const auto & cache = *_cache;
+    if (cache.affine_size > 0) {
+      return cache.ranges.front().first
+             + (image_index / cache.affine_size) * cache.affine_step
+             + (image_index % cache.affine_size);
+    }
+    auto range = std::upper_bound(
+                   cache.ranges.begin(), cache.ranges.end(), image_index,
+                   [](index_type idx, const index_range_t & r) {
+                     return idx < r.begin;
+                   });
+    --range;
+    return range->first + (image_index - range->begin);
+  }
+
+  constexpr const_iterator begin() const {
+    return iterator(*this, 0);
+  }
+
+  constexpr const_iterator end() const {
+    return iterator(*this, size());
+  }
+
+  constexpr index_type first() const {
+    return (*this)[0];
+  }
+
+  constexpr index_type last() const {
+    return (*this)[size() - 1];
+  }
+
+ private:
+  static std::shared_ptr<const cache_t> evaluate(
+    const IndexSetType & index_set)
+  {
+    std::shared_ptr<cache_t> cache = std::make_shared<cache_t>();
+    cache->size = index_set.size();
+    auto & ranges = cache->ranges;
+    for (index_type i = 0; i < static_cast<index_type>(cache->size); ++i) {
+      index_type idx = index_set[i];
+      if (!ranges.empty() &&
+          ranges.back().first + ranges.back().size == idx) {
+        ++ranges.back().size;
+      } else {
+        ranges.push_back(index_range_t { idx, 1, i });
+      }
+    }
+    if (!ranges.empty()) {
+      bool affine = true;
+      index_type step = ranges.size() > 1
+                        ? ranges[1].first - ranges[0].first
+                        : 0;
+      for (std::size_t r = 1; affine && r < ranges.size(); ++r) {
+        affine = ranges[r].size  == ranges[0].size &&
+                 ranges[r].first == ranges[r-1].first + step;
+      }
+      if (affine) {
+        cache->affine_size = ranges[0].size;
+        cache->affine_step = step;
+      }
+    }
+    return cache;
+  }
+};
+
 } // namespace dash
 #endif // DOXYGEN
 
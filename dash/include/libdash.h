@@ -49,6 +49,8 @@ namespace dash {
 #include <dash/Algorithm.h>
 #include <dash/Atomic.h>
 #include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
+#include <dash/MutexArray.h>
 
 #include <dash/Pattern.h>
 
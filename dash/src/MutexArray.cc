@@ -0,0 +1,37 @@
+#include <dash/MutexArray.h>
+#include <dash/Exception.h>
+
+namespace dash {
+
+MutexArray::MutexArray(size_t nlocks, Team & team)
+: _nlocks(nlocks) {
+  dart_ret_t ret = dart_team_lock_array_init(team.dart_id(), nlocks, &_locks);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_lock_array_init failed");
+}
+
+MutexArray::~MutexArray(){
+  dart_ret_t ret = dart_team_lock_array_destroy(&_locks);
+  if (ret != DART_OK) {
+    DASH_LOG_ERROR("Failed to destroy DART lock array! "
+                   "(dart_team_lock_array_destroy failed)");
+  }
+}
+
+void MutexArray::lock(size_t idx){
+  dart_ret_t ret = dart_lock_array_acquire(_locks, idx);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_array_acquire failed");
+}
+
+bool MutexArray::try_lock(size_t idx){
+  int32_t result;
+  dart_ret_t ret = dart_lock_array_try_acquire(_locks, idx, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_array_try_acquire failed");
+  return static_cast<bool>(result);
+}
+
+void MutexArray::unlock(size_t idx){
+  dart_ret_t ret = dart_lock_array_release(_locks, idx);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_array_release failed");
+}
+
+} // namespace dash
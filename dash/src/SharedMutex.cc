@@ -0,0 +1,53 @@
+#include <dash/SharedMutex.h>
+#include <dash/Exception.h>
+
+namespace dash {
+
+SharedMutex::SharedMutex(Team & team){
+  dart_ret_t ret = dart_team_rwlock_init(team.dart_id(), &_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_rwlock_init failed");
+}
+
+SharedMutex::~SharedMutex(){
+  dart_ret_t ret = dart_team_rwlock_destroy(&_mutex);
+  if (ret != DART_OK) {
+    DASH_LOG_ERROR("Failed to destroy DART reader-writer lock! "
+                   "(dart_team_rwlock_destroy failed)");
+  }
+}
+
+void SharedMutex::lock(){
+  dart_ret_t ret = dart_rwlock_acquire_exclusive(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_acquire_exclusive failed");
+}
+
+bool SharedMutex::try_lock(){
+  int32_t result;
+  dart_ret_t ret = dart_rwlock_try_acquire_exclusive(_mutex, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_try_acquire_exclusive failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock(){
+  dart_ret_t ret = dart_rwlock_release(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_release failed");
+}
+
+void SharedMutex::lock_shared(){
+  dart_ret_t ret = dart_rwlock_acquire_shared(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_acquire_shared failed");
+}
+
+bool SharedMutex::try_lock_shared(){
+  int32_t result;
+  dart_ret_t ret = dart_rwlock_try_acquire_shared(_mutex, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_try_acquire_shared failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock_shared(){
+  dart_ret_t ret = dart_rwlock_release(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_release failed");
+}
+
+} // namespace dash
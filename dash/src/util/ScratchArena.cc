@@ -0,0 +1,92 @@
+#include <dash/util/ScratchArena.h>
+
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+
+
+constexpr size_t dash::util::ScratchArena::DefaultBlockSize;
+constexpr size_t dash::util::ScratchArena::DefaultAlignment;
+
+dash::util::ScratchArena & dash::util::ScratchArena::local()
+{
+  static thread_local ScratchArena arena;
+  return arena;
+}
+
+void * dash::util::ScratchArena::allocate(
+  size_t nbytes,
+  size_t alignment)
+{
+  DASH_ASSERT_MSG((alignment & (alignment - 1)) == 0,
+                  "ScratchArena: alignment must be a power of two");
+  if (nbytes == 0) {
+    nbytes = 1;
+  }
+  // Find first block starting from the current block that can serve the
+  // request, blocks skipped are released on reset:
+  while (_cur_block < _blocks.size()) {
+    block_t   & block  = _blocks[_cur_block];
+    uintptr_t   base   = reinterpret_cast<uintptr_t>(block.data.get());
+    uintptr_t   addr   = (base + _cur_offset + alignment - 1)
+                         & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t      offset = addr - base;
+    if (offset + nbytes <= block.size) {
+      _cur_offset = offset + nbytes;
+      return reinterpret_cast<void *>(addr);
+    }
+    ++_cur_block;
+    _cur_offset = 0;
+  }
+  // No retained block has sufficient capacity, add a new block that is
+  // large enough to serve the request including alignment padding:
+  block_t block;
+  block.size = std::max(_block_size, nbytes + alignment);
+  block.data.reset(new char[block.size]);
+  DASH_LOG_TRACE("ScratchArena.allocate", "new block",
+                 "size:",   block.size,
+                 "blocks:", _blocks.size() + 1);
+  _blocks.push_back(std::move(block));
+  _cur_block  = _blocks.size() - 1;
+  _cur_offset = 0;
+  return allocate(nbytes, alignment);
+}
+
+void dash::util::ScratchArena::shrink(size_t nblocks) noexcept
+{
+  // Blocks up to the current block contain allocations unless the arena
+  // has been reset to its beginning:
+  size_t nused = (_cur_offset > 0) ? _cur_block + 1 : _cur_block;
+  size_t nkeep = std::max(nblocks, nused);
+  if (nkeep < _blocks.size()) {
+    DASH_LOG_TRACE("ScratchArena.shrink", "freeing blocks:",
+                   _blocks.size() - nkeep);
+    _blocks.resize(nkeep);
+  }
+}
+
+void dash::util::ScratchArena::release() noexcept
+{
+  _blocks.clear();
+  _cur_block  = 0;
+  _cur_offset = 0;
+}
+
+size_t dash::util::ScratchArena::capacity() const noexcept
+{
+  size_t nbytes = 0;
+  for (const auto & block : _blocks) {
+    nbytes += block.size;
+  }
+  return nbytes;
+}
+
+size_t dash::util::ScratchArena::size() const noexcept
+{
+  size_t nbytes = 0;
+  for (size_t b = 0; b < _cur_block && b < _blocks.size(); ++b) {
+    nbytes += _blocks[b].size;
+  }
+  return nbytes + _cur_offset;
+}
@@ -0,0 +1,103 @@
+
+#include "AssignTest.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/algorithm/Assign.h>
+
+#include <type_traits>
+
+
+TEST_F(AssignTest, ArrayExpression)
+{
+  typedef dash::Array<double> array_t;
+
+  size_t num_elem = 117 * dash::size();
+
+  array_t a(num_elem), b(num_elem), c(num_elem), d(num_elem);
+  for (size_t l = 0; l < a.lsize(); ++l) {
+    double g = static_cast<double>(a.pattern().global(l));
+    a.local[l] = g;
+    b.local[l] = g + 1;
+    c.local[l] = 2;
+  }
+  a.barrier();
+
+  auto e = 2.0 * a + b * c - a / 2.0;
+  static_assert(dash::expr::is_expression<decltype(e)>::value,
+                "operators on arrays must return lazy expressions");
+  // Array values are not modified before assignment:
+  EXPECT_EQ_U(0, d.local.size() > 0 ? d.local[0] : 0);
+
+  dash::assign(d, e);
+  for (size_t l = 0; l < d.lsize(); ++l) {
+    double g = static_cast<double>(d.pattern().global(l));
+    EXPECT_EQ_U(2.0 * g + (g + 1) * 2 - g / 2.0, d.local[l]);
+  }
+
+  // Destination as operand:
+  dash::assign(d, -d + 1);
+  for (size_t l = 0; l < d.lsize(); ++l) {
+    double g = static_cast<double>(d.pattern().global(l));
+    EXPECT_EQ_U(1.0 - (2.0 * g + (g + 1) * 2 - g / 2.0), d.local[l]);
+  }
+
+  dash::assign(d, 3);
+  for (size_t l = 0; l < d.lsize(); ++l) {
+    EXPECT_EQ_U(3.0, d.local[l]);
+  }
+}
+
+TEST_F(AssignTest, NonConformantPatterns)
+{
+  typedef dash::Array<int> array_t;
+
+  size_t num_elem = 3 * 7 * dash::size() + 5;
+
+  array_t blocked(num_elem);
+  array_t cyclic(num_elem, dash::CYCLIC);
+  array_t blockcyclic(num_elem, dash::BLOCKCYCLIC(3));
+  for (size_t l = 0; l < blocked.lsize(); ++l) {
+    blocked.local[l] = blocked.pattern().global(l);
+  }
+  for (size_t l = 0; l < cyclic.lsize(); ++l) {
+    cyclic.local[l] = 10 * cyclic.pattern().global(l);
+  }
+  blocked.barrier();
+
+  // Operands are fetched from other units:
+  dash::assign(blockcyclic, blocked + cyclic);
+  for (size_t l = 0; l < blockcyclic.lsize(); ++l) {
+    int g = blockcyclic.pattern().global(l);
+    EXPECT_EQ_U(11 * g, blockcyclic.local[l]);
+  }
+
+  // Destination as operand with different pattern:
+  dash::assign(cyclic, blockcyclic - cyclic);
+  for (size_t l = 0; l < cyclic.lsize(); ++l) {
+    int g = cyclic.pattern().global(l);
+    EXPECT_EQ_U(g, cyclic.local[l]);
+  }
+}
+
+TEST_F(AssignTest, MatrixExpression)
+{
+  typedef dash::Matrix<float, 2> matrix_t;
+
+  size_t extent_rows = 4 * dash::size();
+  size_t extent_cols = 5;
+
+  matrix_t a(extent_rows, extent_cols);
+  matrix_t b(extent_rows, extent_cols);
+  for (size_t l = 0; l < a.local_size(); ++l) {
+    a.lbegin()[l] = a.pattern().global(l);
+    b.lbegin()[l] = 1;
+  }
+  a.barrier();
+
+  dash::assign(b, a * a - b);
+  for (size_t l = 0; l < b.local_size(); ++l) {
+    float g = b.pattern().global(l);
+    EXPECT_EQ_U(g * g - 1, b.lbegin()[l]);
+  }
+}
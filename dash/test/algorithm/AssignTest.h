@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__ASSIGN_TEST_H_
+#define DASH__TEST__ASSIGN_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::assign
+ */
+class AssignTest : public dash::test::TestBase {
+protected:
+
+  AssignTest() {
+  }
+
+  virtual ~AssignTest() {
+  }
+};
+#endif // DASH__TEST__ASSIGN_TEST_H_
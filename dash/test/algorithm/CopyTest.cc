@@ -5,6 +5,9 @@
 #include <dash/Matrix.h>
 
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/CopyPlan.h>
+#include <dash/algorithm/CopyStream.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/pattern/ShiftTilePattern1D.h>
 #include <dash/pattern/TilePattern1D.h>
 #include <dash/pattern/BlockPattern1D.h>
@@ -889,6 +892,187 @@ TEST_F(CopyTest, AsyncGlobalToLocalTest)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToLocalBlockCyclic)
+{
+  // Copy a range spanning blocks of all units with local blocks
+  // interleaved with remote blocks.
+  const size_t blocksize      = 4;
+  const size_t num_elem_total = _dash_size * blocksize * 5 + 3;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(blocksize));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  const size_t offset   = 2;
+  const size_t num_copy = num_elem_total - offset - 1;
+  std::vector<int> local_copy(num_copy);
+  int * dest_end = dash::copy(array.begin() + offset,
+                              array.begin() + offset + num_copy,
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + num_copy, dest_end);
+  for (size_t i = 0; i < num_copy; ++i) {
+    EXPECT_EQ_U(static_cast<int>(offset + i), local_copy[i]);
+  }
+
+  // Asynchronous variant:
+  std::fill(local_copy.begin(), local_copy.end(), -1);
+  auto fut = dash::copy_async(array.begin() + offset,
+                              array.begin() + offset + num_copy,
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + num_copy, fut.get());
+  for (size_t i = 0; i < num_copy; ++i) {
+    EXPECT_EQ_U(static_cast<int>(offset + i), local_copy[i]);
+  }
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobal)
+{
+  // Copy between arrays of different distribution:
+  const size_t num_elem_total = _dash_size * 17;
+
+  dash::Array<int> src(num_elem_total, dash::BLOCKCYCLIC(3));
+  dash::Array<int> dst(num_elem_total + 5, dash::BLOCKED);
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = src.pattern().global(l);
+  }
+  dash::fill(dst.begin(), dst.end(), -1);
+  src.barrier();
+  dst.barrier();
+
+  auto dst_end = dash::copy<int>(src.begin(), src.end(), dst.begin() + 5);
+  EXPECT_EQ_U(dst.end().pos(), dst_end.pos());
+  dst.barrier();
+
+  for (size_t g = 0; g < dst.size(); ++g) {
+    int expected = (g < 5) ? -1 : static_cast<int>(g - 5);
+    EXPECT_EQ_U(expected, static_cast<int>(dst[g]));
+  }
+
+  // Subrange to cyclic distribution, local elements of the output range
+  // are not contiguous in global index space:
+  dash::Array<int> dst_cyclic(num_elem_total, dash::CYCLIC);
+  dash::fill(dst_cyclic.begin(), dst_cyclic.end(), -1);
+  dst_cyclic.barrier();
+  dash::copy<int>(src.begin() + 2, src.end() - 3, dst_cyclic.begin() + 1);
+  dst_cyclic.barrier();
+
+  for (size_t g = 0; g < dst_cyclic.size(); ++g) {
+    int expected = (g < 1 || g >= num_elem_total - 4)
+                   ? -1 : static_cast<int>(g + 1);
+    EXPECT_EQ_U(expected, static_cast<int>(dst_cyclic[g]));
+  }
+}
+
+TEST_F(CopyTest, PlanGlobalToLocal)
+{
+  const size_t num_elem_per_unit = 12;
+  const size_t num_elem_total    = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  std::vector<int> local_copy(num_elem_total);
+
+  // Plan is created once and executed in every iteration:
+  auto plan = dash::copy_plan(array.begin(), array.end(), local_copy.data());
+  // Adjacent segments are coalesced to a single transfer per unit:
+  EXPECT_EQ_U(_dash_size - 1, plan.num_transfers());
+  EXPECT_EQ_U(1,              plan.num_local_copies());
+
+  for (int iter = 0; iter < 3; ++iter) {
+    for (size_t l = 0; l < array.lsize(); ++l) {
+      array.local[l] = iter * 1000 + array.pattern().global(l);
+    }
+    array.barrier();
+
+    std::fill(local_copy.begin(), local_copy.end(), -1);
+    if (iter % 2 == 0) {
+      EXPECT_EQ_U(local_copy.data() + num_elem_total, plan.execute());
+    } else {
+      auto fut = plan.execute_async();
+      EXPECT_EQ_U(local_copy.data() + num_elem_total, fut.get());
+    }
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      EXPECT_EQ_U(static_cast<int>(iter * 1000 + g), local_copy[g]);
+    }
+    array.barrier();
+  }
+}
+
+TEST_F(CopyTest, PlanLocalToGlobal)
+{
+  const size_t num_elem_total = _dash_size * 10;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(3));
+  // Every unit writes a range of 4 elements starting at its first block:
+  const size_t offset = dash::myid().id * 3;
+  std::vector<int> values(4);
+  auto plan = dash::copy_plan(values.data(), values.data() + values.size(),
+                              array.begin() + offset);
+
+  for (int iter = 0; iter < 2; ++iter) {
+    std::fill(array.lbegin(), array.lend(), -1);
+    array.barrier();
+    // Ranges of units overlap by one element, only unit 0 writes its range:
+    if (dash::myid().id == 0) {
+      for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = iter * 100 + i;
+      }
+      EXPECT_EQ_U(array.begin() + 4, plan.execute());
+    }
+    array.barrier();
+    for (size_t i = 0; i < values.size(); ++i) {
+      EXPECT_EQ_U(static_cast<int>(iter * 100 + i),
+                  static_cast<int>(array[i]));
+    }
+    EXPECT_EQ_U(-1, static_cast<int>(array[4]));
+    array.barrier();
+  }
+}
+
+TEST_F(CopyTest, StreamGlobalToLocal)
+{
+  const size_t num_elem_total = _dash_size * 40 + 3;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(13));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  const size_t offset     = 1;
+  const size_t num_copy   = num_elem_total - offset;
+  const size_t chunk_size = 5;
+  std::vector<int> local_copy(num_copy, -1);
+  std::vector<int> num_visits(num_copy, 0);
+  const int * last_remote = nullptr;
+  int * out_last = dash::copy_stream(
+    array.begin() + offset, array.end(), local_copy.data(),
+    [&](const int * first, const int * last) {
+      ASSERT_LT_U(0, last - first);
+      ASSERT_LE_U(static_cast<size_t>(last - first), chunk_size);
+      // Remote chunks are passed in the order in which they have been
+      // requested:
+      size_t gfirst = offset + (first - local_copy.data());
+      if (array.pattern().unit_at(gfirst) != array.team().myid()) {
+        EXPECT_LT_U(last_remote, first);
+        last_remote = first;
+      }
+      for (const int * it = first; it != last; ++it) {
+        size_t i = it - local_copy.data();
+        // Elements are copied when the chunk is passed to the function:
+        EXPECT_EQ_U(static_cast<int>(offset + i), *it);
+        ++num_visits[i];
+      }
+    },
+    chunk_size, 2);
+  EXPECT_EQ_U(local_copy.data() + num_copy, out_last);
+  for (size_t i = 0; i < num_copy; ++i) {
+    EXPECT_EQ_U(1, num_visits[i]);
+  }
+  array.barrier();
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
@@ -8,6 +8,7 @@
 
 #include <dash/pattern/BlockPattern1D.h>
 #include <dash/pattern/TilePattern1D.h>
+#include <dash/pattern/DynamicPattern.h>
 
 #include "../TestBase.h"
 #include "ArrayTest.h"
@@ -305,3 +306,131 @@ TEST_F(ArrayTest, ElementCompare){
     ASSERT_NE_U(arr[0], arr[dash::myid()]);
   }
 }
+
+TEST_F(ArrayTest, Resize){
+  using array_t = dash::Array<int>;
+
+  const size_t nunits = dash::size();
+  const size_t nelem  = 7 * nunits + 3;
+
+  array_t arr(nelem);
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    arr.local[l] = static_cast<int>(arr.pattern().global(l));
+  }
+  // Grow in stages, owners of most elements change:
+  size_t size = nelem;
+  for (int stage = 0; stage < 3; ++stage) {
+    size_t new_size = size * 2 + 5;
+    arr.resize(new_size);
+    ASSERT_EQ_U(arr.size(), new_size);
+    ASSERT_EQ_U(arr.lsize(), arr.pattern().local_size());
+    ASSERT_LE_U(arr.size(), arr.capacity());
+    for (size_t l = 0; l < arr.lsize(); ++l) {
+      auto g = arr.pattern().global(l);
+      if (static_cast<size_t>(g) < nelem) {
+        ASSERT_EQ_U(g, arr.local[l]);
+      } else if (static_cast<size_t>(g) >= size) {
+        ASSERT_EQ_U(0, arr.local[l]);
+        arr.local[l] = static_cast<int>(g);
+      } else {
+        ASSERT_EQ_U(g, arr.local[l]);
+      }
+    }
+    size = new_size;
+  }
+  arr.barrier();
+  for (size_t g = 0; g < size; g += 11) {
+    ASSERT_EQ_U(static_cast<int>(g), static_cast<int>(arr[g]));
+  }
+  arr.barrier();
+  // Shrink, reuses global memory:
+  auto lcapacity = arr.lcapacity();
+  arr.resize(nelem);
+  ASSERT_EQ_U(arr.size(), nelem);
+  ASSERT_EQ_U(arr.lcapacity(), lcapacity);
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    ASSERT_EQ_U(arr.pattern().global(l), arr.local[l]);
+  }
+}
+
+TEST_F(ArrayTest, ReserveCyclic){
+  using array_t = dash::Array<double>;
+
+  const size_t nunits = dash::size();
+  const size_t nelem  = 4 * nunits;
+
+  array_t arr(nelem, dash::CYCLIC);
+  arr.reserve(4 * nelem);
+  ASSERT_EQ_U(arr.size(), nelem);
+  ASSERT_EQ_U(arr.capacity(), 4 * nelem);
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    arr.local[l] = static_cast<double>(arr.pattern().global(l));
+  }
+  // Growing a cyclic distribution keeps all elements in place, so native
+  // pointers to local elements remain valid within the capacity:
+  double * lbegin = arr.lbegin();
+  arr.resize(3 * nelem);
+  ASSERT_EQ_U(lbegin, arr.lbegin());
+  ASSERT_EQ_U(arr.lsize(), 12);
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    double expected = (l < 4) ? static_cast<double>(arr.pattern().global(l))
+                              : 0.0;
+    ASSERT_EQ_U(expected, arr.local[l]);
+  }
+}
+
+TEST_F(ArrayTest, RebalanceAsync){
+  typedef dash::DynamicPattern<1>    pattern_t;
+  typedef pattern_t::index_type      index_t;
+  typedef dash::Array<index_t, index_t, pattern_t> array_t;
+
+  const size_t nunits = dash::size();
+
+  // Imbalanced initial distribution, unit u holds (u + 1) * 10 elements:
+  pattern_t pattern(dash::SizeSpec<1>(nunits),
+                    dash::DistributionSpec<1>(dash::BLOCKED));
+  for (dash::team_unit_t u{0}; u < nunits; ++u) {
+    pattern.local_resize(u, (u.id + 1) * 10);
+  }
+  const size_t size = pattern.size();
+  ASSERT_EQ_U(5 * nunits * (nunits + 1), size);
+
+  array_t arr(pattern);
+  ASSERT_EQ_U(size, arr.size());
+  ASSERT_EQ_U((dash::myid().id + 1) * 10, arr.lsize());
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    arr.local[l] = pattern.global(l);
+  }
+  arr.barrier();
+
+  auto balanced = arr.pattern();
+  balanced.balance();
+  ASSERT_EQ_U(size, balanced.size());
+  for (dash::team_unit_t u{0}; u < nunits; ++u) {
+    EXPECT_LE_U(balanced.local_size(u), size / nunits + 1);
+    EXPECT_LE_U(size / nunits, balanced.local_size(u));
+  }
+
+  arr.rebalance_async(balanced);
+  // Elements remain readable in their previous distribution until the
+  // redistribution is completed:
+  ASSERT_EQ_U((dash::myid().id + 1) * 10, arr.lsize());
+  for (size_t g = 0; g < size; g += 7) {
+    EXPECT_EQ_U(static_cast<index_t>(g), static_cast<index_t>(arr[g]));
+  }
+  // Memory must not be replaced while the redistribution is pending:
+  EXPECT_THROW(arr.resize(size + 1), dash::exception::RuntimeError);
+  EXPECT_THROW(arr.rebalance(balanced), dash::exception::RuntimeError);
+  arr.rebalance_wait();
+
+  ASSERT_EQ_U(size, arr.size());
+  ASSERT_EQ_U(balanced.local_size(), arr.lsize());
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    EXPECT_EQ_U(balanced.global(l), arr.local[l]);
+  }
+  arr.barrier();
+  for (size_t g = 0; g < size; ++g) {
+    EXPECT_EQ_U(static_cast<index_t>(g), static_cast<index_t>(arr[g]));
+  }
+  arr.barrier();
+}
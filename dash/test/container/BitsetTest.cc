@@ -0,0 +1,78 @@
+#include "BitsetTest.h"
+
+#include <dash/Bitset.h>
+#include <dash/BloomFilter.h>
+
+
+TEST_F(BitsetTest, ConcurrentSet)
+{
+  const size_t nunits = dash::size();
+  const size_t myid   = dash::myid();
+  // size not a multiple of the word size:
+  const size_t nbits  = 1000 * nunits + 13;
+
+  dash::Bitset bits(nbits);
+  ASSERT_EQ_U(bits.size(), nbits);
+  ASSERT_EQ_U(bits.words().size(),
+              (nbits + dash::Bitset::word_bits - 1) /
+                dash::Bitset::word_bits);
+  ASSERT_EQ_U(bits.count(), 0);
+
+  // units set interleaved bits so every word is updated concurrently by
+  // all units:
+  for (size_t i = myid; i < nbits; i += nunits) {
+    ASSERT_FALSE_U(bits.set(i));
+  }
+  bits.barrier();
+  ASSERT_EQ_U(bits.count(), nbits);
+  for (size_t i = 0; i < nbits; i += 7) {
+    ASSERT_TRUE_U(bits.test(i));
+  }
+  // setting a bit again returns its previous value:
+  ASSERT_TRUE_U(bits.set(myid));
+  bits.barrier();
+
+  if (myid == 0) {
+    ASSERT_TRUE_U(bits.reset(nbits - 1));
+    ASSERT_FALSE_U(bits.reset(nbits - 1));
+    ASSERT_FALSE_U(bits[nbits - 1]);
+  }
+  bits.barrier();
+  ASSERT_EQ_U(bits.count(), nbits - 1);
+
+  bits.clear();
+  ASSERT_EQ_U(bits.count(), 0);
+}
+
+TEST_F(BitsetTest, BloomFilter)
+{
+  const size_t nunits    = dash::size();
+  const long   myid      = dash::myid();
+  const size_t nelements = 500;
+
+  dash::BloomFilter<long> filter(nelements * nunits, 0.01);
+  ASSERT_GT_U(filter.num_hashes(), 1);
+  ASSERT_GE_U(filter.size(), nelements * nunits * 9);
+
+  // every unit inserts a disjoint set of elements:
+  for (size_t i = 0; i < nelements; ++i) {
+    filter.insert(myid * nelements + i);
+  }
+  filter.barrier();
+
+  // no false negatives:
+  for (size_t e = 0; e < nelements * nunits; ++e) {
+    ASSERT_TRUE_U(filter.contains(e));
+  }
+  // few false positives:
+  size_t nfalse = 0;
+  for (size_t e = nelements * nunits; e < 2 * nelements * nunits; ++e) {
+    nfalse += filter.contains(e);
+  }
+  ASSERT_LT_U(nfalse, nelements * nunits / 20);
+  filter.barrier();
+
+  // re-inserting reports elements as possibly contained:
+  ASSERT_TRUE_U(filter.insert(myid * nelements));
+  filter.barrier();
+}
@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__BITSET_TEST_H_
+#define DASH__TEST__BITSET_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for classes dash::Bitset and dash::BloomFilter
+ */
+class BitsetTest : public dash::test::TestBase {
+protected:
+
+  BitsetTest() {
+    LOG_MESSAGE(">>> Test suite: BitsetTest");
+  }
+
+  virtual ~BitsetTest()
+  {
+    LOG_MESSAGE("<<< Closing test suite: BitsetTest");
+  }
+};
+
+#endif // DASH__TEST__BITSET_TEST_H_
@@ -9,6 +9,8 @@
 #include <dash/util/TeamLocality.h>
 
 // for std::lock_guard
+#include <chrono>
+#include <cmath>
 #include <mutex>
 #include <thread>
 #include <random>
@@ -202,6 +204,65 @@ TEST_F(CoarrayTest, Collectives)
   ASSERT_EQ_U(static_cast<int>(x[5][0]), 2 * dash::size());
 }
 
+TEST_F(CoarrayTest, CoCollectives)
+{
+  using namespace dash::coarray;
+  const int nimages = num_images();
+  const int myimage = this_image();
+
+  dash::Coarray<int> i;
+  i = myimage + 1;
+  co_sum(i);
+  ASSERT_EQ_U(static_cast<int>(i), nimages * (nimages + 1) / 2);
+
+  dash::Coarray<double[4]> x;
+  for (int e = 0; e < 4; ++e) {
+    x[e] = myimage * 10 + e;
+  }
+  co_max(x);
+  for (int e = 0; e < 4; ++e) {
+    ASSERT_EQ_U(static_cast<double>(x[e]), (nimages - 1) * 10 + e);
+  }
+
+  // result only on result image, other images keep their values
+  auto last_image = dash::team_unit_t{nimages - 1};
+  i = myimage + 1;
+  co_min(i, last_image);
+  if (myimage == last_image) {
+    ASSERT_EQ_U(static_cast<int>(i), 1);
+  } else {
+    ASSERT_EQ_U(static_cast<int>(i), myimage + 1);
+  }
+
+  // user-defined operation on non-basic type, reduced in tree
+  struct minloc_t {
+    double value;
+    int    image;
+  };
+  dash::Coarray<minloc_t> ml;
+  ml = minloc_t { 100.0 - myimage, myimage };
+  co_reduce(ml, [](const minloc_t & a, const minloc_t & b) {
+                  return (a.value < b.value) ? a : b;
+                });
+  ASSERT_EQ_U(static_cast<minloc_t>(ml).image, nimages - 1);
+
+  // user-defined operation on basic type, reduced at result image
+  for (int e = 0; e < 4; ++e) {
+    x[e] = 2;
+  }
+  co_reduce(x, [](double a, double b) { return a * b; },
+            dash::team_unit_t{0});
+  if (myimage == 0) {
+    ASSERT_EQ_U(static_cast<double>(x[3]), std::pow(2.0, nimages));
+  }
+
+  if (myimage == last_image) {
+    i = 42;
+  }
+  co_broadcast(i, last_image);
+  ASSERT_EQ_U(static_cast<int>(i), 42);
+}
+
 TEST_F(CoarrayTest, Synchronization)
 {
   std::chrono::time_point<std::chrono::system_clock> start, end;
@@ -236,6 +297,28 @@ TEST_F(CoarrayTest, Synchronization)
   }
 }
 
+TEST_F(CoarrayTest, SyncImagesNeighbours)
+{
+  const int nimages = num_images();
+  const int me      = this_image();
+  const int left    = (me + nimages - 1) % nimages;
+  const int right   = (me + 1) % nimages;
+  std::array<int, 3> images {{ left, me, right }};
+
+  dash::Coarray<int> x;
+  x = 0;
+  x.sync_all();
+
+  for (int step = 1; step <= 10; ++step) {
+    x = me * 100 + step;
+    x.sync_images(images);
+    ASSERT_EQ_U(static_cast<int>(x(left)),  left  * 100 + step);
+    ASSERT_EQ_U(static_cast<int>(x(right)), right * 100 + step);
+    // neighbours must have read the value before it is overwritten
+    x.sync_images(images);
+  }
+}
+
 TEST_F(CoarrayTest, Iterators)
 {
   dash::Coarray<int>         i;
@@ -472,10 +555,6 @@ TEST_F(CoarrayTest, CoEvent)
   if(num_images() < 2){
     SKIP_TEST_MSG("This test requires at least 2 units");
   }
-  if(!core_mapping_is_unique(dash::Team::All())){
-    SKIP_TEST_MSG("Multiple units are mapped to the same core => possible deadlock");
-  }
-
   if(this_image() == 0){
     events(1).post();
     LOG_MESSAGE("event posted to unit 1");
@@ -527,12 +606,6 @@ TEST_F(CoarrayTest, CoEventIter)
   if(num_images() < 3){
     SKIP_TEST_MSG("This test requires at least 3 units");
   }
-  // Check runtime conditions
-  // This might deadlock if multiple units are pinned to the same CPU
-  if(!core_mapping_is_unique(dash::Team::All())){
-    SKIP_TEST_MSG("Multiple units are mapped to the same core => possible deadlock");
-  }
-
   dash::Coevent events;
 
   auto snd = events.begin()+1;
@@ -546,3 +619,43 @@ TEST_F(CoarrayTest, CoEventIter)
     events.wait(num_images());
   }
 }
+
+TEST_F(CoarrayTest, CoEventTimedWait)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("This test requires at least 2 units");
+  }
+
+  dash::Coevent events;
+
+  // no events posted, wait must time out without consuming events
+  if(this_image() == 0){
+    ASSERT_FALSE_U(events.wait_for(std::chrono::milliseconds(10)));
+    ASSERT_EQ_U(events.test(), 0);
+  }
+  dash::barrier();
+
+  // batched post of multiple events by every unit
+  const int nposts = 3;
+  events(0).post(nposts);
+  if(this_image() == 0){
+    ASSERT_TRUE_U(events.wait_for(std::chrono::seconds(60),
+                                  nposts * num_images()));
+    ASSERT_EQ_U(events.test(), 0);
+  }
+  dash::barrier();
+
+  // insufficient events are not consumed on timeout
+  if(this_image() == 1){
+    events(0).post();
+  }
+  dash::barrier();
+  if(this_image() == 0){
+    ASSERT_EQ_U(events(0).test(), 1);
+    ASSERT_FALSE_U(events.wait_for(std::chrono::milliseconds(1), 2));
+    ASSERT_EQ_U(events.test(), 1);
+    events.wait();
+    ASSERT_EQ_U(events.test(), 0);
+  }
+  dash::barrier();
+}
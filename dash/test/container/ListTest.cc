@@ -96,3 +96,65 @@ TEST_F(ListTest, Initialization)
   }
 }
 
+
+TEST_F(ListTest, ConcurrentAppend)
+{
+  typedef int value_t;
+
+  const int nunits   = dash::size();
+  const int myid     = dash::myid();
+  // Number of elements appended by every unit to every unit:
+  const int nappend  = 50;
+  const int nbatch   = 5;
+  // Small local buffer size so appended elements exceed the initial
+  // capacity of append segments:
+  const int lbuf_size = 16;
+
+  dash::List<value_t> list(nunits * 1000, lbuf_size);
+
+  for (int u = 0; u < nunits; ++u) {
+    // Append to units in different order at every unit:
+    dash::team_unit_t target((u + myid) % nunits);
+    for (int b = 0; b < nappend; b += nbatch) {
+      std::vector<value_t> values;
+      for (int i = b; i < b + nbatch; ++i) {
+        values.push_back(1000 * (myid + 1) + i);
+      }
+      list.append(target, values.data(), values.size());
+    }
+  }
+  list.barrier();
+
+  EXPECT_EQ_U(nappend * nunits,          list.lsize());
+  EXPECT_EQ_U(nappend * nunits * nunits, list.size());
+
+  std::vector<value_t> local_values;
+  for (size_t li = 0; li < list.local.size(); ++li) {
+    local_values.push_back((*(list.local.begin() + li)).value);
+  }
+  // Elements of every unit are appended in their original order:
+  for (int u = 0; u < nunits; ++u) {
+    int next = 0;
+    for (auto v : local_values) {
+      if (v / 1000 == u + 1) {
+        EXPECT_EQ_U(1000 * (u + 1) + next, v);
+        ++next;
+      }
+    }
+    EXPECT_EQ_U(nappend, next);
+  }
+
+  // push_back appends to the last unit in batches of the local buffer
+  // size:
+  const int npush = 2 * lbuf_size + 3;
+  for (int i = 0; i < npush; ++i) {
+    list.push_back(-myid);
+  }
+  list.barrier();
+  EXPECT_EQ_U(nappend * nunits * nunits + npush * nunits, list.size());
+  if (myid == nunits - 1) {
+    EXPECT_EQ_U(nappend * nunits + npush * nunits, list.lsize());
+  } else {
+    EXPECT_EQ_U(nappend * nunits, list.lsize());
+  }
+}
@@ -743,6 +743,14 @@ TEST_F(MatrixTest, BlockCopy)
   LOG_MESSAGE("Wait for team barrier ...");
   dash::barrier();
   LOG_MESSAGE("Team barrier passed");
+
+  auto block_a = matrix_a.block(1);
+  auto block_b = matrix_b.block(0);
+  ASSERT_EQ_U(block_a.size(), block_b.size());
+  for (size_t i = 0; i < block_a.size(); ++i) {
+    ASSERT_EQ_U(static_cast<element_t>(block_a.begin()[i]),
+                static_cast<element_t>(block_b.begin()[i]));
+  }
 }
 
 TEST_F(MatrixTest, StorageOrder)
@@ -0,0 +1,151 @@
+#include "QueueTest.h"
+
+#include <dash/Queue.h>
+
+#include <numeric>
+#include <vector>
+
+
+TEST_F(QueueTest, LocalPushPop)
+{
+  const size_t capacity = 4;
+  dash::Queue<int> queue(capacity);
+  ASSERT_EQ_U(queue.capacity(), capacity);
+  ASSERT_TRUE_U(queue.empty());
+
+  // elements are removed in FIFO order and slots are reused in every
+  // round:
+  for (int round = 0; round < 5; ++round) {
+    for (size_t i = 0; i < capacity; ++i) {
+      ASSERT_TRUE_U(queue.push(round * 10 + i));
+    }
+    ASSERT_FALSE_U(queue.push(-1));
+    ASSERT_EQ_U(queue.local_size(), capacity);
+
+    int value;
+    ASSERT_EQ_U(queue.pop(&value), 1);
+    ASSERT_EQ_U(value, round * 10);
+    // batch of elements wrapping around the end of the ring buffer:
+    ASSERT_TRUE_U(queue.push(round * 10 + capacity));
+    std::vector<int> values(capacity + 1);
+    ASSERT_EQ_U(queue.pop(values.data(), values.size()), capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+      ASSERT_EQ_U(values[i], round * 10 + i + 1);
+    }
+    ASSERT_EQ_U(queue.pop(&value), 0);
+  }
+  queue.barrier();
+}
+
+TEST_F(QueueTest, RemotePushAndSteal)
+{
+  const size_t nitems   = 50;
+  const auto   nunits   = dash::size();
+  const auto   myid     = dash::myid();
+  dash::Queue<long> queue(nitems * nunits);
+  // capacity is rounded up to the next power of two:
+  ASSERT_GE_U(queue.capacity(), nitems * nunits);
+  ASSERT_EQ_U(queue.capacity() & (queue.capacity() - 1), 0);
+
+  // every unit appends its items to the queue of unit 0 in batches:
+  std::vector<long> items(nitems);
+  std::iota(items.begin(), items.end(), myid * nitems);
+  for (size_t i = 0; i < nitems; i += 10) {
+    ASSERT_TRUE_U(queue.push(dash::team_unit_t{0}, items.data() + i, 10));
+  }
+  queue.barrier();
+  ASSERT_EQ_U(queue.size(dash::team_unit_t{0}), nitems * nunits);
+
+  // unit 0 consumes its queue while all other units steal from it:
+  long   sum    = 0;
+  long   count  = 0;
+  std::vector<long> batch(16);
+  size_t n;
+  do {
+    n = (myid == 0)
+        ? queue.pop(batch.data(), batch.size())
+        : queue.steal(batch.data(), batch.size());
+    for (size_t i = 0; i < n; ++i) {
+      sum += batch[i];
+    }
+    count += n;
+  } while (queue.size(dash::team_unit_t{0}) > 0);
+  queue.barrier();
+
+  // every item has been removed exactly once:
+  long total[2];
+  long local[2] = { sum, count };
+  dart_allreduce(local, total, 2, DART_TYPE_LONG, DART_OP_SUM,
+                 dash::Team::All().dart_id());
+  const long nall = nitems * nunits;
+  ASSERT_EQ_U(total[1], nall);
+  ASSERT_EQ_U(total[0], nall * (nall - 1) / 2);
+}
+
+TEST_F(QueueTest, StealHalf)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  dash::Queue<int> queue(16);
+  if (dash::myid() == 0) {
+    for (int i = 0; i < 10; ++i) {
+      queue.push(i);
+    }
+  }
+  queue.barrier();
+  if (dash::myid() == 1) {
+    std::vector<int> batch(16);
+    // thief claims half of the victim's elements from the front:
+    ASSERT_EQ_U(queue.steal(dash::team_unit_t{0}, batch.data(), 16), 5);
+    ASSERT_EQ_U(batch[0], 0);
+    ASSERT_EQ_U(batch[4], 4);
+    ASSERT_EQ_U(queue.steal(dash::team_unit_t{0}, batch.data(), 2), 2);
+    ASSERT_EQ_U(batch[1], 6);
+  }
+  queue.barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(queue.local_size(), 3);
+  }
+  queue.barrier();
+}
+
+TEST_F(QueueTest, StealFromFirstUnit)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t nitems = 100;
+  const auto   myid   = dash::myid();
+  dash::Queue<long> queue(nitems);
+  // only unit 0 fills its queue:
+  if (myid == 0) {
+    std::vector<long> items(nitems);
+    std::iota(items.begin(), items.end(), 0);
+    ASSERT_TRUE_U(queue.push(dash::team_unit_t{0}, items.data(), nitems));
+  }
+  queue.barrier();
+
+  // all other units drain the queue of unit 0 by stealing:
+  long sum   = 0;
+  long count = 0;
+  if (myid != 0) {
+    std::vector<long> batch(8);
+    while (queue.size(dash::team_unit_t{0}) > 0) {
+      size_t n = queue.steal(batch.data(), batch.size());
+      for (size_t i = 0; i < n; ++i) {
+        sum += batch[i];
+      }
+      count += n;
+    }
+  }
+  queue.barrier();
+
+  long total[2];
+  long local[2] = { sum, count };
+  dart_allreduce(local, total, 2, DART_TYPE_LONG, DART_OP_SUM,
+                 dash::Team::All().dart_id());
+  ASSERT_EQ_U(total[1], static_cast<long>(nitems));
+  ASSERT_EQ_U(total[0], static_cast<long>(nitems * (nitems - 1) / 2));
+  ASSERT_EQ_U(queue.size(dash::team_unit_t{0}), 0);
+}
@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__QUEUE_TEST_H_
+#define DASH__TEST__QUEUE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::Queue
+ */
+class QueueTest : public dash::test::TestBase {
+protected:
+
+  QueueTest() {
+    LOG_MESSAGE(">>> Test suite: QueueTest");
+  }
+
+  virtual ~QueueTest()
+  {
+    LOG_MESSAGE("<<< Closing test suite: QueueTest");
+  }
+};
+
+#endif // DASH__TEST__QUEUE_TEST_H_
@@ -0,0 +1,154 @@
+#include "ReadCacheTest.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/ReadCache.h>
+
+
+TEST_F(ReadCacheTest, ArrayRemoteReads)
+{
+  const size_t nunits = dash::size();
+  const size_t myid   = dash::myid();
+  const size_t nlocal = 100;
+  const size_t nelem  = nlocal * nunits;
+
+  dash::Array<int> array(nelem);
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = static_cast<int>(myid * 1000 + l);
+  }
+  array.barrier();
+
+  // Lines of 8 elements, direct-mapped:
+  auto cache = array.cached(8, 64, 1);
+  ASSERT_EQ_U(cache.line_size(), 8);
+  ASSERT_EQ_U(cache.num_lines(), 64);
+
+  const size_t right = (myid + 1) % nunits;
+  for (int rep = 0; rep < 3; ++rep) {
+    for (size_t l = 0; l < nlocal; ++l) {
+      ASSERT_EQ_U(static_cast<int>(right * 1000 + l),
+                  cache[right * nlocal + l]);
+    }
+  }
+  if (nunits > 1) {
+    // Every line of 100 elements read once:
+    ASSERT_EQ_U(cache.misses(), 13);
+    ASSERT_EQ_U(cache.hits(),   3 * nlocal - 13);
+  } else {
+    ASSERT_EQ_U(cache.misses(), 0);
+    ASSERT_EQ_U(cache.hits(),   0);
+  }
+
+  // Updates are visible after invalidation:
+  array.barrier();
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = -static_cast<int>(myid * 1000 + l);
+  }
+  array.barrier();
+  ASSERT_EQ_U(static_cast<int>(right * 1000 + 5),
+              cache[right * nlocal + 5] * (nunits > 1 ? 1 : -1));
+  cache.invalidate();
+  cache.reset_stats();
+  ASSERT_EQ_U(-static_cast<int>(right * 1000 + 5),
+              cache[right * nlocal + 5]);
+  ASSERT_EQ_U(cache.misses(), nunits > 1 ? 1 : 0);
+}
+
+TEST_F(ReadCacheTest, SetConflicts)
+{
+  const size_t nunits = dash::size();
+  if (nunits < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t myid   = dash::myid();
+  const size_t nlocal = 1024;
+
+  dash::Array<double> array(nlocal * nunits);
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = static_cast<double>(array.pattern().global(l));
+  }
+  array.barrier();
+
+  // Single set of two lines, least recently used line is replaced:
+  auto cache = array.cached(4, 1, 2);
+  const size_t base = ((myid + 1) % nunits) * nlocal;
+  ASSERT_EQ_U(static_cast<double>(base),      cache[base]);
+  ASSERT_EQ_U(static_cast<double>(base + 4),  cache[base + 4]);
+  ASSERT_EQ_U(static_cast<double>(base + 1),  cache[base + 1]);
+  ASSERT_EQ_U(static_cast<double>(base + 8),  cache[base + 8]);
+  ASSERT_EQ_U(cache.misses(), 3);
+  // Line of base + 4 has been replaced, line of base still cached:
+  ASSERT_EQ_U(static_cast<double>(base + 2),  cache[base + 2]);
+  ASSERT_EQ_U(cache.misses(), 3);
+  ASSERT_EQ_U(static_cast<double>(base + 5),  cache[base + 5]);
+  ASSERT_EQ_U(cache.misses(), 4);
+  ASSERT_EQ_U(cache.hits(),   2);
+  array.barrier();
+}
+
+TEST_F(ReadCacheTest, MatrixRemoteReads)
+{
+  const size_t nunits = dash::size();
+  const size_t extent = 8 * nunits;
+
+  dash::Matrix<long, 2> matrix(
+    dash::SizeSpec<2>(extent, extent),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE));
+  for (size_t i = 0; i < matrix.local.extent(0); ++i) {
+    for (size_t j = 0; j < matrix.local.extent(1); ++j) {
+      auto g = matrix.pattern().global(
+                 std::array<dash::default_index_t, 2> {{
+                   static_cast<dash::default_index_t>(i),
+                   static_cast<dash::default_index_t>(j) }});
+      matrix.local[i][j] = g[0] * 1000 + g[1];
+    }
+  }
+  matrix.barrier();
+
+  auto cache = matrix.cached();
+  for (int rep = 0; rep < 2; ++rep) {
+    for (size_t i = 0; i < extent; ++i) {
+      for (size_t j = 0; j < extent; ++j) {
+        ASSERT_EQ_U(static_cast<long>(i * 1000 + j), cache(i, j));
+      }
+    }
+  }
+  ASSERT_LT_U(cache.misses(), cache.hits());
+  matrix.barrier();
+}
+
+TEST_F(ReadCacheTest, ArrayResize)
+{
+  const size_t nunits = dash::size();
+  if (nunits < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t myid   = dash::myid();
+  const size_t nlocal = 10;
+
+  dash::Array<int> array(nlocal * nunits);
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = static_cast<int>(array.pattern().global(l));
+  }
+  array.barrier();
+
+  auto cache = array.cached(16, 4, 1);
+  const size_t right = (myid + 1) % nunits;
+  ASSERT_EQ_U(static_cast<int>(right * nlocal), cache[right * nlocal]);
+  array.barrier();
+
+  // Lines read before the array is reallocated are discarded and lines
+  // cover the grown local capacity:
+  array.resize(4 * nlocal * nunits);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = -static_cast<int>(array.pattern().global(l));
+  }
+  array.barrier();
+  cache.reset_stats();
+  const size_t rbegin = right * 4 * nlocal;
+  for (size_t l = 0; l < 4 * nlocal; ++l) {
+    ASSERT_EQ_U(-static_cast<int>(rbegin + l), cache[rbegin + l]);
+  }
+  ASSERT_EQ_U(cache.misses(), 3);
+  array.barrier();
+}
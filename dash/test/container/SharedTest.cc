@@ -3,6 +3,7 @@
 
 #include <dash/Shared.h>
 #include <dash/Atomic.h>
+#include <dash/SharedCounter.h>
 
 #include <iostream>
 #include <sstream>
@@ -219,3 +220,30 @@ TEST_F(SharedTest, AtomicAdd)
   shared.barrier();
 }
 
+
+TEST_F(SharedTest, Counter)
+{
+  typedef int value_t;
+  const int num_incs = 10;
+
+  dash::SharedCounter<value_t> counter;
+  for (int i = 0; i < num_incs; ++i) {
+    counter.inc(2);
+  }
+  counter.dec(num_incs);
+  dash::barrier();
+
+  value_t expected = num_incs * dash::size();
+  EXPECT_EQ_U(expected, counter.get());
+  EXPECT_EQ_U(expected, counter.allreduce());
+
+  // Relaxed reads include own updates since the last refresh:
+  counter.set_refresh_interval(std::chrono::hours(1));
+  EXPECT_EQ_U(expected, counter.get_relaxed());
+  counter.inc(1);
+  EXPECT_EQ_U(expected + 1, counter.get_relaxed());
+  dash::barrier();
+
+  EXPECT_EQ_U(expected + static_cast<value_t>(dash::size()), counter.get());
+  dash::barrier();
+}
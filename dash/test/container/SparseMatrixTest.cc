@@ -0,0 +1,136 @@
+#include "SparseMatrixTest.h"
+
+#include <dash/SparseMatrix.h>
+#include <dash/Array.h>
+
+#include <vector>
+
+
+TEST_F(SparseMatrixTest, LaplacianSpMV)
+{
+  typedef dash::SparseMatrix<double>            matrix_t;
+  typedef dash::default_index_t                  index_t;
+
+  const size_t nunits = dash::size();
+  const size_t myid   = dash::myid();
+
+  // Unbalanced row distribution, unit u owns 5 + u rows:
+  std::vector<matrix_t::size_type> local_rows(nunits);
+  index_t n         = 0;
+  index_t my_offset = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    local_rows[u] = 5 + u;
+    if (u < myid) {
+      my_offset += local_rows[u];
+    }
+    n += local_rows[u];
+  }
+
+  // Tridiagonal matrix of the 1D Laplacian:
+  std::vector<index_t> row_ptr { 0 };
+  std::vector<index_t> col_idx;
+  std::vector<double>  values;
+  for (index_t r = my_offset; r < my_offset + index_t(local_rows[myid]);
+       ++r) {
+    if (r > 0) {
+      col_idx.push_back(r - 1);
+      values.push_back(-1.0);
+    }
+    col_idx.push_back(r);
+    values.push_back(2.0);
+    if (r < n - 1) {
+      col_idx.push_back(r + 1);
+      values.push_back(-1.0);
+    }
+    row_ptr.push_back(col_idx.size());
+  }
+
+  matrix_t A(n, row_ptr, col_idx, values);
+  ASSERT_EQ_U(A.nrows(), n);
+  ASSERT_EQ_U(A.ncols(), n);
+  ASSERT_EQ_U(A.nnz(),   3 * n - 2);
+  ASSERT_EQ_U(A.local_rows(), local_rows[myid]);
+  ASSERT_EQ_U(A.row_offset(), my_offset);
+
+  // x distributed in balanced blocks, different from the rows of A:
+  dash::Array<double> x(n);
+  dash::Array<double, index_t, matrix_t::pattern_type> y(A.row_pattern());
+  for (size_t l = 0; l < x.lsize(); ++l) {
+    auto g = x.pattern().global(l);
+    x.local[l] = static_cast<double>(g * g);
+  }
+
+  for (int iter = 0; iter < 2; ++iter) {
+    dash::spmv(A, x, y);
+    y.barrier();
+
+    for (index_t r = 0; r < n; ++r) {
+      double expected = 2.0 * r * r;
+      if (r > 0) {
+        expected -= static_cast<double>((r - 1) * (r - 1));
+      }
+      if (r < n - 1) {
+        expected -= static_cast<double>((r + 1) * (r + 1));
+      }
+      ASSERT_EQ_U(expected, static_cast<double>(y[r]));
+    }
+    y.barrier();
+  }
+
+  // Only the neighbouring entries at block boundaries are transferred:
+  auto & plan = A.spmv_plan(x.pattern());
+  ASSERT_LE_U(plan.num_ghosts(), 2 * (local_rows[myid] + 1));
+  ASSERT_EQ_U(plan.interior_rows().size() + plan.boundary_rows().size(),
+              local_rows[myid]);
+  // Local entries of x are only buffered for boundary rows:
+  ASSERT_LE_U(plan.boundary_x_offsets().size(),
+              2 * plan.boundary_rows().size());
+
+  // The buffer of the plan is reused in following multiplications:
+  const double * buffer = plan.buffer();
+  dash::spmv(A, x, y);
+  ASSERT_EQ_U(buffer, A.spmv_plan(x.pattern()).buffer());
+  y.barrier();
+}
+
+TEST_F(SparseMatrixTest, ScatteredColumns)
+{
+  typedef dash::SparseMatrix<int>                matrix_t;
+  typedef dash::default_index_t                  index_t;
+
+  const size_t nunits = dash::size();
+  const size_t myid   = dash::myid();
+  const index_t nlocal_rows = 16;
+  const index_t nrows       = nlocal_rows * nunits;
+  const index_t ncols       = 3 * nrows + 1;
+
+  // Row r references columns r, (7r + 3) mod ncols and ncols - 1 - r:
+  std::vector<index_t> row_ptr { 0 };
+  std::vector<index_t> col_idx;
+  std::vector<int>     values;
+  for (index_t r = myid * nlocal_rows; r < (myid + 1) * nlocal_rows; ++r) {
+    col_idx.push_back(r);
+    col_idx.push_back((7 * r + 3) % ncols);
+    col_idx.push_back(ncols - 1 - r);
+    values.push_back(1);
+    values.push_back(2);
+    values.push_back(3);
+    row_ptr.push_back(col_idx.size());
+  }
+  matrix_t A(ncols, row_ptr, col_idx, values);
+  ASSERT_EQ_U(A.nnz(), 3 * nrows);
+
+  dash::Array<int> x(ncols, dash::BLOCKCYCLIC(5));
+  dash::Array<int, index_t, matrix_t::pattern_type> y(A.row_pattern());
+  for (size_t l = 0; l < x.lsize(); ++l) {
+    x.local[l] = static_cast<int>(x.pattern().global(l));
+  }
+
+  dash::spmv(A, x, y);
+  y.barrier();
+
+  for (index_t r = 0; r < nrows; ++r) {
+    int expected = r + 2 * ((7 * r + 3) % ncols) + 3 * (ncols - 1 - r);
+    ASSERT_EQ_U(expected, static_cast<int>(y[r]));
+  }
+}
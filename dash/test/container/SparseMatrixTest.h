@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__SPARSE_MATRIX_TEST_H_
+#define DASH__TEST__SPARSE_MATRIX_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::SparseMatrix and algorithm dash::spmv
+ */
+class SparseMatrixTest : public dash::test::TestBase {
+protected:
+
+  SparseMatrixTest() {
+    LOG_MESSAGE(">>> Test suite: SparseMatrixTest");
+  }
+
+  virtual ~SparseMatrixTest()
+  {
+    LOG_MESSAGE("<<< Closing test suite: SparseMatrixTest");
+  }
+};
+
+#endif // DASH__TEST__SPARSE_MATRIX_TEST_H_
@@ -1,6 +1,8 @@
 #include "DARTLockTest.h"
 
 #include <dash/Shared.h>
+#include <dash/Array.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/dart/if/dart.h>
 
 
@@ -234,3 +236,120 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, ReaderWriterLock) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dart_rwlock_t rwlock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &rwlock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_acquire_exclusive(rwlock));
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_release(rwlock));
+
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_acquire_shared(rwlock));
+    EXPECT_GT_U(static_cast<value_t>(shared.get()), i);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_release(rwlock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(),
+              static_cast<value_t>(shared.get()));
+
+  // Readers exclude writers:
+  int32_t acquired;
+  bool    is_reader = (dash::myid() != dash::size() - 1);
+  if (is_reader) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_acquire_shared(rwlock));
+  }
+  dash::barrier();
+  if (!is_reader && dash::size() > 1) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_try_acquire_exclusive(rwlock, &acquired));
+    EXPECT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (is_reader) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_release(rwlock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&rwlock));
+}
+
+TEST_F(DARTLockTest, LockArray) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  constexpr size_t nlocks      = 5;
+  dash::Array<value_t> counters(nlocks, dash::BLOCKED, dash::Team::All());
+  dart_lock_array_t locks;
+
+  dash::fill(counters.begin(), counters.end(), 0);
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_array_init(DART_TEAM_ALL, nlocks, &locks));
+  ASSERT_EQ_U(nlocks, dart_lock_array_size(locks));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    for (size_t l = 0; l < nlocks; ++l) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_array_acquire(locks, l));
+      counters[l] = counters[l] + 1;
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_array_release(locks, l));
+    }
+  }
+  dash::barrier();
+
+  for (size_t l = 0; l < nlocks; ++l) {
+    ASSERT_EQ_U(num_iterations * dash::size(),
+                static_cast<value_t>(counters[l]));
+  }
+
+  // Locks in the array are independent:
+  int32_t acquired;
+  ASSERT_EQ_U(DART_OK, dart_lock_array_try_acquire(locks, 0, &acquired));
+  if (acquired) {
+    int32_t acquired_other;
+    ASSERT_EQ_U(
+      DART_OK, dart_lock_array_try_acquire(locks, 1, &acquired_other));
+    if (acquired_other) {
+      ASSERT_EQ_U(DART_OK, dart_lock_array_release(locks, 1));
+    }
+    ASSERT_EQ_U(DART_OK, dart_lock_array_release(locks, 0));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_array_destroy(&locks));
+}
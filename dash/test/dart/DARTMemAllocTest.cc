@@ -169,3 +169,82 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     DART_OK,
     dart_team_memfree(gptr2));
 }
+
+TEST_F(DARTMemAllocTest, FileBackedTeamAlloc)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned_file(
+        DART_TEAM_ALL, block_size, DART_TYPE_INT, "/tmp", &gptr)
+  );
+  ASSERT_NE_U(DART_GPTR_NULL, gptr);
+
+  dart_gptr_t lgptr = gptr;
+  lgptr.unitid      = dash::myid().id;
+  value_t * baseptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_gptr_getaddr(lgptr, (void**)&baseptr));
+  ASSERT_NE_U(nullptr, baseptr);
+  for (size_t i = 0; i < block_size; ++i) {
+    baseptr[i] = dash::myid().id * block_size + i;
+  }
+  dash::barrier();
+
+  // read last element of neighbor's allocation
+  value_t neighbor_val;
+  size_t  neighbor_id = (dash::myid().id + 1) % dash::size();
+  dart_gptr_t ngptr   = gptr;
+  ngptr.unitid        = neighbor_id;
+  ngptr.addr_or_offs.offset = (block_size - 1) * sizeof(value_t);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+        &neighbor_val, ngptr, 1, DART_TYPE_INT, DART_TYPE_INT));
+  ASSERT_EQ_U(neighbor_id * block_size + block_size - 1, neighbor_val);
+
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memfree(gptr));
+}
+
+TEST_F(DARTMemAllocTest, BufferRegistration)
+{
+  std::vector<int> buf(1024);
+  ASSERT_EQ_U(DART_OK, dart_buffer_register(buf.data(), 1024 * sizeof(int)));
+  // registering a contained range hits the registration cache:
+  ASSERT_EQ_U(DART_OK, dart_buffer_register(buf.data() + 10, sizeof(int)));
+  // overlapping registration at the same pages:
+  ASSERT_EQ_U(DART_OK, dart_buffer_register(buf.data() + 512,
+                                            512 * sizeof(int)));
+  ASSERT_EQ_U(DART_OK, dart_buffer_deregister(buf.data()));
+  ASSERT_EQ_U(DART_OK, dart_buffer_deregister(buf.data() + 512));
+  ASSERT_EQ_U(DART_OK, dart_buffer_deregister(buf.data()));
+
+  // registrations exceeding the cache capacity are evicted implicitly:
+  std::vector<std::vector<char>> bufs(256, std::vector<char>(64));
+  for (auto & b : bufs) {
+    ASSERT_EQ_U(DART_OK, dart_buffer_register(b.data(), b.size()));
+  }
+  // deregistering an evicted registration has no effect:
+  ASSERT_EQ_U(DART_OK, dart_buffer_deregister(bufs.front().data()));
+  ASSERT_EQ_U(DART_OK, dart_buffer_deregister(bufs.back().data()));
+
+  // allocated buffers are never evicted, exceeding the cache capacity
+  // enlarges the cache:
+  std::vector<void *> addrs(256, nullptr);
+  for (auto & addr : addrs) {
+    ASSERT_EQ_U(DART_OK, dart_buffer_alloc(100, &addr));
+    ASSERT_NE_U(nullptr, addr);
+  }
+  ASSERT_EQ_U(DART_OK, dart_buffer_register(buf.data(), 1024 * sizeof(int)));
+  ASSERT_EQ_U(DART_OK, dart_buffer_deregister(buf.data()));
+  for (auto & addr : addrs) {
+    ASSERT_EQ_U(DART_OK, dart_buffer_free(addr));
+  }
+}
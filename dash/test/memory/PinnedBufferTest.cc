@@ -0,0 +1,38 @@
+
+#include "PinnedBufferTest.h"
+
+#include <dash/memory/PinnedBuffer.h>
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+
+#include <utility>
+
+
+TEST_F(PinnedBufferTest, RepeatedCopy)
+{
+  const size_t block_size = 100;
+  dash::Array<int> array(block_size * _dash_size);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = _dash_id * 1000 + l;
+  }
+  array.barrier();
+
+  dash::pinned_buffer<int> block(block_size);
+  ASSERT_EQ_U(block_size, block.size());
+  EXPECT_EQ_U(0, block[0]);
+
+  // Fetch the block of every unit into the same staging buffer:
+  for (size_t u = 0; u < _dash_size; ++u) {
+    auto first = array.begin() + u * block_size;
+    auto last  = dash::copy(first, first + block_size, block.begin());
+    EXPECT_EQ_U(block.end(), last);
+    for (size_t l = 0; l < block_size; ++l) {
+      EXPECT_EQ_U(static_cast<int>(u * 1000 + l), block[l]);
+    }
+  }
+
+  dash::pinned_buffer<int> moved(std::move(block));
+  EXPECT_EQ_U(block_size, moved.size());
+  EXPECT_TRUE_U(block.empty());
+  array.barrier();
+}
@@ -2,6 +2,10 @@
 #include "SymmetricAllocatorTest.h"
 
 #include <dash/allocator/SymmetricAllocator.h>
+#include <dash/allocator/FileBackedAllocator.h>
+#include <dash/memory/GlobStaticMem.h>
+#include <dash/Array.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/GlobPtr.h>
 #include <dash/Pattern.h>
 
@@ -92,3 +96,34 @@ TEST_F(SymmetricAllocatorTest, MoveCtor)
 
   target_new.deallocate(gptr.dart_gptr());
 }
+
+TEST_F(SymmetricAllocatorTest, FileBacked)
+{
+  using Alloc_t    = dash::allocator::FileBackedAllocator<int>;
+  using GlobMem_t  = dash::GlobStaticMem<int, Alloc_t>;
+
+  auto globmem_local_elements = { 1, 2, 3 };
+  GlobMem_t globmem(globmem_local_elements);
+
+  EXPECT_EQ_U(globmem.size(), 3 * dash::size());
+  for (dash::team_unit_t u{0}; u < dash::size(); u++) {
+    for (int l = 0; l < globmem_local_elements.size(); l++) {
+      int val = *(globmem.at(u,l));
+      EXPECT_EQ_U(l+1, val);
+    }
+  }
+  globmem.barrier();
+
+  // Containers use file-backed memory if configured:
+  dash::util::Config::set("DASH_MEMORY_FILE_PATH", "/tmp");
+  {
+    dash::Array<int> array(dash::size() * 100);
+    dash::fill(array.begin(), array.end(), dash::myid().id);
+    array.barrier();
+    for (int u = 0; u < dash::size(); ++u) {
+      EXPECT_EQ_U(u, static_cast<int>(array[u * 100]));
+    }
+    array.barrier();
+  }
+  dash::util::Config::set("DASH_MEMORY_FILE_PATH", "");
+}
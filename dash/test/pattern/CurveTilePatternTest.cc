@@ -0,0 +1,234 @@
+
+#include "CurveTilePatternTest.h"
+
+#include <dash/pattern/CurveTilePattern.h>
+#include <dash/pattern/MakePattern.h>
+#include <dash/pattern/PatternProperties.h>
+#include <dash/pattern/internal/SpaceFillingCurve.h>
+
+#include <dash/Matrix.h>
+#include <dash/Dimensional.h>
+#include <dash/TeamSpec.h>
+
+#include <cstdlib>
+#include <vector>
+
+
+TEST_F(CurveTilePatternTest, CurveEncoding)
+{
+  DASH_TEST_LOCAL_ONLY();
+
+  // Morton codes interleave coordinate bits, first dimension in the
+  // most significant position:
+  std::array<uint64_t, 2> m_coords {{ 3, 5 }};
+  auto m_code = dash::internal::morton_encode<2>(m_coords, 3);
+  EXPECT_EQ_U(0x1b, m_code);
+  EXPECT_EQ_U(m_coords, dash::internal::morton_decode<2>(m_code, 3));
+
+  // Hilbert curves are bijective and consecutive positions are adjacent:
+  int bits = 3;
+  std::vector<bool> visited(64, false);
+  std::array<uint64_t, 2> prev_2d {{ 0, 0 }};
+  for (uint64_t code = 0; code < 64; ++code) {
+    auto coords = dash::internal::hilbert_decode<2>(code, bits);
+    ASSERT_LT_U(coords[0], 8);
+    ASSERT_LT_U(coords[1], 8);
+    EXPECT_EQ_U(code, dash::internal::hilbert_encode<2>(coords, bits));
+    ASSERT_FALSE(visited[coords[0] * 8 + coords[1]]);
+    visited[coords[0] * 8 + coords[1]] = true;
+    if (code > 0) {
+      auto dist = std::abs(static_cast<int>(coords[0] - prev_2d[0])) +
+                  std::abs(static_cast<int>(coords[1] - prev_2d[1]));
+      EXPECT_EQ_U(1, dist);
+    }
+    prev_2d = coords;
+  }
+
+  bits = 2;
+  std::array<uint64_t, 3> prev_3d {{ 0, 0, 0 }};
+  for (uint64_t code = 0; code < 64; ++code) {
+    auto coords = dash::internal::hilbert_decode<3>(code, bits);
+    EXPECT_EQ_U(code, dash::internal::hilbert_encode<3>(coords, bits));
+    if (code > 0) {
+      int dist = 0;
+      for (int d = 0; d < 3; ++d) {
+        dist += std::abs(static_cast<int>(coords[d] - prev_3d[d]));
+      }
+      EXPECT_EQ_U(1, dist);
+    }
+    prev_3d = coords;
+  }
+}
+
+template<typename PatternT>
+static void check_curve_mapping(const PatternT & pattern)
+{
+  typedef typename PatternT::index_type index_t;
+  auto myid       = pattern.team().myid();
+  auto num_blocks = static_cast<index_t>(pattern.blockspec().size());
+  auto num_units  = pattern.num_units();
+
+  // Units are assigned consecutive segments of the curve with balanced
+  // number of blocks:
+  index_t total_blocks = 0;
+  for (dash::team_unit_t unit{0}; unit < num_units; ++unit) {
+    index_t l_blocks = pattern.local_blockspec(unit).size();
+    EXPECT_LE_U(num_blocks / num_units, l_blocks);
+    EXPECT_LE_U(l_blocks, (num_blocks + num_units - 1) / num_units);
+    for (index_t lb = 0; lb < l_blocks; ++lb) {
+      auto block = pattern.local_block(unit, lb);
+      EXPECT_EQ_U(
+        pattern.block_at(block.offsets()),
+        pattern.curve_block(total_blocks + lb));
+      EXPECT_EQ_U(unit, pattern.unit_at(block.offsets()));
+    }
+    total_blocks += l_blocks;
+  }
+  EXPECT_EQ_U(num_blocks, total_blocks);
+
+  // Global indices of local elements map back to their local index:
+  for (index_t l = 0; l < static_cast<index_t>(pattern.local_size()); ++l) {
+    auto l_pos = pattern.local(pattern.global(l));
+    ASSERT_EQ_U(myid, l_pos.unit);
+    ASSERT_EQ_U(l,    l_pos.index);
+  }
+  // Every global index maps to a distinct local index at its unit:
+  std::vector<std::vector<bool>> mapped(num_units);
+  for (size_t unit = 0; unit < mapped.size(); ++unit) {
+    mapped[unit].resize(pattern.local_size(dash::team_unit_t(unit)));
+  }
+  for (index_t g = 0; g < static_cast<index_t>(pattern.size()); ++g) {
+    auto g_coords = pattern.coords(g);
+    auto l_pos    = pattern.local(g);
+    auto l_coords = pattern.local(g_coords);
+    ASSERT_EQ_U(l_pos.unit,  l_coords.unit);
+    ASSERT_EQ_U(l_pos.unit,  pattern.unit_at(g));
+    ASSERT_EQ_U(l_pos.index, pattern.local_at(l_coords.coords));
+    ASSERT_EQ_U(g_coords,    pattern.global(l_pos.unit, l_coords.coords));
+    ASSERT_LT_U(l_pos.index, mapped[l_pos.unit].size());
+    ASSERT_FALSE(mapped[l_pos.unit][l_pos.index]);
+    mapped[l_pos.unit][l_pos.index] = true;
+  }
+}
+
+TEST_F(CurveTilePatternTest, Distribute2DimTile)
+{
+  typedef dash::CurveTilePattern<2>                          pattern_t;
+  typedef dash::CurveTilePattern<2, dash::ROW_MAJOR,
+                                 dash::default_index_t,
+                                 dash::SFC_MORTON>           pattern_z_t;
+
+  size_t block_rows = 3;
+  size_t block_cols = 4;
+  // Block arrangement with extents that are not powers of two:
+  size_t size_rows  = block_rows * 5;
+  size_t size_cols  = block_cols * (2 * dash::size() + 1);
+
+  dash::SizeSpec<2> sizespec(size_rows, size_cols);
+  dash::DistributionSpec<2> distspec(dash::TILE(block_rows),
+                                     dash::TILE(block_cols));
+  pattern_t   pattern(sizespec, distspec);
+  pattern_z_t pattern_z(sizespec, distspec);
+
+  LOG_MESSAGE("pattern: %s",
+              [&]() { std::ostringstream os; os << pattern;
+                      return os.str(); }().c_str());
+
+  ASSERT_EQ_U(size_rows * size_cols, pattern.capacity());
+  ASSERT_EQ_U(block_rows, pattern.blocksize(0));
+  ASSERT_EQ_U(block_cols, pattern.blocksize(1));
+  ASSERT_EQ_U(5 * (2 * dash::size() + 1), pattern.blockspec().size());
+
+  check_curve_mapping(pattern);
+  check_curve_mapping(pattern_z);
+
+  // Extents must be multiples of the block extents:
+  EXPECT_THROW(
+    pattern_t(dash::SizeSpec<2>(size_rows + 1, size_cols), distspec),
+    dash::exception::InvalidArgument);
+}
+
+TEST_F(CurveTilePatternTest, Distribute3DimTile)
+{
+  typedef dash::CurveTilePattern<3> pattern_t;
+
+  dash::SizeSpec<3> sizespec(2 * 3, 2 * dash::size(), 3 * 5);
+  dash::DistributionSpec<3> distspec(dash::TILE(2),
+                                     dash::TILE(2),
+                                     dash::TILE(5));
+  pattern_t pattern(sizespec, distspec);
+
+  check_curve_mapping(pattern);
+}
+
+TEST_F(CurveTilePatternTest, MakePattern)
+{
+  typedef dash::pattern_partitioning_properties<
+            dash::pattern_partitioning_tag::rectangular,
+            dash::pattern_partitioning_tag::balanced >
+          partitioning_props;
+  typedef dash::pattern_mapping_properties<
+            dash::pattern_mapping_tag::compact >
+          mapping_props;
+  typedef dash::pattern_layout_properties<
+            dash::pattern_layout_tag::blocked,
+            dash::pattern_layout_tag::linear >
+          layout_props;
+
+  dash::TeamSpec<2> teamspec(dash::Team::All());
+  teamspec.balance_extents();
+  dash::SizeSpec<2> sizespec(teamspec.extent(0) * 4,
+                             teamspec.extent(1) * 6);
+
+  auto pattern = dash::make_pattern<
+                   partitioning_props,
+                   mapping_props,
+                   layout_props >(sizespec, teamspec);
+
+  typedef decltype(pattern) pattern_t;
+  static_assert(
+    std::is_same<
+      pattern_t,
+      dash::CurveTilePattern<2, dash::ROW_MAJOR,
+                             typename pattern_t::index_type>
+    >::value,
+    "make_pattern with compact mapping must return CurveTilePattern");
+  ASSERT_TRUE_U(
+    dash::pattern_mapping_traits<pattern_t>::type::compact);
+  ASSERT_EQ_U(4, pattern.blocksize(0));
+  ASSERT_EQ_U(6, pattern.blocksize(1));
+
+  check_curve_mapping(pattern);
+}
+
+TEST_F(CurveTilePatternTest, Matrix)
+{
+  typedef dash::CurveTilePattern<2>       pattern_t;
+  typedef typename pattern_t::index_type  index_t;
+
+  size_t extent_rows = 4 * 3;
+  size_t extent_cols = 2 * (dash::size() + 1);
+  pattern_t pattern(dash::SizeSpec<2>(extent_rows, extent_cols),
+                    dash::DistributionSpec<2>(dash::TILE(4),
+                                              dash::TILE(2)));
+  dash::Matrix<index_t, 2, index_t, pattern_t> matrix(pattern);
+
+  ASSERT_EQ_U(pattern.local_size(), matrix.local_size());
+  // Initialize local elements with their canonical global index:
+  for (index_t l = 0; l < static_cast<index_t>(matrix.local_size()); ++l) {
+    matrix.lbegin()[l] = pattern.global(l);
+  }
+  matrix.barrier();
+
+  for (index_t row = 0; row < static_cast<index_t>(extent_rows); ++row) {
+    for (index_t col = 0; col < static_cast<index_t>(extent_cols); ++col) {
+      index_t expected = row * extent_cols + col;
+      EXPECT_EQ_U(expected, static_cast<index_t>(matrix[row][col]));
+    }
+  }
+  auto it = matrix.begin();
+  for (index_t g = 0; g < static_cast<index_t>(matrix.size()); ++g, ++it) {
+    EXPECT_EQ_U(g, static_cast<index_t>(*it));
+  }
+  matrix.barrier();
+}
@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__CURVE_TILE_PATTERN_TEST_H_
+#define DASH__TEST__CURVE_TILE_PATTERN_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::CurveTilePattern
+ */
+class CurveTilePatternTest : public dash::test::TestBase {
+protected:
+
+  CurveTilePatternTest() {
+    LOG_MESSAGE(">>> Test suite: CurveTilePatternTest");
+  }
+
+  virtual ~CurveTilePatternTest() {
+    LOG_MESSAGE("<<< Closing test suite: CurveTilePatternTest");
+  }
+
+};
+
+#endif // DASH__TEST__CURVE_TILE_PATTERN_TEST_H_
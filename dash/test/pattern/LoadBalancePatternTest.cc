@@ -4,6 +4,10 @@
 #include <dash/pattern/LoadBalancePattern.h>
 #include <dash/util/TeamLocality.h>
 #include <dash/Dimensional.h>
+#include <dash/Array.h>
+
+#include <vector>
+#include <cmath>
 
 
 void mock_team_locality(
@@ -155,3 +159,67 @@ TEST_F(LoadBalancePatternTest, IndexMapping)
   }
   EXPECT_EQ_U(pattern.size(), total_size);
 }
+
+TEST_F(LoadBalancePatternTest, MeasuredLoadWeights)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  typedef dash::LoadBalancePattern<1>    pattern_t;
+  typedef pattern_t::index_type          index_t;
+  typedef dash::util::TeamLocality       team_loc_t;
+
+  size_t     size = 1000 * dash::size() + 7;
+  team_loc_t tloc(dash::Team::All());
+
+  pattern_t pattern(dash::SizeSpec<1>(size), tloc);
+  dash::Array<index_t, index_t, pattern_t> array(pattern);
+
+  for (index_t li = 0; li < static_cast<index_t>(array.lsize()); ++li) {
+    array.local[li] = pattern.global(li);
+  }
+  array.barrier();
+
+  // Unit 1 needs four times longer per element than all other units:
+  auto   myid         = dash::myid();
+  std::vector<size_t> lsizes_prev;
+  for (dash::team_unit_t u{0}; u < dash::size(); ++u) {
+    lsizes_prev.push_back(pattern.local_size(u));
+  }
+  double unit_elapsed = 100.0 * pattern.local_size();
+  if (myid == 1) {
+    unit_elapsed *= 4;
+  }
+  pattern.update_load_weights(unit_elapsed);
+
+  size_t total_size = 0;
+  for (dash::team_unit_t u{0}; u < dash::size(); ++u) {
+    total_size += pattern.local_size(u);
+    if (u.id == 1) {
+      EXPECT_LT_U(pattern.local_size(u), lsizes_prev[u]);
+    } else {
+      EXPECT_LE_U(lsizes_prev[u], pattern.local_size(u));
+    }
+  }
+  EXPECT_EQ_U(size, total_size);
+
+  // Throughput of unit 1 is a quarter of the throughput of other units:
+  double exp_lsize_1 = static_cast<double>(size) /
+                         (4 * (dash::size() - 1) + 1);
+  EXPECT_LE_U(std::abs(pattern.local_size(dash::team_unit_t{1}) -
+                       exp_lsize_1), 1.0);
+
+  array.rebalance(pattern);
+
+  ASSERT_EQ_U(size, array.size());
+  ASSERT_EQ_U(pattern.local_size(), array.lsize());
+  for (index_t li = 0; li < static_cast<index_t>(array.lsize()); ++li) {
+    EXPECT_EQ_U(pattern.global(li), array.local[li]);
+  }
+  array.barrier();
+  for (index_t gi = 0; gi < static_cast<index_t>(size); ++gi) {
+    EXPECT_EQ_U(gi, static_cast<index_t>(array[gi]));
+  }
+  array.barrier();
+}
@@ -6,6 +6,7 @@
 
 #include <iomanip>
 #include <array>
+#include <vector>
 
 
 using std::endl;
@@ -196,3 +197,93 @@ TEST_F(TilePatternTest, Tile2DimTeam2Dim)
 
 }
 
+
+template<typename PatternT>
+static void check_local_index_roundtrip(const PatternT & pattern)
+{
+  typedef typename PatternT::index_type index_t;
+  auto myid = pattern.team().myid();
+  // Global indices of local elements map back to their local index:
+  for (index_t l = 0; l < static_cast<index_t>(pattern.local_size()); ++l) {
+    auto l_pos = pattern.local(pattern.global(l));
+    ASSERT_EQ_U(myid, l_pos.unit);
+    ASSERT_EQ_U(l,    l_pos.index);
+  }
+  // Every global index maps to a distinct local index at its unit:
+  std::vector<std::vector<bool>> mapped(pattern.num_units());
+  for (size_t unit = 0; unit < pattern.num_units(); ++unit) {
+    mapped[unit].resize(pattern.local_size(dash::team_unit_t(unit)));
+  }
+  for (index_t g = 0; g < static_cast<index_t>(pattern.size()); ++g) {
+    auto l_pos        = pattern.local(g);
+    auto l_coords_pos = pattern.local_index(pattern.coords(g));
+    ASSERT_EQ_U(l_pos.unit,  l_coords_pos.unit);
+    ASSERT_EQ_U(l_pos.index, l_coords_pos.index);
+    ASSERT_EQ_U(l_pos.unit,  pattern.unit_at(g));
+    ASSERT_LT_U(l_pos.index, mapped[l_pos.unit].size());
+    ASSERT_FALSE(mapped[l_pos.unit][l_pos.index]);
+    mapped[l_pos.unit][l_pos.index] = true;
+  }
+}
+
+TEST_F(TilePatternTest, LocalIndexRoundTrip)
+{
+  dash::TeamSpec<2> teamspec_2d(dash::Team::All());
+  teamspec_2d.balance_extents();
+  auto nunits_x = teamspec_2d.extent(0);
+  auto nunits_y = teamspec_2d.extent(1);
+
+  // Block extents that are neither powers of two nor divide the extents
+  // of the pattern, and power-of-two block extents:
+  for (int blocksize : { 3, 4 }) {
+    int extent_x = blocksize * (nunits_x * 3 + 1);
+    int extent_y = (blocksize + 2) * (nunits_y * 2 + 1);
+
+    dash::TilePattern<2, dash::ROW_MAJOR> pattern_row(
+      dash::SizeSpec<2>(extent_x, extent_y),
+      dash::DistributionSpec<2>(dash::TILE(blocksize),
+                                dash::TILE(blocksize + 2)),
+      teamspec_2d);
+    check_local_index_roundtrip(pattern_row);
+
+    dash::TilePattern<2, dash::COL_MAJOR> pattern_col(
+      dash::SizeSpec<2>(extent_x, extent_y),
+      dash::DistributionSpec<2>(dash::TILE(blocksize),
+                                dash::TILE(blocksize + 2)),
+      teamspec_2d);
+    check_local_index_roundtrip(pattern_col);
+  }
+}
+
+TEST_F(TilePatternTest, NodeMappedTeamSpec)
+{
+  typedef dash::default_index_t index_t;
+  auto nunits = dash::size();
+  if (nunits < 4 || nunits % 2 != 0) {
+    SKIP_TEST_MSG("requires an even number of at least 4 units");
+  }
+  // Units placed at two nodes, node 0 with units 0, 3, 4, 7, 8, ...:
+  dash::TeamSpec<2> teamspec(2, nunits / 2);
+  std::vector<index_t> unit_nodes(nunits);
+  for (size_t u = 0; u < nunits; ++u) {
+    unit_nodes[u] = ((u + 1) / 2) % 2;
+  }
+  ASSERT_TRUE(teamspec.map_to_nodes(unit_nodes));
+  ASSERT_TRUE(teamspec.is_node_mapped());
+
+  dash::TilePattern<2, dash::ROW_MAJOR> pattern(
+    dash::SizeSpec<2>(3 * 2 * 3, 4 * (nunits / 2) * 3),
+    dash::DistributionSpec<2>(dash::TILE(3), dash::TILE(4)),
+    teamspec);
+  ASSERT_TRUE(teamspec == pattern.teamspec());
+  check_local_index_roundtrip(pattern);
+
+  // Blocks are assigned to units according to the arrangement:
+  for (index_t bx = 0; bx < 6; ++bx) {
+    for (index_t by = 0; by < static_cast<index_t>(nunits / 2 * 3); ++by) {
+      std::array<index_t, 2> g_coords {{ bx * 3, by * 4 }};
+      EXPECT_EQ_U(teamspec.at(bx % 2, by % (nunits / 2)),
+                  pattern.unit_at(g_coords).id);
+    }
+  }
+}
@@ -126,3 +126,48 @@ TEST_F(TeamSpecTest, BalanceExtents)
   ASSERT_GE(10, ts_3d.num_units(2));
   ASSERT_EQ(12*5*7, ts_3d.size());
 }
+
+TEST_F(TeamSpecTest, MapToNodes)
+{
+  typedef dash::default_index_t index_t;
+
+  // 16 units placed round-robin at 4 nodes:
+  dash::TeamSpec<2> ts(4, 4);
+  std::vector<index_t> unit_nodes(16);
+  for (index_t u = 0; u < 16; ++u) {
+    unit_nodes[u] = u % 4;
+  }
+  ASSERT_TRUE(ts.map_to_nodes(unit_nodes));
+  ASSERT_TRUE(ts.is_node_mapped());
+  for (index_t u = 0; u < 16; ++u) {
+    auto coords = ts.coords(u);
+    EXPECT_EQ_U(u, ts.at(coords));
+    EXPECT_EQ_U(u, ts.at(coords[0], coords[1]));
+    // Units of a node are assigned to a 2x2 sub-grid, nodes in row-major
+    // order:
+    auto node = unit_nodes[u];
+    EXPECT_EQ_U(node / 2, coords[0] / 2);
+    EXPECT_EQ_U(node % 2, coords[1] / 2);
+  }
+  // Units of node 0 in row-major order in its sub-grid:
+  EXPECT_EQ_U(0,  ts.at(0, 0));
+  EXPECT_EQ_U(4,  ts.at(0, 1));
+  EXPECT_EQ_U(8,  ts.at(1, 0));
+  EXPECT_EQ_U(12, ts.at(1, 1));
+
+  // Changing the extents resets the arrangement:
+  ts.resize(std::array<size_t, 2> {{ 2, 8 }});
+  EXPECT_FALSE(ts.is_node_mapped());
+  EXPECT_EQ_U(9, ts.at(1, 1));
+
+  // Units at a single node are arranged in row-major order:
+  dash::TeamSpec<2> ts_single(4, 4);
+  ASSERT_TRUE(ts_single.map_to_nodes(std::vector<index_t>(16, 0)));
+  EXPECT_FALSE(ts_single.is_node_mapped());
+
+  // Nodes with different numbers of units are not arranged:
+  dash::TeamSpec<2> ts_odd(2, 3);
+  EXPECT_FALSE(ts_odd.map_to_nodes({ 0, 0, 0, 0, 1, 1 }));
+  EXPECT_FALSE(ts_odd.is_node_mapped());
+  EXPECT_EQ_U(4, ts_odd.at(1, 1));
+}
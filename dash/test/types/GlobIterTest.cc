@@ -7,6 +7,8 @@
 #include <dash/Types.h>
 #include <dash/Array.h>
 #include <dash/Atomic.h>
+#include <dash/Matrix.h>
+#include <dash/iterator/GlobSegment.h>
 
 
 TEST_F(GlobIterTest, IteratorTypes)
@@ -57,3 +59,49 @@ TEST_F(GlobIterTest, RemoteIterator){
   ASSERT_EQ_U(newval, myid+1);
   */
 }
+
+TEST_F(GlobIterTest, Segments)
+{
+  typedef dash::default_index_t index_t;
+
+  // Check that all elements of every segment are stored consecutively at
+  // the segment's unit:
+  auto check_segments = [](const auto & first, const auto & last) {
+    typedef typename std::decay<decltype(first)>::type iter_t;
+    typedef typename iter_t::local_pointer             local_pointer;
+    index_t num_elem  = last - first;
+    index_t num_seg   = 0;
+    index_t seg_total = 0;
+    dash::for_each_segment(
+      first, last,
+      [&](const dash::GlobSegment<index_t, local_pointer> & seg) {
+        EXPECT_EQ_U(seg_total, seg.offset);
+        for (index_t i = 0; i < seg.size; ++i) {
+          auto lpos = (first + (seg.offset + i)).lpos();
+          EXPECT_EQ_U(seg.unit,       lpos.unit);
+          EXPECT_EQ_U(seg.lindex + i, lpos.index);
+        }
+        seg_total += seg.size;
+        ++num_seg;
+      });
+    EXPECT_EQ_U(num_elem, seg_total);
+    return num_seg;
+  };
+
+  const size_t nunits    = dash::size();
+  const size_t blocksize = 3;
+  dash::Array<int> array(nunits * 7 * blocksize + 2,
+                         dash::BLOCKCYCLIC(blocksize));
+  // One segment per block overlapping the range:
+  auto nseg = check_segments(array.begin() + 1, array.end() - 1);
+  EXPECT_EQ_U(array.pattern().blockspec().size(), nseg);
+
+  const size_t nrows = 5;
+  const size_t ncols = nunits * 4;
+  dash::Matrix<int, 2> matrix(nrows, ncols);
+  check_segments(matrix.begin(), matrix.end());
+  // Sub-matrix of inner columns, rows are split at the view's border:
+  auto inner_cols = matrix.sub<1>(1, ncols - 2);
+  nseg = check_segments(inner_cols.begin(), inner_cols.end());
+  EXPECT_LE_U(nrows, nseg);
+}
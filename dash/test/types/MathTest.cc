@@ -0,0 +1,74 @@
+#include "MathTest.h"
+
+#include <dash/internal/Math.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+template<typename Integer>
+static void check_fast_divisor(
+  Integer                       divisor,
+  const std::vector<Integer>  & dividends)
+{
+  dash::math::FastDivisor<Integer> fast_div(divisor);
+  ASSERT_EQ_U(divisor, fast_div.divisor());
+  for (auto n : dividends) {
+    Integer q, r;
+    fast_div.divmod(n, q, r);
+    ASSERT_EQ_U(n / divisor, fast_div.divide(n));
+    ASSERT_EQ_U(n % divisor, fast_div.modulo(n));
+    ASSERT_EQ_U(n / divisor, q);
+    ASSERT_EQ_U(n % divisor, r);
+  }
+}
+
+template<typename Integer>
+static void check_fast_divisors()
+{
+  const Integer max = std::numeric_limits<Integer>::max();
+  std::vector<Integer> divisors;
+  for (Integer d = 1; d < 300; ++d) {
+    divisors.push_back(d);
+  }
+  for (int shift = 9; shift < std::numeric_limits<Integer>::digits;
+       ++shift) {
+    Integer p = Integer(1) << shift;
+    divisors.push_back(p - 1);
+    divisors.push_back(p);
+    divisors.push_back(p + 1);
+    divisors.push_back(p / 3 * 2 + 7);
+  }
+  divisors.push_back(max);
+  divisors.push_back(max - 1);
+  divisors.push_back(max / 7);
+
+  std::vector<Integer> dividends;
+  for (Integer n = 0; n < 1000; ++n) {
+    dividends.push_back(n);
+  }
+  for (Integer n = max; n > max - 1000; --n) {
+    dividends.push_back(n);
+  }
+  for (int shift = 10; shift < std::numeric_limits<Integer>::digits;
+       ++shift) {
+    Integer p = Integer(1) << shift;
+    dividends.push_back(p - 1);
+    dividends.push_back(p);
+    dividends.push_back(p + 1);
+    dividends.push_back(p / 5 * 3 + 11);
+  }
+
+  for (auto d : divisors) {
+    check_fast_divisor<Integer>(d, dividends);
+  }
+}
+
+TEST_F(MathTest, FastDivisor)
+{
+  check_fast_divisors<uint32_t>();
+  check_fast_divisors<uint64_t>();
+  check_fast_divisors<int32_t>();
+  check_fast_divisors<int64_t>();
+}
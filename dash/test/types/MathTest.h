@@ -0,0 +1,12 @@
+#ifndef DASH__TEST__MATH_TEST_H_
+#define DASH__TEST__MATH_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for utility functions in dash::math
+ */
+class MathTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__MATH_TEST_H_
@@ -0,0 +1,64 @@
+#include "MutexTest.h"
+
+#include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
+#include <dash/MutexArray.h>
+#include <dash/Shared.h>
+#include <dash/Array.h>
+#include <dash/algorithm/Fill.h>
+
+#include <mutex>
+
+
+TEST_F(MutexTest, SharedMutex) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dash::SharedMutex mx;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+  dash::barrier();
+
+  for (int i = 0; i < num_iterations; ++i) {
+    {
+      std::lock_guard<dash::SharedMutex> lg(mx);
+      shared.set(shared.get() + 1);
+    }
+    mx.lock_shared();
+    EXPECT_GT_U(static_cast<value_t>(shared.get()), i);
+    mx.unlock_shared();
+  }
+  dash::barrier();
+
+  EXPECT_EQ_U(num_iterations * dash::size(),
+              static_cast<value_t>(shared.get()));
+}
+
+TEST_F(MutexTest, MutexArray) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  const size_t  nlocks         = 2 * dash::size() + 1;
+  dash::Array<value_t> buckets(nlocks);
+  dash::MutexArray mxa(nlocks);
+
+  EXPECT_EQ_U(nlocks, mxa.size());
+  dash::fill(buckets.begin(), buckets.end(), 0);
+  dash::barrier();
+
+  for (int i = 0; i < num_iterations; ++i) {
+    for (size_t b = 0; b < nlocks; ++b) {
+      auto mx = mxa[(b + dash::myid()) % nlocks];
+      std::lock_guard<dash::MutexArray::reference> lg(mx);
+      auto idx = (b + dash::myid()) % nlocks;
+      buckets[idx] = buckets[idx] + 1;
+    }
+  }
+  dash::barrier();
+
+  for (size_t b = 0; b < nlocks; ++b) {
+    EXPECT_EQ_U(num_iterations * dash::size(),
+                static_cast<value_t>(buckets[b]));
+  }
+}
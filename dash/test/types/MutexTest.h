@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__MUTEX_TEST_H_
+#define DASH__TEST__MUTEX_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for classes dash::Mutex, dash::SharedMutex and
+ * dash::MutexArray
+ */
+class MutexTest : public dash::test::TestBase {
+protected:
+
+  MutexTest() {}
+
+  virtual ~MutexTest() {}
+};
+
+#endif // DASH__TEST__MUTEX_TEST_H_
@@ -0,0 +1,105 @@
+
+#include "ScratchArenaTest.h"
+
+#include <dash/util/ScratchArena.h>
+
+#include <cstdint>
+#include <vector>
+
+
+TEST_F(ScratchArenaTest, ScopeReset) {
+  DASH_TEST_LOCAL_ONLY();
+
+  using dash::util::ScratchArena;
+
+  ScratchArena arena(1024);
+  EXPECT_EQ_U(0, arena.size());
+
+  double * outer = arena.allocate<double>(16);
+  ASSERT_NE_U(nullptr, outer);
+  EXPECT_EQ_U(0, reinterpret_cast<uintptr_t>(outer) % alignof(double));
+  auto size_outer = arena.size();
+  {
+    ScratchArena::Scope scope(arena);
+    int * inner = arena.allocate<int>(32, 64);
+    EXPECT_EQ_U(0, reinterpret_cast<uintptr_t>(inner) % 64);
+    EXPECT_GT_U(arena.size(), size_outer);
+  }
+  EXPECT_EQ_U(size_outer, arena.size());
+
+  // Requests exceeding the block size are served from a dedicated block
+  // which is retained after reset:
+  char * large = static_cast<char *>(arena.allocate(4096));
+  ASSERT_NE_U(nullptr, large);
+  auto capacity = arena.capacity();
+  EXPECT_GE_U(capacity, 1024 + 4096);
+
+  arena.reset();
+  EXPECT_EQ_U(0, arena.size());
+  arena.allocate(4096);
+  EXPECT_EQ_U(capacity, arena.capacity());
+
+  // Shrinking scopes free blocks added in the scope:
+  arena.reset();
+  arena.allocate(16);
+  {
+    ScratchArena::Scope scope(arena, true);
+    arena.allocate(8192);
+  }
+  EXPECT_EQ_U(16, arena.size());
+  EXPECT_GE_U(arena.capacity(), 16);
+  EXPECT_LT_U(arena.capacity(), 8192);
+
+  arena.release();
+  EXPECT_EQ_U(0, arena.capacity());
+}
+
+TEST_F(ScratchArenaTest, ShrinkScope) {
+  DASH_TEST_LOCAL_ONLY();
+
+  using dash::util::ScratchArena;
+
+  // Blocks added in a shrinking scope are freed even if the arena had no
+  // blocks before:
+  ScratchArena arena(1024);
+  ASSERT_EQ_U(0, arena.num_blocks());
+  {
+    ScratchArena::Scope scope(arena, true);
+    arena.allocate(8192);
+    EXPECT_EQ_U(1, arena.num_blocks());
+  }
+  EXPECT_EQ_U(0, arena.num_blocks());
+  EXPECT_EQ_U(0, arena.capacity());
+
+  // Blocks existing before the scope are retained:
+  arena.allocate(16);
+  arena.reset();
+  ASSERT_EQ_U(1, arena.num_blocks());
+  {
+    ScratchArena::Scope scope(arena, true);
+    arena.allocate(512);
+    arena.allocate(8192);
+    EXPECT_EQ_U(2, arena.num_blocks());
+  }
+  EXPECT_EQ_U(1, arena.num_blocks());
+  EXPECT_EQ_U(0, arena.size());
+}
+
+TEST_F(ScratchArenaTest, StdAllocator) {
+  DASH_TEST_LOCAL_ONLY();
+
+  using dash::util::ScratchArena;
+  using dash::util::ScratchAllocator;
+
+  auto & arena = ScratchArena::local();
+  ScratchArena::Scope scope(arena);
+
+  std::vector<int, ScratchAllocator<int>> vec(
+    (ScratchAllocator<int>(arena)));
+  for (int i = 0; i < 1000; ++i) {
+    vec.push_back(i);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ_U(i, vec[i]);
+  }
+}
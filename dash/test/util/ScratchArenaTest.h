@@ -0,0 +1,12 @@
+#ifndef DASH__TEST__SCRATCH_ARENA_TEST_H_
+#define DASH__TEST__SCRATCH_ARENA_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::util::ScratchArena
+ */
+class ScratchArenaTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__SCRATCH_ARENA_TEST_H_
@@ -915,3 +915,50 @@ TEST_F(NViewTest, MatrixBlockCyclic2DimSub)
   }
   mat.barrier();
 }
+
+TEST_F(NViewTest, MatrixCachedSub)
+{
+  auto nunits = dash::size();
+
+  int block_rows = 3;
+  int block_cols = 4;
+
+  int nrows = 2      * block_rows;
+  int ncols = nunits * block_cols;
+
+  dash::Matrix<double, 2> mat(
+      dash::SizeSpec<2>(
+        nrows,
+        ncols),
+      dash::DistributionSpec<2>(
+        dash::NONE,
+        dash::TILE(block_cols)),
+      dash::Team::All(),
+      dash::TeamSpec<2>(
+        1,
+        nunits));
+
+  dash::test::initialize_matrix(mat);
+
+  if (dash::myid() == 0) {
+    // Region of 4 rows and 3 columns:
+    auto nview_cr_s_g = dash::sub<1>(1, 4, dash::sub<0>(1, 5, mat));
+    auto nview_cached = dash::cached(nview_cr_s_g);
+    auto index_cached = nview_cached.index_set();
+
+    EXPECT_EQ_U(nview_cr_s_g.size(), nview_cached.size());
+    // One contiguous index range per row, in constant distance:
+    EXPECT_EQ_U(4, index_cached.ranges().size());
+    EXPECT_TRUE_U(index_cached.is_affine());
+    for (size_t i = 0; i < nview_cr_s_g.size(); ++i) {
+      EXPECT_EQ_U(dash::index(nview_cr_s_g)[i], index_cached[i]);
+    }
+
+    auto exp_values = dash::test::region_values(
+                        mat, {{ 1,1 }, { 4,3 }} );
+    EXPECT_TRUE_U(
+      dash::test::expect_range_values_equal<double>(
+        exp_values, nview_cached));
+  }
+  mat.barrier();
+}
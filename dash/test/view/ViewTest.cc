@@ -13,6 +13,7 @@
 #include <sstream>
 #include <string>
 #include <iomanip>
+#include <vector>
 
 
 namespace dash {
@@ -1879,3 +1880,64 @@ TEST_F(ViewTest, ArrayBlockedPatternViewUnion)
                            });
 }
 */
+
+TEST_F(ViewTest, CachedIndexSet)
+{
+  int block_size       = 4;
+  int blocks_per_unit  = 3;
+  int array_size       = dash::size() * block_size * blocks_per_unit;
+
+  dash::Array<float> a(array_size, dash::BLOCKCYCLIC(block_size));
+  dash::test::initialize_array(a);
+
+  // sub(sub(array))
+  //
+  if (dash::myid() == 0) {
+    auto s_s_view = dash::sub(1, array_size - 3,
+                      dash::sub(block_size / 2, array_size,
+                        a));
+    auto c_view   = dash::cached(s_s_view);
+    auto c_index  = c_view.index_set();
+
+    EXPECT_EQ_U(s_s_view.size(), c_view.size());
+    EXPECT_EQ_U(1, c_index.ranges().size());
+    EXPECT_TRUE_U(c_index.is_affine());
+    for (size_t i = 0; i < s_s_view.size(); ++i) {
+      EXPECT_EQ_U(dash::index(s_s_view)[i], c_index[i]);
+    }
+    EXPECT_TRUE_U(std::equal(s_s_view.begin(), s_s_view.end(),
+                             c_view.begin()));
+  }
+  a.barrier();
+
+  // sub(local(sub(array)))
+  //
+  {
+    auto l_s_view   = dash::local(
+                        dash::sub(
+                          block_size / 2,
+                          a.size() - (block_size / 2),
+                          a));
+    auto s_l_s_view = dash::sub(1, l_s_view.size() - 1, l_s_view);
+    auto c_view     = dash::cached(s_l_s_view);
+
+    EXPECT_EQ_U(s_l_s_view.size(), c_view.size());
+    for (size_t i = 0; i < s_l_s_view.size(); ++i) {
+      EXPECT_EQ_U(dash::index(s_l_s_view)[i], c_view.index_set()[i]);
+    }
+    EXPECT_TRUE_U(std::equal(s_l_s_view.begin(), s_l_s_view.end(),
+                             c_view.begin()));
+    // Writes through cached view:
+    std::vector<float> values_orig(s_l_s_view.begin(), s_l_s_view.end());
+    for (auto & value : c_view) {
+      value += 1000;
+    }
+    for (size_t i = 0; i < s_l_s_view.size(); ++i) {
+      EXPECT_EQ_U(values_orig[i] + 1000,
+                  a.lbegin()[c_view.index_set()[i]]);
+    }
+    // Local elements outside of the view are unchanged:
+    EXPECT_LT_U(a.lbegin()[0], 1000);
+  }
+  a.barrier();
+}